@@ -59,6 +59,8 @@ list(APPEND MAIN_SOURCE_FILES
   opm/common/utility/FileSystem.cpp
   opm/common/utility/MemPacker.cpp
   opm/common/utility/OpmInputError.cpp
+  opm/common/utility/PackedImage.cpp
+  opm/common/utility/Profiler.cpp
   opm/common/utility/shmatch.cpp
   opm/common/utility/String.cpp
   opm/common/utility/SymmTensor.cpp
@@ -243,6 +245,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/Group/GConSale.cpp
   opm/input/eclipse/Schedule/Group/GConSump.cpp
   opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.cpp
+  opm/input/eclipse/Schedule/Group/GroupHierarchy.cpp
   opm/input/eclipse/Schedule/Group/GroupSatelliteInjection.cpp
   opm/input/eclipse/Schedule/Group/GSatProd.cpp
   opm/input/eclipse/Schedule/Group/GTNode.cpp
@@ -428,6 +431,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/output/eclipse/Tables.cpp
   opm/output/eclipse/UDQDims.cpp
   opm/output/eclipse/RegionCache.cpp
+  opm/output/eclipse/RegionReduction.cpp
   opm/output/eclipse/RestartValue.cpp
   opm/output/eclipse/WriteInit.cpp
   opm/output/eclipse/WriteRFT.cpp
@@ -501,6 +505,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_cmp.cpp
   tests/test_CompletedCells.cpp
   tests/test_CopyablePtr.cpp
+  tests/test_CopyOnWriteVector.cpp
   tests/test_ConditionalStorage.cpp
   tests/test_critical_error.cpp
   tests/test_CSRGraphFromCoordinates.cpp
@@ -538,11 +543,14 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_OpmLog.cpp
   tests/test_OutputStream.cpp
   tests/test_PhaseUsageInfo.cpp
+  tests/test_PackedImage.cpp
   tests/test_PaddedOutputString.cpp
   tests/test_param.cpp
   tests/test_PAvgCalculator.cpp
   tests/test_PAvgDynamicSourceData.cpp
+  tests/test_Profiler.cpp
   tests/test_regionCache.cpp
+  tests/test_RegionReduction.cpp
   tests/test_RegionSetMatcher.cpp
   tests/test_Restart.cpp
   tests/test_RestartFileView.cpp
@@ -851,6 +859,10 @@ list(APPEND TEST_DATA_FILES
 list(APPEND EXAMPLE_SOURCE_FILES
   examples/wellgraph.cpp
   examples/networkgraph.cpp
+  examples/eclio_throughput.cpp
+  examples/thpres_lookup.cpp
+  examples/unit_conversion.cpp
+  examples/csr_compress.cpp
 )
 
 # programs listed here will not only be compiled, but also marked for
@@ -891,7 +903,10 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/common/utility/FileSystem.hpp
   opm/common/utility/MemPacker.hpp
   opm/common/utility/OpmInputError.hpp
+  opm/common/utility/PackedImage.hpp
+  opm/common/utility/Profiler.hpp
   opm/common/utility/Serializer.hpp
+  opm/common/utility/StreamPacker.hpp
   opm/common/utility/String.hpp
   opm/common/utility/SymmTensor.hpp
   opm/common/utility/ThreadSafeMapBuilder.hpp
@@ -901,6 +916,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/common/utility/VoigtArray.hpp
   opm/common/utility/gpuDecorators.hpp
   opm/common/utility/gpuistl_if_available.hpp
+  opm/common/utility/numeric/CellGeometry.hpp
   opm/common/utility/numeric/GeometryUtil.hpp
   opm/common/utility/numeric/GridUtil.hpp
   opm/common/utility/numeric/MonotCubicInterpolator.hpp
@@ -1135,6 +1151,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/Schedule/Group/GTNode.hpp
   opm/input/eclipse/Schedule/Group/Group.hpp
   opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp
+  opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp
   opm/input/eclipse/Schedule/Group/GroupSatelliteInjection.hpp
   opm/input/eclipse/Schedule/Group/GuideRate.hpp
   opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp
@@ -1518,6 +1535,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/output/eclipse/LinearisedOutputTable.hpp
   opm/output/eclipse/LogiHEAD.hpp
   opm/output/eclipse/RegionCache.hpp
+  opm/output/eclipse/RegionReduction.hpp
   opm/output/eclipse/RestartIO.hpp
   opm/output/eclipse/RestartValue.hpp
   opm/output/eclipse/Summary.hpp
@@ -1544,6 +1562,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/output/eclipse/WriteRestartHelpers.hpp
   opm/output/eclipse/report/WellSpecification.hpp
   opm/utility/CopyablePtr.hpp
+  opm/utility/CopyOnWriteVector.hpp
   opm/utility/EModel.hpp
   opm/utility/GroupStructureViz.hpp
   opm/utility/WellStructureViz.hpp
@@ -2,6 +2,7 @@ include(OpmInterproceduralOptimization)
 include(UseFastBuilds)
 include(UseOnlyNeeded)
 include(UseOpenMP)
+include(UseNativeProfiler)
 include(UseOptimization)
 include(UseRunPath)
 include(UseValgrind)
@@ -36,6 +37,9 @@ function(opm_add_target_options)
   # Tracy profiler
   use_tracy(TARGET ${PARAM_TARGET})
 
+  # Built-in profiler
+  use_native_profiler(TARGET ${PARAM_TARGET})
+
   # Valgrind memory error checker
   use_valgrind(TARGET ${PARAM_TARGET})
 
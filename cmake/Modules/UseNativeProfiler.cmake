@@ -0,0 +1,13 @@
+option(USE_NATIVE_PROFILER "Enable built-in profiling of OPM_TIMEBLOCK scopes" OFF)
+
+function(use_native_profiler)
+  cmake_parse_arguments(PARAM "" "TARGET" "" ${ARGN})
+  if(NOT PARAM_TARGET)
+    message(FATAL_ERROR "Function needs a TARGET parameter")
+  endif()
+
+  # Tracy takes precedence if both are requested
+  if(USE_NATIVE_PROFILER AND NOT TARGET Tracy::TracyClient)
+    target_compile_definitions(${PARAM_TARGET} PUBLIC USE_NATIVE_PROFILER=1)
+  endif()
+endfunction()
@@ -0,0 +1,182 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <getopt.h>
+
+#include <fmt/format.h>
+
+#include <opm/common/utility/CSRGraphFromCoordinates.hpp>
+
+// Measure CSR graph compression on the connections of a Cartesian grid,
+// both at the cell level and aggregated to inter-region connections as in
+// InterRegFlowMap.  Set OMP_NUM_THREADS=1 to measure the serial path.
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMeasure CSR graph compression throughput.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-x Number of cells in X direction, default 200.\n"
+              << "-y Number of cells in Y direction, default 200.\n"
+              << "-z Number of cells in Z direction, default 100.\n"
+              << "-g Number of regions, default 100.\n"
+              << "-r Number of repetitions, default 5.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+using Connections = std::vector<std::pair<int, int>>;
+
+// Both directions of each face connection in the grid.
+Connections gridConnections(const int nx, const int ny, const int nz)
+{
+    auto conns = Connections{};
+    conns.reserve(6 * static_cast<std::size_t>(nx) * ny * nz);
+
+    auto cell = [nx, ny](const int i, const int j, const int k)
+    { return i + nx*(j + ny*k); };
+
+    for (auto k = 0; k < nz; ++k) {
+        for (auto j = 0; j < ny; ++j) {
+            for (auto i = 0; i < nx; ++i) {
+                const auto c = cell(i, j, k);
+
+                if (i + 1 < nx) {
+                    conns.emplace_back(c, cell(i + 1, j, k));
+                    conns.emplace_back(cell(i + 1, j, k), c);
+                }
+
+                if (j + 1 < ny) {
+                    conns.emplace_back(c, cell(i, j + 1, k));
+                    conns.emplace_back(cell(i, j + 1, k), c);
+                }
+
+                if (k + 1 < nz) {
+                    conns.emplace_back(c, cell(i, j, k + 1));
+                    conns.emplace_back(cell(i, j, k + 1), c);
+                }
+            }
+        }
+    }
+
+    return conns;
+}
+
+template <class Graph>
+void measure(const std::string& name,
+             const Connections& conns,
+             const int          numVertices,
+             const int          repeat,
+             Graph&             graph)
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto elapsed = 0.0;
+    for (auto r = 0; r < repeat; ++r) {
+        graph.clear();
+        for (const auto& [v1, v2] : conns) {
+            graph.addConnection(v1, v2);
+        }
+
+        const auto start = Clock::now();
+        graph.compress(numVertices);
+        elapsed += std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    std::cout << fmt::format("{:<16} {:10} connections {:10} edges {:8.3f} s  {:8.1f} Mconn/s\n",
+                             name, conns.size(), graph.numEdges(), elapsed,
+                             (elapsed > 0.0) ? conns.size() * repeat / elapsed / 1.0e6 : 0.0);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    int nx = 200;
+    int ny = 200;
+    int nz = 100;
+    int numRegions = 100;
+    int repeat = 5;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "x:y:z:g:r:h")) != -1) {
+        switch (c) {
+        case 'x':
+            nx = std::stoi(optarg);
+            break;
+        case 'y':
+            ny = std::stoi(optarg);
+            break;
+        case 'z':
+            nz = std::stoi(optarg);
+            break;
+        case 'g':
+            numRegions = std::stoi(optarg);
+            break;
+        case 'r':
+            repeat = std::stoi(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto numCells = nx * ny * nz;
+    const auto conns = gridConnections(nx, ny, nz);
+
+    std::cout << fmt::format("{}x{}x{} grid, {} regions, {} repetitions\n\n",
+                             nx, ny, nz, numRegions, repeat);
+
+    {
+        auto graph = Opm::utility::CSRGraphFromCoordinates<>{};
+        measure("cells", conns, numCells, repeat, graph);
+    }
+
+    {
+        auto graph = Opm::utility::CSRGraphFromCoordinates<int, true>{};
+        measure("cells, tracked", conns, numCells, repeat, graph);
+    }
+
+    // Layered regions, as in a typical FIPNUM, aggregated into
+    // inter-region connections with many repeated vertex pairs.
+    auto regConns = Connections{};
+    regConns.reserve(conns.size());
+    for (const auto& [c1, c2] : conns) {
+        const auto r1 = static_cast<int>(static_cast<long>(c1) * numRegions / numCells);
+        const auto r2 = static_cast<int>(static_cast<long>(c2) * numRegions / numCells);
+
+        regConns.emplace_back(r1, r2);
+    }
+
+    {
+        auto graph = Opm::utility::CSRGraphFromCoordinates<int, true>{};
+        measure("regions, tracked", regConns, numRegions, repeat, graph);
+    }
+}
@@ -0,0 +1,154 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+#include <fmt/format.h>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+
+// Write and read back binary arrays of each numeric type and report the
+// throughput of EclOutput and EclFile.
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMeasure write and read throughput of binary INTE, REAL, DOUB and LOGI arrays.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-n Number of elements per array, default 10000000.\n"
+              << "-r Number of repetitions, default 5.\n"
+              << "-d Directory for the temporary file, default current directory.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+template <typename T>
+std::vector<T> makeData(const std::size_t n)
+{
+    std::vector<T> data(n);
+    for (auto i = 0*n; i < n; ++i) {
+        if constexpr (std::is_same_v<T, bool>) {
+            data[i] = (i % 3) == 0;
+        }
+        else {
+            data[i] = static_cast<T>(i % 104729) * static_cast<T>(1.25);
+        }
+    }
+
+    return data;
+}
+
+template <typename T>
+void measure(const std::string& typeName,
+             const std::filesystem::path& fname,
+             const std::size_t n,
+             const int repeat)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto data = makeData<T>(n);
+    const auto bytes = static_cast<double>(n) * ((sizeof(T) == 8) ? 8 : 4);
+
+    double writeTime = 0.0;
+    double readTime = 0.0;
+
+    for (int r = 0; r < repeat; ++r) {
+        {
+            const auto start = Clock::now();
+
+            Opm::EclIO::EclOutput output { fname.string(), false };
+            output.write("ARRAY", data);
+            output.flushStream();
+
+            writeTime += std::chrono::duration<double>(Clock::now() - start).count();
+        }
+
+        {
+            const auto start = Clock::now();
+
+            Opm::EclIO::EclFile input { fname.string() };
+            const auto& values = input.get<T>("ARRAY");
+
+            readTime += std::chrono::duration<double>(Clock::now() - start).count();
+
+            if (values != data) {
+                std::cerr << "Data mismatch for type " << typeName << '\n';
+                std::exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    const auto mbs = [bytes, repeat](const double t)
+    { return (t > 0.0) ? repeat * bytes / t / (1024.0 * 1024.0) : 0.0; };
+
+    std::cout << fmt::format("{}  write {:10.1f} MB/s   read {:10.1f} MB/s\n",
+                             typeName, mbs(writeTime), mbs(readTime));
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t n = 10'000'000;
+    int repeat = 5;
+    std::filesystem::path dir = std::filesystem::current_path();
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "n:r:d:h")) != -1) {
+        switch (c) {
+        case 'n':
+            n = std::stoul(optarg);
+            break;
+        case 'r':
+            repeat = std::stoi(optarg);
+            break;
+        case 'd':
+            dir = optarg;
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto fname = dir / "ECLIO_THROUGHPUT.INIT";
+
+    std::cout << fmt::format("{} elements per array, {} repetitions\n", n, repeat);
+
+    measure<int>("INTE", fname, n, repeat);
+    measure<float>("REAL", fname, n, repeat);
+    measure<double>("DOUB", fname, n, repeat);
+    measure<bool>("LOGI", fname, n, repeat);
+
+    std::filesystem::remove(fname);
+
+    return EXIT_SUCCESS;
+}
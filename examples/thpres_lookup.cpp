@@ -0,0 +1,195 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <getopt.h>
+
+#include <fmt/format.h>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/EclipseState/Runspec.hpp>
+#include <opm/input/eclipse/EclipseState/SimulationConfig/ThresholdPressure.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+// Measure region pair threshold pressure lookup for a list of faces, one
+// query per face, and compare with a plain std::map lookup.
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMeasure THPRES region pair lookup throughput.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-r Number of equilibration regions, default 500.\n"
+              << "-f Number of faces, default 10000000.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+// One cell per region, and a barrier between every pair of regions whose
+// IDs differ by at most three.
+std::string makeDeck(const int regions)
+{
+    auto deck = fmt::format(R"(
+RUNSPEC
+DIMENS
+{0} 1 1 /
+EQLDIMS
+{0} /
+EQLOPTS
+THPRES /
+REGIONS
+EQLNUM
+)", regions);
+
+    for (int r = 1; r <= regions; ++r) {
+        deck += fmt::format("{} ", r);
+    }
+    deck += "/\nSOLUTION\nTHPRES\n";
+
+    for (int r1 = 1; r1 <= regions; ++r1) {
+        for (int r2 = r1 + 1; r2 <= std::min(r1 + 3, regions); ++r2) {
+            deck += fmt::format("{} {} {} /\n", r1, r2, 0.1 * (r1 + r2));
+        }
+    }
+
+    return deck + "/\n";
+}
+
+template <typename Lookup>
+double measure(const std::string& name, const std::size_t faces, Lookup&& lookup)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto start = Clock::now();
+    const auto checksum = lookup();
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::cout << fmt::format("{:<20} {:8.3f} s  {:10.1f} Mfaces/s  (checksum {:.6e})\n",
+                             name, elapsed,
+                             (elapsed > 0.0) ? faces / elapsed / 1.0e6 : 0.0,
+                             checksum);
+
+    return checksum;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    int regions = 500;
+    std::size_t faces = 10'000'000;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "r:f:h")) != -1) {
+        switch (c) {
+        case 'r':
+            regions = std::stoi(optarg);
+            break;
+        case 'f':
+            faces = std::stoul(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto deck = Opm::Parser{}.parseString(makeDeck(regions));
+    const auto tables = Opm::TableManager { deck };
+    auto grid = Opm::EclipseGrid { static_cast<std::size_t>(regions), 1, 1 };
+    const auto fp = Opm::FieldPropsManager {
+        deck, Opm::Phases { true, true, true }, grid, tables
+    };
+
+    const auto thpres = Opm::ThresholdPressure { false, deck, fp };
+
+    // Faces mostly connect neighbouring regions, as in a real model.
+    auto rng = std::mt19937 { 1234 };
+    auto region = std::uniform_int_distribution<int> { 1, regions };
+    auto offset = std::uniform_int_distribution<int> { -4, 4 };
+
+    auto region1 = std::vector<int>(faces);
+    auto region2 = std::vector<int>(faces);
+    for (auto f = 0*faces; f < faces; ++f) {
+        region1[f] = region(rng);
+        region2[f] = std::clamp(region1[f] + offset(rng), 1, regions);
+    }
+
+    // The representation used before the dense lookup table.
+    auto table = std::map<std::pair<int,int>, std::pair<bool,double>>{};
+    for (int r1 = 1; r1 <= regions; ++r1) {
+        for (int r2 = r1 + 1; r2 <= std::min(r1 + 3, regions); ++r2) {
+            table.emplace(std::pair { r1, r2 },
+                          std::pair { true, thpres.getThresholdPressure(r1, r2) });
+        }
+    }
+
+    std::cout << fmt::format("{} regions, {} barriers, {} faces\n",
+                             regions, thpres.size(), faces);
+
+    measure("std::map", faces, [&]()
+    {
+        auto sum = 0.0;
+        for (auto f = 0*faces; f < faces; ++f) {
+            const auto key = std::pair { std::min(region1[f], region2[f]),
+                                         std::max(region1[f], region2[f]) };
+            const auto pos = table.find(key);
+            sum += (pos == table.end()) ? 0.0 : pos->second.second;
+        }
+        return sum;
+    });
+
+    measure("per face", faces, [&]()
+    {
+        auto sum = 0.0;
+        for (auto f = 0*faces; f < faces; ++f) {
+            sum += thpres.getThresholdPressure(region1[f], region2[f]);
+        }
+        return sum;
+    });
+
+    measure("batch", faces, [&]()
+    {
+        auto values = std::vector<double>(faces);
+        thpres.getThresholdPressures(region1, region2, values);
+
+        auto sum = 0.0;
+        for (const auto& v : values) {
+            sum += v;
+        }
+        return sum;
+    });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,136 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+#include <fmt/format.h>
+
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+// Measure conversion of cell arrays from SI to output units in single
+// precision, as done when writing INIT and restart files.
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMeasure bulk unit conversion throughput.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-n Number of array elements, default 10000000.\n"
+              << "-r Number of repetitions, default 10.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+template <typename Convert>
+void measure(const std::string& name,
+             const std::size_t  n,
+             const int          repeat,
+             Convert&&          convert)
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto checksum = 0.0;
+    const auto start = Clock::now();
+    for (auto r = 0; r < repeat; ++r) {
+        const auto y = convert();
+        checksum += std::accumulate(y.begin(), y.end(), 0.0);
+    }
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::cout << fmt::format("{:<24} {:8.3f} s  {:10.1f} Melem/s  (checksum {:.6e})\n",
+                             name, elapsed,
+                             (elapsed > 0.0) ? n * repeat / elapsed / 1.0e6 : 0.0,
+                             checksum);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t n = 10'000'000;
+    int repeat = 10;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "n:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            n = std::stoul(optarg);
+            break;
+        case 'r':
+            repeat = std::stoi(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto units = Opm::UnitSystem::newFIELD();
+
+    auto rng = std::mt19937 { 1234 };
+    auto value = std::uniform_real_distribution<double> { 250.0, 400.0 };
+
+    auto si = std::vector<double>(n);
+    for (auto& x : si) {
+        x = value(rng);
+    }
+
+    std::cout << fmt::format("{} elements, {} repetitions\n", n, repeat);
+
+    using M = Opm::UnitSystem::measure;
+    for (const auto m : { M::pressure, M::temperature }) {
+        std::cout << '\n' << units.name(m) << '\n';
+
+        // Per element conversion followed by a separate narrowing pass,
+        // as done by the output code before the bulk kernels.
+        measure("per element + narrow", n, repeat, [&]()
+        {
+            auto y = si;
+            for (auto& x : y) {
+                x = units.from_si(m, x);
+            }
+            return std::vector<float>(y.begin(), y.end());
+        });
+
+        measure("in place + narrow", n, repeat, [&]()
+        {
+            auto y = si;
+            units.from_si(m, y);
+            return std::vector<float>(y.begin(), y.end());
+        });
+
+        measure("fused", n, repeat, [&]()
+        {
+            return units.from_si_float(m, si);
+        });
+    }
+
+    return EXIT_SUCCESS;
+}
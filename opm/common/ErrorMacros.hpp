@@ -61,6 +61,7 @@
                            std::to_string(__LINE__) + "] " +   \
                            message;                            \
         ::Opm::OpmLog::error(oss_);                            \
+        ::Opm::OpmLog::flush();                                \
         throw Exception(oss_);                                 \
     } while (false)
 
@@ -79,6 +80,7 @@
                            std::to_string(__LINE__) + "] " +   \
                            message;                            \
         ::Opm::OpmLog::problem(oss_);                            \
+        ::Opm::OpmLog::flush();                                \
         throw Exception(oss_);                                 \
     } while (false)
 
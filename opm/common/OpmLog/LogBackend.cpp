@@ -55,6 +55,13 @@ namespace Opm {
         }
     }
 
+    bool LogBackend::isMessageIncluded(std::int64_t messageFlag, const std::string& messageTag) const
+    {
+        const bool included = ((messageFlag & m_mask) == messageFlag) && (messageFlag > 0);
+
+        return included && !(m_limiter && m_limiter->isOverTagLimit(messageTag));
+    }
+
     std::int64_t LogBackend::getMask() const
     {
         return m_mask;
@@ -56,6 +56,14 @@ namespace Opm
                               const std::string& messageTag,
                               const std::string& message);
 
+        /// Whether or not a message would be accepted by this backend.
+        ///
+        /// Checks the message mask and whether or not the message tag has
+        /// already exceeded its limit, but does not update any message
+        /// counts.
+        bool isMessageIncluded(std::int64_t messageFlag,
+                               const std::string& messageTag) const;
+
         /// The message mask types are specified in the
         /// Opm::Log::MessageType namespace, in file LogUtils.hpp.
         std::int64_t getMask() const;
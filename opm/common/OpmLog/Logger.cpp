@@ -24,12 +24,149 @@
 #include <opm/common/OpmLog/LogBackend.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <iostream>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
 
 namespace Opm {
 
+    /// Multi-producer, single-consumer message queue drained by a
+    /// background thread.
+    ///
+    /// Producers append nodes with a single atomic exchange (intrusive
+    /// Vyukov queue) and never block.  The consumer thread hands each
+    /// message to Logger::dispatch() in the order in which they were
+    /// enqueued.
+    class Logger::AsyncQueue
+    {
+    public:
+        explicit AsyncQueue(const Logger& logger)
+            : logger_ { logger }
+            , head_   { &stub_ }
+            , tail_   { &stub_ }
+            , thread_ { [this]() { this->run(); } }
+        {}
+
+        ~AsyncQueue()
+        {
+            this->stop_.store(true);
+            this->wakeConsumer();
+            this->thread_.join();
+
+            // All nodes, except the current tail, have been released by
+            // the consumer.
+            if (this->tail_ != &this->stub_) {
+                delete this->tail_;
+            }
+        }
+
+        void push(const std::int64_t messageType,
+                  const std::string& tag,
+                  const std::string& message)
+        {
+            auto* node = new Node { messageType, tag, message };
+
+            auto* prev = this->head_.exchange(node, std::memory_order_acq_rel);
+            prev->next.store(node, std::memory_order_release);
+
+            this->enqueued_.fetch_add(1, std::memory_order_release);
+            this->wakeConsumer();
+        }
+
+        void flush() const
+        {
+            if (std::this_thread::get_id() == this->thread_.get_id()) {
+                // Called from a backend.  Waiting would never finish.
+                return;
+            }
+
+            const auto target = this->enqueued_.load(std::memory_order_acquire);
+
+            auto processed = this->processed_.load(std::memory_order_acquire);
+            while (processed < target) {
+                this->processed_.wait(processed);
+                processed = this->processed_.load(std::memory_order_acquire);
+            }
+        }
+
+    private:
+        struct Node
+        {
+            std::int64_t messageType{};
+            std::string tag{};
+            std::string message{};
+            std::atomic<Node*> next{nullptr};
+        };
+
+        const Logger& logger_;
+
+        Node stub_{};
+        std::atomic<Node*> head_;
+        Node* tail_;
+
+        std::atomic<std::uint64_t> enqueued_{0};
+        std::atomic<std::uint64_t> processed_{0};
+        std::atomic<std::uint64_t> epoch_{0};
+        std::atomic<bool> stop_{false};
+
+        std::thread thread_;
+
+        void wakeConsumer()
+        {
+            this->epoch_.fetch_add(1, std::memory_order_release);
+            this->epoch_.notify_one();
+        }
+
+        bool processOne()
+        {
+            auto* next = this->tail_->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                return false;
+            }
+
+            try {
+                this->logger_.dispatch(next->messageType, next->tag, next->message);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Failed to dispatch log message: " << e.what() << '\n';
+            }
+
+            if (this->tail_ != &this->stub_) {
+                delete this->tail_;
+            }
+
+            this->tail_ = next;
+
+            this->processed_.fetch_add(1, std::memory_order_release);
+            this->processed_.notify_all();
+
+            return true;
+        }
+
+        void run()
+        {
+            while (true) {
+                const auto epoch = this->epoch_.load(std::memory_order_acquire);
+
+                while (this->processOne()) {}
+
+                if (this->stop_.load() &&
+                    (this->processed_.load() == this->enqueued_.load()))
+                {
+                    break;
+                }
+
+                this->epoch_.wait(epoch);
+            }
+        }
+    };
+
     Logger::Logger()
         : m_globalMask(0),
           m_enabledTypes(0)
@@ -43,15 +180,65 @@ namespace Opm {
         addMessageType( Log::MessageType::Note , "note");
     }
 
+    Logger::~Logger()
+    {
+        // Deliver all pending messages.
+        this->m_queue.reset();
+    }
+
     void Logger::addTaggedMessage(std::int64_t messageType, const std::string& tag, const std::string& message) const {
         if ((m_enabledTypes & messageType) == 0)
             throw std::invalid_argument("Tried to issue message with unrecognized message ID");
 
         if (m_globalMask & messageType) {
-            for (auto iter : m_backends) {
-                LogBackend& backend = *(iter.second);
-                backend.addTaggedMessage( messageType, tag, message );
+            if (this->m_queue != nullptr) {
+                this->m_queue->push(messageType, tag, message);
             }
+            else {
+                this->dispatch(messageType, tag, message);
+            }
+        }
+    }
+
+    void Logger::dispatch(std::int64_t messageType, const std::string& tag, const std::string& message) const {
+        std::lock_guard<std::recursive_mutex> lock { m_backendMutex };
+
+        for (auto iter : m_backends) {
+            LogBackend& backend = *(iter.second);
+            backend.addTaggedMessage( messageType, tag, message );
+        }
+    }
+
+    bool Logger::isMessageIncluded(std::int64_t messageType, const std::string& tag) const {
+        if (((m_enabledTypes & messageType) == 0) || ((m_globalMask & messageType) == 0))
+            return false;
+
+        std::lock_guard<std::recursive_mutex> lock { m_backendMutex };
+
+        for (const auto& iter : m_backends) {
+            if (iter.second->isMessageIncluded(messageType, tag))
+                return true;
+        }
+
+        return false;
+    }
+
+    void Logger::setAsynchronous(const bool async) {
+        if (async && (this->m_queue == nullptr)) {
+            this->m_queue = std::make_unique<AsyncQueue>(*this);
+        }
+        else if (!async) {
+            this->m_queue.reset();
+        }
+    }
+
+    bool Logger::isAsynchronous() const {
+        return this->m_queue != nullptr;
+    }
+
+    void Logger::flush() const {
+        if (this->m_queue != nullptr) {
+            this->m_queue->flush();
         }
     }
 
@@ -64,6 +251,7 @@ namespace Opm {
     }
 
     bool Logger::hasBackend(const std::string& name) {
+        std::lock_guard<std::recursive_mutex> lock { m_backendMutex };
         if (m_backends.find( name ) == m_backends.end())
             return false;
         else
@@ -71,11 +259,15 @@ namespace Opm {
     }
 
     void Logger::removeAllBackends() {
+        this->flush();
+        std::lock_guard<std::recursive_mutex> lock { m_backendMutex };
         m_backends.clear();
         m_globalMask = 0;
     }
 
     bool Logger::removeBackend(const std::string& name) {
+        this->flush();
+        std::lock_guard<std::recursive_mutex> lock { m_backendMutex };
         std::size_t eraseCount = m_backends.erase( name );
         if (eraseCount == 1)
             return true;
@@ -84,6 +276,9 @@ namespace Opm {
     }
 
     void Logger::addBackend(const std::string& name , std::shared_ptr<LogBackend> backend) {
+        // Messages issued before this call must not reach the new backend.
+        this->flush();
+        std::lock_guard<std::recursive_mutex> lock { m_backendMutex };
         updateGlobalMask( backend->getMask() );
         m_backends[ name ] = backend;
     }
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 
@@ -34,9 +35,35 @@ class Logger {
 
 public:
     Logger();
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
     void addMessage(std::int64_t messageType , const std::string& message) const;
     void addTaggedMessage(std::int64_t messageType, const std::string& tag, const std::string& message) const;
 
+    /// Whether or not a message of the given type and tag would be
+    /// emitted by at least one backend.
+    ///
+    /// Does not update any message counts.  Intended for skipping the
+    /// construction of messages that would be discarded anyway.
+    bool isMessageIncluded(std::int64_t messageType, const std::string& tag) const;
+
+    /// Switch between synchronous and asynchronous message dispatch.
+    ///
+    /// In asynchronous mode, messages are placed in a lock-free queue and
+    /// handed to the backends, in order, by a background thread.
+    /// Switching back to synchronous mode delivers all pending messages.
+    void setAsynchronous(bool async);
+
+    /// Whether or not messages are dispatched asynchronously.
+    bool isAsynchronous() const;
+
+    /// Wait until all messages issued so far have been handed to the
+    /// backends.  No-op in synchronous mode.
+    void flush() const;
+
     static bool enabledDefaultMessageType( std::int64_t messageType);
     bool enabledMessageType( std::int64_t messageType) const;
     void addMessageType( std::int64_t messageType , const std::string& prefix);
@@ -49,6 +76,8 @@ public:
 
     template <class BackendType>
     std::shared_ptr<BackendType> getBackend(const std::string& name) const {
+        this->flush();
+        std::lock_guard<std::recursive_mutex> lock { m_backendMutex };
         auto pair = m_backends.find( name );
         if (pair == m_backends.end())
             throw std::invalid_argument("Invalid backend name: " + name);
@@ -58,6 +87,8 @@ public:
 
     template <class BackendType>
     std::shared_ptr<BackendType> popBackend(const std::string& name)  {
+        this->flush();
+        std::lock_guard<std::recursive_mutex> lock { m_backendMutex };
         auto pair = m_backends.find( name );
         if (pair == m_backends.end())
             throw std::invalid_argument("Invalid backend name: " + name);
@@ -70,12 +101,22 @@ public:
 
 
 private:
+    class AsyncQueue;
+
     void updateGlobalMask( std::int64_t mask );
     static bool enabledMessageType( std::int64_t enabledTypes , std::int64_t messageType);
+    void dispatch(std::int64_t messageType, const std::string& tag, const std::string& message) const;
 
     std::int64_t m_globalMask;
     std::int64_t m_enabledTypes;
     std::map<std::string , std::shared_ptr<LogBackend> > m_backends;
+
+    // Serialises access to the backends.  Recursive since a backend may
+    // itself issue messages in synchronous mode.
+    mutable std::recursive_mutex m_backendMutex{};
+
+    // Non-null in asynchronous mode.
+    std::unique_ptr<AsyncQueue> m_queue{};
 };
 
 }
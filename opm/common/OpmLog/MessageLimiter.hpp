@@ -118,6 +118,28 @@ namespace Opm
             return res;
         }
 
+        /// Whether or not all further messages with this tag will be
+        /// suppressed.
+        ///
+        /// Does not update any message counts.
+        ///
+        /// \param[in] tag Message tag.
+        ///
+        /// \return Whether or not the tag count has already passed the
+        /// tag limit, meaning handleMessageLimits() would respond
+        /// OverTagLimit.
+        bool isOverTagLimit(const std::string& tag) const
+        {
+            if (tag.empty() || (this->tag_limit_ == NoLimit)) {
+                return false;
+            }
+
+            const auto countPos = this->tag_counts_.find(tag);
+
+            return (countPos != this->tag_counts_.end())
+                && (countPos->second > this->tag_limit_);
+        }
+
         /// Retrieve message count for specific category.
         ///
         /// Mostly provided for unit testing.
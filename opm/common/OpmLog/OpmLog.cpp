@@ -157,6 +157,20 @@ namespace Opm {
         addTaggedMessage(Log::MessageType::Note, tag, message);
     }
 
+    bool OpmLog::isMessageIncluded(std::int64_t messageType, const std::string& tag) {
+        return m_logger && m_logger->isMessageIncluded( messageType, tag );
+    }
+
+    void OpmLog::setAsynchronous(const bool async) {
+        auto logger = OpmLog::getLogger();
+        logger->setAsynchronous( async );
+    }
+
+    void OpmLog::flush() {
+        if (m_logger)
+            m_logger->flush();
+    }
+
     bool OpmLog::enabledMessageType( std::int64_t messageType ) {
         if (m_logger)
             return m_logger->enabledMessageType( messageType );
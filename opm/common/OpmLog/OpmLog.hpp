@@ -25,6 +25,10 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
 
 namespace Opm {
 
@@ -62,6 +66,58 @@ public:
     static void debug(const std::string& tag, const std::string& message);
     static void note(const std::string& tag, const std::string& message);
 
+    /// Whether or not a message of the given type and tag would be
+    /// emitted by at least one backend.
+    ///
+    /// Checks the message type and the backends' message masks and tag
+    /// limits without counting the message.
+    static bool isMessageIncluded(std::int64_t messageType, const std::string& tag = "");
+
+    /// Issue a tagged message, formatting it only if it would be emitted.
+    ///
+    /// \code
+    ///   OpmLog::log(Log::MessageType::Warning, "WellControl",
+    ///               "Well {} switched to {}", wname, mode);
+    /// \endcode
+    template <typename... Args>
+    static void log(const std::int64_t messageType,
+                    const std::string& tag,
+                    fmt::format_string<Args...> format,
+                    Args&&... args)
+    {
+        if (isMessageIncluded(messageType, tag)) {
+            addTaggedMessage(messageType, tag, fmt::format(format, std::forward<Args>(args)...));
+        }
+    }
+
+    /// Issue a tagged debug message, formatting it only if it would be
+    /// emitted at the current debug verbosity level.
+    template <typename... Args>
+    static void logDebug(const int verbosity_level,
+                         const std::string& tag,
+                         fmt::format_string<Args...> format,
+                         Args&&... args)
+    {
+        if ((debug_verbosity_level_ >= verbosity_level) &&
+            isMessageIncluded(Log::MessageType::Debug, tag))
+        {
+            addTaggedMessage(Log::MessageType::Debug, tag,
+                             fmt::format(format, std::forward<Args>(args)...));
+        }
+    }
+
+    /// Hand messages to the backends on a background thread.
+    ///
+    /// Messages may then be issued concurrently from multiple threads
+    /// without blocking on backend output.  Pending messages are always
+    /// delivered before the backends are changed, before flush()
+    /// returns, when switching back to synchronous mode, and at program
+    /// exit.  Not to be called concurrently with other logging calls.
+    static void setAsynchronous(bool async);
+
+    /// Wait until all messages issued so far have reached the backends.
+    static void flush();
+
     static bool hasBackend( const std::string& backendName );
     static void addBackend(const std::string& name , std::shared_ptr<LogBackend> backend);
     static bool removeBackend(const std::string& name);
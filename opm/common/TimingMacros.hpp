@@ -65,6 +65,14 @@ enum Bitfield : std::uint8_t
 #define OPM_TIMEBLOCK_LOCAL(blockname, subsys) ZoneNamedN(blockname, #blockname, DETAILED_PROFILING_SUBSYSTEMS & subsys)
 #define OPM_TIMEFUNCTION_LOCAL(subsys) ZoneNamedN(myname, __func__, DETAILED_PROFILING_SUBSYSTEMS & subsys)
 #endif
+#elif USE_NATIVE_PROFILER && !defined(__CUDACC__) && !defined(__HIPCC__)
+#include <opm/common/utility/Profiler.hpp>
+#define OPM_TIMEBLOCK(blockname) ::Opm::Profiler::Scope blockname{#blockname, ::Opm::Subsystem::AnySystem}
+#define OPM_TIMEFUNCTION() ::Opm::Profiler::Scope myname{__func__, ::Opm::Subsystem::AnySystem}
+#if DETAILED_PROFILING
+#define OPM_TIMEBLOCK_LOCAL(blockname, subsys) ::Opm::Profiler::Scope blockname{#blockname, static_cast<std::uint8_t>(DETAILED_PROFILING_SUBSYSTEMS & subsys)}
+#define OPM_TIMEFUNCTION_LOCAL(subsys) ::Opm::Profiler::Scope myname{__func__, static_cast<std::uint8_t>(DETAILED_PROFILING_SUBSYSTEMS & subsys)}
+#endif
 #endif
 
 #ifndef OPM_TIMEBLOCK
@@ -463,6 +463,59 @@ namespace Opm { namespace utility {
             /// the input coordinate format.
             void condenseDuplicates();
 
+            // ---------------------------------------------------------
+            // Multithreaded implementation of merge()
+            // ---------------------------------------------------------
+
+            /// Minimum number of non-zero elements, including repeated
+            /// elements, for which to use the multithreaded assembly.
+            static constexpr Offset parallelThreshold = 100'000;
+
+            /// Maximum number of row blocks in multithreaded assembly.
+            static constexpr Offset maxNumRowBlocks = 1024;
+
+            /// Maximum number of input chunks in multithreaded assembly.
+            static constexpr Offset maxNumChunks = 256;
+
+            /// Whether or not to use the multithreaded assembly.
+            ///
+            /// \param[in] nnz Number of non-zero elements, including
+            ///    repeated elements.
+            static bool useParallelAssembly(Offset nnz);
+
+            /// Multithreaded equivalent of preparePushbackRowGrouping()
+            /// followed by groupAndTrackColumnIndicesByRow().
+            ///
+            /// Stable counting sort in two levels.  Elements are first
+            /// distributed to blocks of consecutive rows from contiguous
+            /// chunks of the input, and then each row block is grouped by
+            /// row independently of the other blocks.  Neither level
+            /// depends on the number of threads, so the result is identical
+            /// to that of the serial grouping.
+            ///
+            /// \param[in] numRows Number of rows in final compressed
+            ///    structure.
+            ///
+            /// \param[in] rowIdx Row indices of all, possibly repeated,
+            ///    coordinate format input contributions.
+            ///
+            /// \param[in] colIdx Column index of coordinate format input
+            ///    structure.
+            void groupAndTrackColumnIndicesByRowParallel(const int         numRows,
+                                                         const Neighbours& rowIdx,
+                                                         const Neighbours& colIdx);
+
+            /// Multithreaded equivalent of sortColumnIndicesPerRow()
+            /// followed by condenseDuplicates().
+            ///
+            /// Sorts and condenses the column indices of each row in place,
+            /// then compacts the rows into their final locations.  Rows
+            /// whose column index range does not exceed their length are
+            /// bucketed by column rather than sorted.  Produces
+            /// the same \c ia_, \c ja_ and \c compressedIdx_ as the serial
+            /// implementation.
+            void sortAndCondenseParallel();
+
             // ---------------------------------------------------------
             // Implementation of assemble()
             // ---------------------------------------------------------
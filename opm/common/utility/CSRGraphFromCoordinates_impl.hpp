@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <iterator>
 #include <optional>
@@ -32,6 +33,10 @@
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // ---------------------------------------------------------------------
 // Class Opm::utility::CSRGraphFromCoordinates::Connections
 // ---------------------------------------------------------------------
@@ -363,9 +368,14 @@ CSR::assemble(const Neighbours&  rows,
     const auto thisNumRows = std::max(this->numRows_, maxRowIdx + 1);
     const auto thisNumCols = std::max(this->numCols_, maxColIdx + 1);
 
-    this->preparePushbackRowGrouping(thisNumRows, i);
+    if (useParallelAssembly(i.size())) {
+        this->groupAndTrackColumnIndicesByRowParallel(thisNumRows, i, j);
+    }
+    else {
+        this->preparePushbackRowGrouping(thisNumRows, i);
 
-    this->groupAndTrackColumnIndicesByRow(i, j);
+        this->groupAndTrackColumnIndicesByRow(i, j);
+    }
 
     if constexpr (TrackCompressedIdx) {
         if (expandExistingIdxMap) {
@@ -391,10 +401,15 @@ CSR::compress(const Offset maxNumVertices)
         };
     }
 
-    this->sortColumnIndicesPerRow();
+    if (useParallelAssembly(this->ja_.size())) {
+        this->sortAndCondenseParallel();
+    }
+    else {
+        this->sortColumnIndicesPerRow();
 
-    // Must be called *after* sortColumnIndicesPerRow().
-    this->condenseDuplicates();
+        // Must be called *after* sortColumnIndicesPerRow().
+        this->condenseDuplicates();
+    }
 
     const auto nRows = this->startPointers().size() - 1;
     if (nRows < maxNumVertices) {
@@ -456,6 +471,266 @@ CSR::condenseDuplicates()
     this->ia_.back() = this->ja_.size();
 }
 
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+bool
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::useParallelAssembly([[maybe_unused]] const Offset nnz)
+{
+#ifdef _OPENMP
+    return (nnz > parallelThreshold) && (omp_get_max_threads() > 1);
+#else
+    return false;
+#endif
+}
+
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::groupAndTrackColumnIndicesByRowParallel(const int         numRows,
+                                             const Neighbours& rowIdx,
+                                             const Neighbours& colIdx)
+{
+    assert (numRows > 0);
+
+    const auto nnz = rowIdx.size();
+    const auto nRows = static_cast<Offset>(numRows);
+
+    // Block and chunk partitions depend only on the input sizes.  Row
+    // block 'b' is rows [b*nRows/numBlocks, (b+1)*nRows/numBlocks).
+    const auto numBlocks = std::min(nRows, maxNumRowBlocks);
+    const auto numChunks = std::clamp(nnz / (parallelThreshold / 2), Offset{1}, maxNumChunks);
+
+    auto blockOf = [nRows, numBlocks](const BaseVertexID row)
+    {
+        return ((static_cast<Offset>(row) + 1)*numBlocks - 1) / nRows;
+    };
+
+    auto chunkBegin = [nnz, numChunks](const Offset chunk)
+    {
+        return chunk * nnz / numChunks;
+    };
+
+    // Number of elements per (chunk, row block).
+    auto blockPos = Start(numChunks * numBlocks, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (std::int64_t chunk = 0; chunk < static_cast<std::int64_t>(numChunks); ++chunk) {
+        auto* count = blockPos.data() + chunk*numBlocks;
+
+        for (auto nz = chunkBegin(chunk); nz < chunkBegin(chunk + 1); ++nz) {
+            ++count[blockOf(rowIdx[nz])];
+        }
+    }
+
+    // Block major exclusive prefix sum.  Afterwards, blockPos holds the
+    // insertion point of each chunk's first element in each row block and
+    // blockStart[b] is the start of row block 'b' in ja_.
+    auto blockStart = Start(numBlocks + 1, 0);
+    {
+        auto pos = Offset{0};
+        for (auto block = 0*numBlocks; block < numBlocks; ++block) {
+            blockStart[block] = pos;
+
+            for (auto chunk = 0*numChunks; chunk < numChunks; ++chunk) {
+                const auto n = blockPos[chunk*numBlocks + block];
+                blockPos[chunk*numBlocks + block] = pos;
+                pos += n;
+            }
+        }
+
+        blockStart.back() = pos;
+    }
+
+    // Distribute elements to row blocks, preserving input order within
+    // each block.
+    auto elems = Start(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (std::int64_t chunk = 0; chunk < static_cast<std::int64_t>(numChunks); ++chunk) {
+        auto* pos = blockPos.data() + chunk*numBlocks;
+
+        for (auto nz = chunkBegin(chunk); nz < chunkBegin(chunk + 1); ++nz) {
+            elems[pos[blockOf(rowIdx[nz])]++] = nz;
+        }
+    }
+
+    this->ia_.assign(nRows + 1, 0);
+    this->ja_.resize(nnz);
+
+    if constexpr (TrackCompressedIdx) {
+        this->compressedIdx_.resize(nnz);
+    }
+
+    // Group each row block by row.  Same procedure as the serial grouping,
+    // but restricted to the rows of a single block and offset by the
+    // number of elements in all preceding blocks.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::int64_t block = 0; block < static_cast<std::int64_t>(numBlocks); ++block) {
+        const auto rowBegin = block * nRows / numBlocks;
+        const auto rowEnd = (block + 1) * nRows / numBlocks;
+
+        const auto begin = elems.begin() + blockStart[block];
+        const auto end = elems.begin() + blockStart[block + 1];
+
+        for (auto e = begin; e != end; ++e) {
+            this->ia_[rowIdx[*e] + 1] += 1;
+        }
+
+        // Position "end" pointers at start of each row.
+        auto pos = blockStart[block];
+        for (auto row = rowBegin; row < rowEnd; ++row) {
+            const auto n = this->ia_[row + 1];
+            this->ia_[row + 1] = pos;
+            pos += n;
+        }
+
+        for (auto e = begin; e != end; ++e) {
+            const auto k = this->ia_[rowIdx[*e] + 1] ++;
+
+            this->ja_[k] = colIdx[*e];
+
+            if constexpr (TrackCompressedIdx) {
+                this->compressedIdx_[*e] = k;
+            }
+        }
+    }
+
+    this->ia_[0] = 0;
+}
+
+template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
+void
+Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
+CSR::sortAndCondenseParallel()
+{
+    const auto nRows = this->ia_.size() - 1;
+    const auto numBlocks = std::min(nRows, maxNumRowBlocks);
+
+    // Grouped column indices.  Needed to locate the final position of
+    // each grouped element once the rows have been condensed.
+    [[maybe_unused]] auto groupedColIdx = Neighbours{};
+    if constexpr (TrackCompressedIdx) {
+        groupedColIdx = this->ja_;
+    }
+
+    // Sort and condense each row in place.  Unique column count of row
+    // 'r' stored in ia[r + 1], total per row block in blockStart[b + 1].
+    auto ia = Start(nRows + 1, 0);
+    auto blockStart = Start(numBlocks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::int64_t block = 0; block < static_cast<std::int64_t>(numBlocks); ++block) {
+        const auto rowBegin = block * nRows / numBlocks;
+        const auto rowEnd = (block + 1) * nRows / numBlocks;
+
+        auto present = std::vector<char>{};
+
+        for (auto row = rowBegin; row < rowEnd; ++row) {
+            const auto begin = this->ja_.begin() + this->ia_[row + 0];
+            const auto end = this->ja_.begin() + this->ia_[row + 1];
+
+            const auto [minCol, maxCol] = (begin != end)
+                ? std::minmax_element(begin, end)
+                : std::pair { begin, begin };
+
+            const auto range = (begin != end)
+                ? static_cast<Offset>(*maxCol - *minCol) + 1
+                : Offset{0};
+
+            if (range <= static_cast<Offset>(std::distance(begin, end))) {
+                // Long row with few distinct columns, typically an
+                // inter-region connection.  Bucket by column instead of
+                // sorting.
+                const auto col0 = *minCol;
+
+                present.assign(range, 0);
+                for (auto j = begin; j != end; ++j) {
+                    present[*j - col0] = 1;
+                }
+
+                auto unique = begin;
+                for (auto j = 0*range; j < range; ++j) {
+                    if (present[j]) {
+                        *unique++ = static_cast<BaseVertexID>(col0 + j);
+                    }
+                }
+
+                ia[row + 1] = std::distance(begin, unique);
+            }
+            else {
+                std::sort(begin, end);
+
+                ia[row + 1] = std::distance(begin, std::unique(begin, end));
+            }
+
+            blockStart[block + 1] += ia[row + 1];
+        }
+    }
+
+    for (auto block = 0*numBlocks; block < numBlocks; ++block) {
+        blockStart[block + 1] += blockStart[block];
+    }
+
+    auto ja = Neighbours(blockStart.back());
+
+    [[maybe_unused]] auto finalIdx = Start{};
+    if constexpr (TrackCompressedIdx) {
+        finalIdx.resize(this->ja_.size());
+    }
+
+    // Form final start pointers and move the unique column indices of
+    // each row to their final location.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::int64_t block = 0; block < static_cast<std::int64_t>(numBlocks); ++block) {
+        const auto rowBegin = block * nRows / numBlocks;
+        const auto rowEnd = (block + 1) * nRows / numBlocks;
+
+        auto pos = blockStart[block];
+        for (auto row = rowBegin; row < rowEnd; ++row) {
+            const auto begin = this->ja_.begin() + this->ia_[row];
+            const auto end = begin + ia[row + 1];
+
+            const auto dest = ja.begin() + pos;
+            std::copy(begin, end, dest);
+
+            if constexpr (TrackCompressedIdx) {
+                for (auto k = this->ia_[row + 0]; k < this->ia_[row + 1]; ++k) {
+                    finalIdx[k] = pos +
+                        std::distance(dest, std::lower_bound(dest, dest + ia[row + 1],
+                                                             groupedColIdx[k]));
+                }
+            }
+
+            pos += ia[row + 1];
+            ia[row + 1] = pos;
+        }
+    }
+
+    this->ia_.swap(ia);
+    this->ja_.swap(ja);
+
+    if constexpr (TrackCompressedIdx) {
+        const auto n = this->compressedIdx_.size();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (std::int64_t i = 0; i < static_cast<std::int64_t>(n); ++i) {
+            this->compressedIdx_[i] = finalIdx[this->compressedIdx_[i]];
+        }
+    }
+}
+
 template <typename VertexID, bool TrackCompressedIdx, bool PermitSelfConnections>
 void
 Opm::utility::CSRGraphFromCoordinates<VertexID, TrackCompressedIdx, PermitSelfConnections>::
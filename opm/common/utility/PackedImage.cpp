@@ -0,0 +1,546 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/common/utility/PackedImage.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    // Encoded image layout:
+    //
+    //   Magic (8 bytes), format version (uint32), compression (uint32),
+    //   chunk size, image size and number of chunks (uint64 each), stored
+    //   size of each chunk (uint64 each), followed by the stored chunks.
+    //
+    // A chunk whose stored size equals its size in the image is stored as
+    // is, irrespective of the requested compression.
+
+    constexpr auto magic = std::array<char, 8> { 'O', 'P', 'M', 'P', 'A', 'C', 'K', '\0' };
+    constexpr auto formatVersion = std::uint32_t{1};
+
+    constexpr auto fixedHeaderSize = magic.size() + 2*sizeof(std::uint32_t) + 3*sizeof(std::uint64_t);
+
+    template <typename T>
+    void putValue(std::vector<char>& out, const T value)
+    {
+        const auto* p = reinterpret_cast<const char*>(&value);
+        out.insert(out.end(), p, p + sizeof(T));
+    }
+
+    template <typename T>
+    T getValue(std::span<const char> in, std::size_t& pos)
+    {
+        if (in.size() - pos < sizeof(T)) {
+            throw std::runtime_error { "Truncated packed image header" };
+        }
+
+        T value{};
+        std::memcpy(&value, in.data() + pos, sizeof(T));
+        pos += sizeof(T);
+
+        return value;
+    }
+
+    // -----------------------------------------------------------------------
+    // Fast compression.
+    //
+    // LZ77 byte oriented format of the same structure as LZ4 blocks.  Each
+    // sequence is a token byte holding the literal length in its high
+    // nibble and the match length less four in its low nibble, extended
+    // by bytes of 255 plus a final remainder byte if the nibble is 15.
+    // The token is followed by the literals, a two byte match offset and
+    // the match length extension.  The final sequence has no match.
+
+    constexpr auto minMatch = std::size_t{4};
+    constexpr auto maxOffset = std::size_t{65535};
+    constexpr auto hashBits = 16;
+
+    std::uint32_t read32(const char* p)
+    {
+        std::uint32_t x{};
+        std::memcpy(&x, p, sizeof x);
+        return x;
+    }
+
+    std::uint32_t hash(const std::uint32_t x)
+    {
+        return (x * 2654435761u) >> (32 - hashBits);
+    }
+
+    void putLength(std::vector<char>& out, std::size_t len)
+    {
+        while (len >= 255) {
+            out.push_back(static_cast<char>(255));
+            len -= 255;
+        }
+
+        out.push_back(static_cast<char>(len));
+    }
+
+    void putSequence(std::vector<char>&      out,
+                     std::span<const char>   literals,
+                     const std::size_t       offset,
+                     const std::size_t       matchLen)
+    {
+        const auto litLen = literals.size();
+        const auto matchCode = (matchLen > 0) ? matchLen - minMatch : 0;
+
+        out.push_back(static_cast<char>((std::min(litLen, std::size_t{15}) << 4) |
+                                        std::min(matchCode, std::size_t{15})));
+
+        if (litLen >= 15) {
+            putLength(out, litLen - 15);
+        }
+
+        out.insert(out.end(), literals.begin(), literals.end());
+
+        if (matchLen == 0) {
+            return;
+        }
+
+        out.push_back(static_cast<char>(offset & 0xFF));
+        out.push_back(static_cast<char>(offset >> 8));
+
+        if (matchCode >= 15) {
+            putLength(out, matchCode - 15);
+        }
+    }
+
+    std::vector<char> compressFast(std::span<const char> in)
+    {
+        const auto n = in.size();
+
+        auto out = std::vector<char>{};
+        out.reserve(n + n/255 + 16);
+
+        auto table = std::vector<std::int64_t>(std::size_t{1} << hashBits, -1);
+
+        auto anchor = std::size_t{0};
+        auto i = std::size_t{0};
+
+        while (i + minMatch <= n) {
+            const auto seq = read32(in.data() + i);
+            const auto h = hash(seq);
+            const auto cand = table[h];
+            table[h] = static_cast<std::int64_t>(i);
+
+            if ((cand < 0) ||
+                (i - static_cast<std::size_t>(cand) > maxOffset) ||
+                (read32(in.data() + cand) != seq))
+            {
+                // Skip faster through incompressible data.
+                i += 1 + ((i - anchor) >> 6);
+                continue;
+            }
+
+            const auto match = static_cast<std::size_t>(cand);
+
+            auto len = minMatch;
+            while ((i + len < n) && (in[match + len] == in[i + len])) {
+                ++len;
+            }
+
+            putSequence(out, in.subspan(anchor, i - anchor), i - match, len);
+
+            i += len;
+            anchor = i;
+        }
+
+        putSequence(out, in.subspan(anchor), 0, 0);
+
+        return out;
+    }
+
+    std::size_t getLength(std::span<const char> in, std::size_t& ip)
+    {
+        auto len = std::size_t{0};
+
+        while (true) {
+            if (ip >= in.size()) {
+                throw std::runtime_error { "Truncated compressed chunk" };
+            }
+
+            const auto b = static_cast<unsigned char>(in[ip++]);
+            len += b;
+
+            if (b != 255) {
+                return len;
+            }
+        }
+    }
+
+    void decompressFast(std::span<const char> in, std::span<char> out)
+    {
+        auto ip = std::size_t{0};
+        auto op = std::size_t{0};
+
+        while (true) {
+            if (ip >= in.size()) {
+                throw std::runtime_error { "Truncated compressed chunk" };
+            }
+
+            const auto token = static_cast<unsigned char>(in[ip++]);
+
+            auto litLen = static_cast<std::size_t>(token >> 4);
+            if (litLen == 15) {
+                litLen += getLength(in, ip);
+            }
+
+            if ((in.size() - ip < litLen) || (out.size() - op < litLen)) {
+                throw std::runtime_error { "Corrupt compressed chunk" };
+            }
+
+            std::memcpy(out.data() + op, in.data() + ip, litLen);
+            ip += litLen;
+            op += litLen;
+
+            if (op == out.size()) {
+                // Final sequence.
+                return;
+            }
+
+            if (in.size() - ip < 2) {
+                throw std::runtime_error { "Truncated compressed chunk" };
+            }
+
+            const auto offset =
+                  std::size_t{static_cast<unsigned char>(in[ip + 0])}
+                | (std::size_t{static_cast<unsigned char>(in[ip + 1])} << 8);
+            ip += 2;
+
+            auto matchLen = static_cast<std::size_t>(token & 15);
+            if (matchLen == 15) {
+                matchLen += getLength(in, ip);
+            }
+            matchLen += minMatch;
+
+            if ((offset == 0) || (offset > op) || (out.size() - op < matchLen)) {
+                throw std::runtime_error { "Corrupt compressed chunk" };
+            }
+
+            // Byte by byte since source and destination may overlap.
+            for (auto k = 0*matchLen; k < matchLen; ++k, ++op) {
+                out[op] = out[op - offset];
+            }
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+namespace Serialization {
+
+PackedImage::PackedImage(const std::size_t chunkSize)
+    : chunkSize_ { chunkSize }
+{
+    if ((chunkSize_ == 0) || (chunkSize_ > maxChunkSize)) {
+        throw std::invalid_argument {
+            fmt::format("Packed image chunk size {} outside range 1..{}",
+                        chunkSize_, maxChunkSize)
+        };
+    }
+}
+
+void PackedImage::append(const void* data, std::size_t n)
+{
+    const auto* src = static_cast<const char*>(data);
+
+    while (n > 0) {
+        if (chunks_.empty() || (chunks_.back().size() == chunkSize_)) {
+            chunks_.emplace_back().reserve(chunkSize_);
+        }
+
+        auto& dest = chunks_.back();
+        const auto m = std::min(n, chunkSize_ - dest.size());
+
+        dest.insert(dest.end(), src, src + m);
+
+        src += m;
+        n -= m;
+        size_ += m;
+    }
+}
+
+void PackedImage::read(const std::size_t position, void* data, std::size_t n) const
+{
+    if ((position > size_) || (size_ - position < n)) {
+        throw std::out_of_range {
+            fmt::format("Cannot read {} bytes at position {} "
+                        "of packed image of size {}", n, position, size_)
+        };
+    }
+
+    auto* dest = static_cast<char*>(data);
+    auto chunk = position / chunkSize_;
+    auto offset = position % chunkSize_;
+
+    while (n > 0) {
+        const auto m = std::min(n, chunkSize_ - offset);
+
+        std::memcpy(dest, chunks_[chunk].data() + offset, m);
+
+        dest += m;
+        n -= m;
+        ++chunk;
+        offset = 0;
+    }
+}
+
+void PackedImage::clear()
+{
+    chunks_.clear();
+    size_ = 0;
+}
+
+std::vector<char> PackedImage::encode(const Compression compression) const
+{
+    const auto compressed = this->compressedChunks(compression);
+
+    auto out = this->header(compression, compressed);
+    for (auto chunk = 0*compressed.size(); chunk < compressed.size(); ++chunk) {
+        const auto stored = this->storedChunk(chunk, compressed);
+        out.insert(out.end(), stored.begin(), stored.end());
+    }
+
+    return out;
+}
+
+PackedImage PackedImage::decode(std::span<const char> encoded)
+{
+    if ((encoded.size() < magic.size()) ||
+        ! std::equal(magic.begin(), magic.end(), encoded.begin()))
+    {
+        throw std::runtime_error { "Buffer is not a packed image" };
+    }
+
+    auto pos = magic.size();
+
+    const auto version = getValue<std::uint32_t>(encoded, pos);
+    if (version != formatVersion) {
+        throw std::runtime_error {
+            fmt::format("Unsupported packed image format version {}", version)
+        };
+    }
+
+    const auto compression = static_cast<Compression>(getValue<std::uint32_t>(encoded, pos));
+    if ((compression != Compression::None) && (compression != Compression::Fast)) {
+        throw std::runtime_error { "Unsupported packed image compression" };
+    }
+
+    const auto chunkSize = getValue<std::uint64_t>(encoded, pos);
+    const auto size = getValue<std::uint64_t>(encoded, pos);
+    const auto numChunks = getValue<std::uint64_t>(encoded, pos);
+
+    // Validate header before allocating anything based on its contents.
+    if ((chunkSize == 0) || (chunkSize > maxChunkSize) ||
+        (numChunks != size/chunkSize + ((size % chunkSize) != 0)))
+    {
+        throw std::runtime_error { "Inconsistent packed image header" };
+    }
+
+    if (numChunks > (encoded.size() - pos) / sizeof(std::uint64_t)) {
+        throw std::runtime_error { "Truncated packed image header" };
+    }
+
+    // Location of each stored chunk in the encoded buffer.
+    auto start = std::vector<std::size_t>(numChunks + 1);
+    start[0] = pos + numChunks*sizeof(std::uint64_t);
+    for (auto chunk = 0*numChunks; chunk < numChunks; ++chunk) {
+        const auto stored = getValue<std::uint64_t>(encoded, pos);
+        const auto rawSize = std::min(chunkSize, size - chunk*chunkSize);
+
+        // Stored chunks are at most the raw size, and the compression
+        // expands each input byte into at most 255 output bytes.
+        if ((stored > encoded.size() - start[chunk]) ||
+            (stored > rawSize) || (rawSize / 255 > stored))
+        {
+            throw std::runtime_error { "Packed image size does not match its header" };
+        }
+
+        start[chunk + 1] = start[chunk] + stored;
+    }
+
+    if (start.back() != encoded.size()) {
+        throw std::runtime_error { "Packed image size does not match its header" };
+    }
+
+    auto image = PackedImage { chunkSize };
+    image.size_ = size;
+    image.chunks_.resize(numChunks);
+
+    std::exception_ptr failure{};
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (numChunks > 1)
+#endif
+    for (std::int64_t chunk = 0; chunk < static_cast<std::int64_t>(numChunks); ++chunk) {
+        try {
+            const auto rawSize = std::min(chunkSize, size - chunk*chunkSize);
+            const auto stored = encoded.subspan(start[chunk], start[chunk + 1] - start[chunk]);
+
+            auto& dest = image.chunks_[chunk];
+            dest.reserve(rawSize);
+
+            if (stored.size() == rawSize) {
+                dest.assign(stored.begin(), stored.end());
+            }
+            else {
+                dest.resize(rawSize);
+                decompressFast(stored, dest);
+            }
+        }
+        catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(PackedImage_decode)
+#endif
+            if (!failure) {
+                failure = std::current_exception();
+            }
+        }
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+
+    return image;
+}
+
+void PackedImage::writeFile(const std::filesystem::path& file,
+                            const Compression            compression) const
+{
+    const auto compressed = this->compressedChunks(compression);
+    const auto head = this->header(compression, compressed);
+
+    std::ofstream os { file, std::ios::binary };
+    if (! os) {
+        throw std::runtime_error {
+            fmt::format("Unable to open packed image file {}", file.string())
+        };
+    }
+
+    os.write(head.data(), head.size());
+    for (auto chunk = 0*compressed.size(); chunk < compressed.size(); ++chunk) {
+        const auto stored = this->storedChunk(chunk, compressed);
+        os.write(stored.data(), stored.size());
+    }
+
+    if (! os) {
+        throw std::runtime_error {
+            fmt::format("Failed to write packed image file {}", file.string())
+        };
+    }
+}
+
+PackedImage PackedImage::readFile(const std::filesystem::path& file)
+{
+    std::ifstream is { file, std::ios::binary };
+    if (! is) {
+        throw std::runtime_error {
+            fmt::format("Unable to open packed image file {}", file.string())
+        };
+    }
+
+    auto encoded = std::vector<char>(std::filesystem::file_size(file));
+    is.read(encoded.data(), encoded.size());
+
+    if (! is) {
+        throw std::runtime_error {
+            fmt::format("Failed to read packed image file {}", file.string())
+        };
+    }
+
+    return decode(encoded);
+}
+
+std::vector<std::vector<char>>
+PackedImage::compressedChunks(const Compression compression) const
+{
+    auto compressed = std::vector<std::vector<char>>(chunks_.size());
+
+    if (compression == Compression::None) {
+        return compressed;
+    }
+
+    const auto numChunks = static_cast<std::int64_t>(chunks_.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (numChunks > 1)
+#endif
+    for (std::int64_t chunk = 0; chunk < numChunks; ++chunk) {
+        compressed[chunk] = compressFast(chunks_[chunk]);
+
+        if (compressed[chunk].size() >= chunks_[chunk].size()) {
+            // Incompressible.  Store as is.
+            compressed[chunk].clear();
+        }
+    }
+
+    return compressed;
+}
+
+std::span<const char>
+PackedImage::storedChunk(const std::size_t                     chunk,
+                         const std::vector<std::vector<char>>& compressed) const
+{
+    if (compressed[chunk].empty()) {
+        return chunks_[chunk];
+    }
+
+    return compressed[chunk];
+}
+
+std::vector<char>
+PackedImage::header(const Compression                     compression,
+                    const std::vector<std::vector<char>>& compressed) const
+{
+    auto out = std::vector<char>(magic.begin(), magic.end());
+    out.reserve(fixedHeaderSize + compressed.size()*sizeof(std::uint64_t));
+
+    putValue(out, formatVersion);
+    putValue(out, static_cast<std::uint32_t>(compression));
+    putValue(out, static_cast<std::uint64_t>(chunkSize_));
+    putValue(out, static_cast<std::uint64_t>(size_));
+    putValue(out, static_cast<std::uint64_t>(compressed.size()));
+
+    for (auto chunk = 0*compressed.size(); chunk < compressed.size(); ++chunk) {
+        putValue(out, static_cast<std::uint64_t>(this->storedChunk(chunk, compressed).size()));
+    }
+
+    return out;
+}
+
+} // end namespace Serialization
+} // end namespace Opm
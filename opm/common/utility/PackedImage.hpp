@@ -0,0 +1,131 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PACKED_IMAGE_HPP
+#define PACKED_IMAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace Opm {
+namespace Serialization {
+
+//! \brief Growable, chunked byte image of serialized objects.
+//!
+//! Bytes are appended to fixed size chunks, so growing the image never
+//! moves previously packed data.  The image can be encoded into a single
+//! contiguous buffer, e.g., for broadcasting to other processes, or
+//! written to a file, and optionally compressed chunk by chunk in either
+//! case.  Encoded images use the native byte order and type sizes and are
+//! only portable between machines which agree on these.
+class PackedImage
+{
+public:
+    //! \brief Compression of encoded images.
+    enum class Compression : std::uint8_t {
+        None = 0, //!< Store chunks as is
+        Fast = 1, //!< LZ77 byte oriented compression of each chunk
+    };
+
+    //! \brief Default chunk size in bytes.
+    static constexpr std::size_t defaultChunkSize = std::size_t{1} << 22;
+
+    //! \brief Largest supported chunk size in bytes.
+    static constexpr std::size_t maxChunkSize = std::size_t{1} << 30;
+
+    //! \brief Constructor.
+    //! \param chunkSize Number of bytes in each chunk.  Must be positive
+    //!                  and at most maxChunkSize.
+    explicit PackedImage(std::size_t chunkSize = defaultChunkSize);
+
+    //! \brief Append bytes to end of image.
+    //! \param data Bytes to append
+    //! \param n Number of bytes
+    void append(const void* data, std::size_t n);
+
+    //! \brief Copy bytes out of image.
+    //! \param position Start of byte range in image
+    //! \param data Destination
+    //! \param n Number of bytes.  Throws std::out_of_range if the range
+    //!          extends beyond the end of the image.
+    void read(std::size_t position, void* data, std::size_t n) const;
+
+    //! \brief Total number of bytes in image.
+    std::size_t size() const { return size_; }
+
+    //! \brief Number of bytes in each chunk.
+    std::size_t chunkSize() const { return chunkSize_; }
+
+    //! \brief Number of allocated chunks.
+    std::size_t numChunks() const { return chunks_.size(); }
+
+    //! \brief Bytes of a single chunk.
+    std::span<const char> chunk(const std::size_t i) const { return chunks_[i]; }
+
+    //! \brief Remove all bytes from image.
+    void clear();
+
+    //! \brief Encode image into a single contiguous buffer.
+    //! \param compression Compression of chunk contents
+    std::vector<char> encode(Compression compression = Compression::None) const;
+
+    //! \brief Reconstruct image from encoded buffer.
+    //! \param encoded Result of encode().  Throws std::runtime_error if
+    //!                the buffer is not a valid encoded image.
+    static PackedImage decode(std::span<const char> encoded);
+
+    //! \brief Write encoded image to file.
+    //! \param file Name of output file.  Overwritten if it exists.
+    //! \param compression Compression of chunk contents
+    void writeFile(const std::filesystem::path& file,
+                   Compression compression = Compression::None) const;
+
+    //! \brief Read encoded image from file written by writeFile().
+    //! \param file Name of input file
+    static PackedImage readFile(const std::filesystem::path& file);
+
+private:
+    //! \brief Number of bytes in each chunk.
+    std::size_t chunkSize_{};
+
+    //! \brief Total number of bytes in image.
+    std::size_t size_{};
+
+    //! \brief Image contents.  All chunks except the last are full.
+    std::vector<std::vector<char>> chunks_{};
+
+    //! \brief Compressed contents of each chunk.  Empty for chunks which
+    //!        are stored as is.
+    std::vector<std::vector<char>> compressedChunks(Compression compression) const;
+
+    //! \brief Stored contents of a single chunk.
+    std::span<const char> storedChunk(std::size_t chunk,
+                                      const std::vector<std::vector<char>>& compressed) const;
+
+    //! \brief Encoded image header, including table of stored chunk sizes.
+    std::vector<char> header(Compression compression,
+                             const std::vector<std::vector<char>>& compressed) const;
+};
+
+} // end namespace Serialization
+} // end namespace Opm
+
+#endif // PACKED_IMAGE_HPP
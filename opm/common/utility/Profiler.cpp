@@ -0,0 +1,398 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/utility/Profiler.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+std::int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+        (std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// Completed scope retained for trace export.
+struct Event
+{
+    const char* name{nullptr};
+    std::int64_t begin{0};
+    std::int64_t duration{0};
+};
+
+/// Node of a per-thread call tree.
+struct Node
+{
+    const char* name{nullptr};
+    std::vector<std::size_t> children{};
+    std::uint64_t count{0};
+    std::int64_t total{0};
+};
+
+/// Profiling data owned by a single thread.
+///
+/// Only the owning thread records into this object.  The mutex is
+/// uncontended except while a report is being generated.
+struct ThreadData
+{
+    explicit ThreadData(const int threadIndex, const std::size_t ringCapacity)
+        : index { threadIndex }
+        , ring  ( ringCapacity )
+    {
+        this->nodes.emplace_back();
+    }
+
+    std::mutex mutex{};
+    int index{0};
+
+    // Call tree.  Node zero is the root.
+    std::vector<Node> nodes{};
+
+    // Active scopes: node index and start time.
+    std::vector<std::pair<std::size_t, std::int64_t>> stack{};
+
+    // Ring buffer of completed scopes.
+    std::vector<Event> ring{};
+    std::size_t ringNext{0};
+    std::size_t ringSize{0};
+
+    std::size_t currentNode() const
+    {
+        return this->stack.empty() ? std::size_t{0} : this->stack.back().first;
+    }
+
+    std::size_t child(const std::size_t parent, const char* name)
+    {
+        for (const auto c : this->nodes[parent].children) {
+            const auto* cname = this->nodes[c].name;
+            if ((cname == name) || (std::strcmp(cname, name) == 0)) {
+                return c;
+            }
+        }
+
+        const auto c = this->nodes.size();
+        this->nodes.emplace_back().name = name;
+        this->nodes[parent].children.push_back(c);
+
+        return c;
+    }
+
+    // Change ring capacity, keeping the most recent completed scopes.
+    void resizeRing(const std::size_t capacity)
+    {
+        if (capacity == this->ring.size()) {
+            return;
+        }
+
+        const auto n = this->ring.size();
+        const auto keep = std::min(this->ringSize, capacity);
+
+        auto resized = std::vector<Event>(capacity);
+        for (auto i = 0*keep; i < keep; ++i) {
+            resized[keep - 1 - i] = this->ring[(this->ringNext + n - 1 - i) % n];
+        }
+
+        this->ring.swap(resized);
+        this->ringSize = keep;
+        this->ringNext = (capacity > 0) ? keep % capacity : 0;
+    }
+
+    void clear()
+    {
+        this->nodes.assign(1, Node{});
+        this->stack.clear();
+        this->ringNext = this->ringSize = 0;
+    }
+};
+
+/// Registry of all threads' profiling data.  Entries outlive their
+/// threads so that the data is available for reporting.
+struct Registry
+{
+    std::mutex mutex{};
+    std::vector<std::unique_ptr<ThreadData>> threads{};
+    std::size_t ringCapacity{1 << 16};
+
+    static Registry& instance()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    ThreadData* registerThread()
+    {
+        std::lock_guard<std::mutex> lock { this->mutex };
+
+        const auto index = static_cast<int>(this->threads.size());
+        return this->threads.emplace_back
+            (std::make_unique<ThreadData>(index, this->ringCapacity)).get();
+    }
+};
+
+ThreadData& threadData()
+{
+    thread_local ThreadData* data = Registry::instance().registerThread();
+    return *data;
+}
+
+/// Call tree merged across threads and keyed by scope name.
+struct MergedNode
+{
+    std::uint64_t count{0};
+    std::int64_t total{0};
+    std::map<std::string_view, MergedNode> children{};
+};
+
+void mergeTree(const ThreadData& data, const std::size_t node, MergedNode& merged)
+{
+    for (const auto c : data.nodes[node].children) {
+        const auto& src = data.nodes[c];
+        auto& dst = merged.children[src.name];
+
+        dst.count += src.count;
+        dst.total += src.total;
+
+        mergeTree(data, c, dst);
+    }
+}
+
+void writeTree(const MergedNode& node,
+               const int depth,
+               const double totalTime,
+               std::string& out)
+{
+    // Longest running scopes first.
+    std::vector<std::pair<std::string_view, const MergedNode*>> children;
+    for (const auto& [name, child] : node.children) {
+        children.emplace_back(name, &child);
+    }
+
+    std::ranges::stable_sort(children, [](const auto& a, const auto& b)
+                             { return a.second->total > b.second->total; });
+
+    for (const auto& [name, child] : children) {
+        auto nested = std::int64_t{0};
+        for (const auto& grandChild : child->children) {
+            nested += grandChild.second.total;
+        }
+
+        const auto total = child->total * 1.0e-9;
+        const auto self = (child->total - nested) * 1.0e-9;
+        const auto label = std::string(2*depth, ' ') + std::string { name };
+
+        out += fmt::format("{:<48} {:>10} {:>12.6f} {:>12.6f} {:>6.1f}%\n",
+                           label, child->count, total, self,
+                           (totalTime > 0.0) ? 100.0 * total / totalTime : 0.0);
+
+        writeTree(*child, depth + 1, totalTime, out);
+    }
+}
+
+std::string jsonEscape(std::string_view s)
+{
+    auto escaped = std::string{};
+    escaped.reserve(s.size());
+
+    for (const auto c : s) {
+        switch (c) {
+        case '"':  escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n";  break;
+        case '\t': escaped += "\\t";  break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                escaped += fmt::format("\\u{:04x}", static_cast<int>(c));
+            }
+            else {
+                escaped += c;
+            }
+        }
+    }
+
+    return escaped;
+}
+
+} // Anonymous namespace
+
+namespace Opm::Profiler {
+
+namespace detail {
+
+    std::atomic<std::uint8_t> activeSubsystems{0};
+
+    void enterScope(const char* name)
+    {
+        auto& data = threadData();
+        const auto start = now();
+
+        std::lock_guard<std::mutex> lock { data.mutex };
+
+        const auto node = data.child(data.currentNode(), name);
+        data.stack.emplace_back(node, start);
+    }
+
+    void exitScope()
+    {
+        const auto end = now();
+        auto& data = threadData();
+
+        std::lock_guard<std::mutex> lock { data.mutex };
+
+        if (data.stack.empty()) {
+            // Data reset while scope was active.
+            return;
+        }
+
+        const auto [nodeIx, start] = data.stack.back();
+        data.stack.pop_back();
+
+        auto& node = data.nodes[nodeIx];
+        node.count += 1;
+        node.total += end - start;
+
+        if (! data.ring.empty()) {
+            data.ring[data.ringNext] = Event { node.name, start, end - start };
+            data.ringNext = (data.ringNext + 1) % data.ring.size();
+            data.ringSize = std::min(data.ringSize + 1, data.ring.size());
+        }
+    }
+
+} // namespace detail
+
+void enable(const std::uint8_t subsystems, const std::size_t ringCapacity)
+{
+    auto& registry = Registry::instance();
+    {
+        std::lock_guard<std::mutex> lock { registry.mutex };
+        registry.ringCapacity = ringCapacity;
+
+        for (auto& data : registry.threads) {
+            std::lock_guard<std::mutex> dataLock { data->mutex };
+            data->resizeRing(ringCapacity);
+        }
+    }
+
+    detail::activeSubsystems.store(subsystems);
+}
+
+void disable()
+{
+    detail::activeSubsystems.store(0);
+}
+
+void reset()
+{
+    auto& registry = Registry::instance();
+    std::lock_guard<std::mutex> lock { registry.mutex };
+
+    for (auto& data : registry.threads) {
+        std::lock_guard<std::mutex> dataLock { data->mutex };
+        data->clear();
+        data->ring.assign(registry.ringCapacity, Event{});
+    }
+}
+
+std::string summary()
+{
+    auto merged = MergedNode{};
+
+    {
+        auto& registry = Registry::instance();
+        std::lock_guard<std::mutex> lock { registry.mutex };
+
+        for (const auto& data : registry.threads) {
+            std::lock_guard<std::mutex> dataLock { data->mutex };
+            mergeTree(*data, 0, merged);
+        }
+    }
+
+    auto totalTime = std::int64_t{0};
+    for (const auto& child : merged.children) {
+        totalTime += child.second.total;
+    }
+
+    auto out = fmt::format("{:<48} {:>10} {:>12} {:>12} {:>7}\n",
+                           "Scope", "Calls", "Total [s]", "Self [s]", "Share");
+
+    writeTree(merged, 0, totalTime * 1.0e-9, out);
+
+    return out;
+}
+
+void report()
+{
+    OpmLog::info("Profile summary:\n" + summary());
+}
+
+void writeChromeTrace(const std::filesystem::path& filename)
+{
+    std::ofstream os { filename };
+    if (! os) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Unable to open trace file {}", filename.string()));
+    }
+
+    os << "{\"traceEvents\":[";
+
+    auto first = true;
+    auto& registry = Registry::instance();
+    std::lock_guard<std::mutex> lock { registry.mutex };
+
+    for (const auto& data : registry.threads) {
+        std::lock_guard<std::mutex> dataLock { data->mutex };
+
+        // Oldest retained event first.
+        const auto n = data->ring.size();
+        const auto begin = (data->ringNext + n - data->ringSize) % std::max(n, std::size_t{1});
+
+        for (auto i = 0*data->ringSize; i < data->ringSize; ++i) {
+            const auto& event = data->ring[(begin + i) % n];
+
+            os << (first ? "" : ",")
+               << fmt::format("\n{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},"
+                              "\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}",
+                              jsonEscape(event.name),
+                              event.begin * 1.0e-3, event.duration * 1.0e-3,
+                              data->index);
+
+            first = false;
+        }
+    }
+
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+} // namespace Opm::Profiler
@@ -0,0 +1,133 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PROFILER_HPP
+#define OPM_PROFILER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+/// Built-in, low-overhead profiler backing the OPM_TIMEBLOCK family of
+/// macros when configured with USE_NATIVE_PROFILER.
+///
+/// Each thread records scope timings into its own call tree and into a
+/// bounded ring buffer of completed scopes.  Recording is off until
+/// enabled at run time, and a disabled scope costs a single relaxed
+/// atomic load.
+namespace Opm::Profiler {
+
+namespace detail {
+
+    /// Subsystems, as Opm::Subsystem bits, for which scopes are recorded.
+    extern std::atomic<std::uint8_t> activeSubsystems;
+
+    void enterScope(const char* name);
+    void exitScope();
+
+} // namespace detail
+
+/// Start recording scopes.
+///
+/// \param[in] subsystems Bit mask of Opm::Subsystem values for which to
+///   record scopes.  Plain OPM_TIMEBLOCK/OPM_TIMEFUNCTION scopes are
+///   recorded for any non-zero mask.
+///
+/// \param[in] ringCapacity Maximum number of completed scopes retained
+///   per thread for trace export.  The most recent scopes are kept, also
+///   when changing the capacity of threads that already recorded scopes.
+///   Does not affect the aggregate report.
+void enable(std::uint8_t subsystems = 0xff, std::size_t ringCapacity = 1 << 16);
+
+/// Stop recording scopes.  Collected data is retained.
+void disable();
+
+/// Whether or not scopes of a particular subsystem are being recorded.
+inline bool isEnabled(const std::uint8_t subsystem)
+{
+    return (detail::activeSubsystems.load(std::memory_order_relaxed) & subsystem) != 0;
+}
+
+/// Discard all collected data.
+///
+/// Must not be called while timed scopes are active.
+void reset();
+
+/// Hierarchical aggregate of all recorded scopes.
+///
+/// Scopes with the same name and the same chain of enclosing scopes are
+/// combined, also across threads.  Each line lists call count, total
+/// time, time not spent in nested scopes and share of total recorded
+/// time.
+std::string summary();
+
+/// Write summary() to OpmLog as an info message.
+void report();
+
+/// Export the retained completed scopes as Chrome trace-event JSON.
+///
+/// The file can be loaded in chrome://tracing or https://ui.perfetto.dev.
+///
+/// \param[in] filename Name of output file.
+void writeChromeTrace(const std::filesystem::path& filename);
+
+/// Scope guard recording the time between construction and destruction.
+///
+/// \code
+///   {
+///       Opm::Profiler::Scope scope { "loadRestart", Opm::Subsystem::Output };
+///       ...
+///   }
+/// \endcode
+class Scope
+{
+public:
+    /// Constructor.
+    ///
+    /// \param[in] name Scope name.  Must outlive the profiler, typically
+    ///   a string literal or __func__.
+    ///
+    /// \param[in] subsystem Opm::Subsystem bits this scope belongs to.
+    Scope(const char* name, const std::uint8_t subsystem)
+        : active_ { isEnabled(subsystem) }
+    {
+        if (this->active_) {
+            detail::enterScope(name);
+        }
+    }
+
+    ~Scope()
+    {
+        if (this->active_) {
+            detail::exitScope();
+        }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    bool active_{false};
+};
+
+} // namespace Opm::Profiler
+
+#endif // OPM_PROFILER_HPP
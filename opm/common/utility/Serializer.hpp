@@ -143,12 +143,17 @@ public:
     void pack(const T& data)
     {
         m_ptrmap.clear();
-        m_op = Operation::PACKSIZE;
-        m_packSize = 0;
-        (*this)(data);
+        if constexpr (!is_single_pass<Packer>::value) {
+            m_op = Operation::PACKSIZE;
+            m_packSize = 0;
+            (*this)(data);
+            m_buffer.resize(m_packSize);
+            m_ptrmap.clear();
+        }
+        else {
+            m_packer.beginPack();
+        }
         m_position = 0;
-        m_buffer.resize(m_packSize);
-        m_ptrmap.clear();
         m_op = Operation::PACK;
         (*this)(data);
         m_ptrmap.clear();
@@ -161,12 +166,17 @@ public:
     void pack(const Args&... data)
     {
         m_ptrmap.clear();
-        m_op = Operation::PACKSIZE;
-        m_packSize = 0;
-        variadic_call(data...);
+        if constexpr (!is_single_pass<Packer>::value) {
+            m_op = Operation::PACKSIZE;
+            m_packSize = 0;
+            variadic_call(data...);
+            m_buffer.resize(m_packSize);
+            m_ptrmap.clear();
+        }
+        else {
+            m_packer.beginPack();
+        }
         m_position = 0;
-        m_buffer.resize(m_packSize);
-        m_ptrmap.clear();
         m_op = Operation::PACK;
         variadic_call(data...);
         m_ptrmap.clear();
@@ -539,6 +549,18 @@ protected:
     };
 #endif
 
+    //! \brief Predicate for packers which pack in a single pass.
+    //!
+    //! Such packers grow their own storage while packing and declare
+    //! \c singlePass, whence the pack size pass is skipped.  Their
+    //! \c beginPack() member function discards previously packed data.
+    template <typename, class = void>
+    struct is_single_pass : public std::false_type {};
+
+    template <typename P>
+    struct is_single_pass<P, std::void_t<decltype(P::singlePass)>>
+        : public std::bool_constant<P::singlePass> {};
+
     //! Detect existence of \c serializeOp member function
     //!
     //! Base case (no \c serializeOp member function)
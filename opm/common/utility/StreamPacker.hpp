@@ -0,0 +1,192 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef STREAM_PACKER_HPP
+#define STREAM_PACKER_HPP
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/PackedImage.hpp>
+#include <opm/common/utility/TimeService.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Opm {
+namespace Serialization {
+
+namespace detail {
+
+template <typename T>
+struct is_bitset : std::false_type {};
+
+template <std::size_t Size>
+struct is_bitset<std::bitset<Size>> : std::true_type {};
+
+} // namespace detail
+
+//! \brief Struct handling single pass packing of serialization to a
+//!        PackedImage.
+//!
+//! Appends to, and unpacks from, the image passed to the constructor
+//! rather than the serializer's buffer, so the serializer does not need
+//! to compute the packed size up front.  Produces the same byte sequence
+//! as MemPacker.  Arrays and vectors of POD data are copied in bulk.
+struct StreamPacker {
+    //! \brief Serializer skips the pack size pass for this packer.
+    static constexpr bool singlePass = true;
+
+    //! \brief Constructor.
+    //! \param image Image to pack into and unpack from
+    explicit StreamPacker(PackedImage& image)
+        : image_(&image)
+    {}
+
+    //! \brief Discard contents of image before packing from its start.
+    void beginPack() const
+    {
+        image_->clear();
+    }
+
+    //! \brief Calculates the pack size for a variable.
+    //! \tparam T The type of the data to be packed
+    //! \param data The data to pack
+    template<class T>
+    std::size_t packSize(const T& data) const
+    {
+        return MemPacker{}.packSize(data);
+    }
+
+    //! \brief Calculates the pack size for an array.
+    //! \tparam T The type of the data to be packed
+    //! \param data The array to pack
+    //! \param n Length of array
+    template<class T>
+    std::size_t packSize(const T* data, std::size_t n) const
+    {
+        return MemPacker{}.packSize(data, n);
+    }
+
+    //! \brief Pack a variable.
+    //! \tparam T The type of the data to be packed
+    //! \param data The variable to pack
+    //! \param position Position in image.  Advanced past packed data.
+    template<class T>
+    void pack(const T& data,
+              std::vector<char>&,
+              std::size_t& position) const
+    {
+        if constexpr (detail::is_pod_v<T>) {
+            append(&data, sizeof(T), position);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            const std::size_t size = data.size();
+            append(&size, sizeof(size), position);
+            append(data.data(), size, position);
+        } else if constexpr (std::is_same_v<T, time_point>) {
+            const auto count = data.time_since_epoch().count();
+            append(&count, sizeof(count), position);
+        } else if constexpr (detail::is_bitset<T>::value) {
+            const auto bits = data.to_ullong();
+            append(&bits, sizeof(bits), position);
+        } else {
+            static_assert(!std::is_same_v<T,T>, "Packing not supported for type");
+        }
+    }
+
+    //! \brief Pack an array.
+    //! \tparam T The type of the data to be packed
+    //! \param data The array to pack
+    //! \param n Length of array
+    //! \param position Position in image.  Advanced past packed data.
+    template<class T>
+    void pack(const T* data,
+              std::size_t n,
+              std::vector<char>&,
+              std::size_t& position) const
+    {
+        static_assert(detail::is_pod_v<T>, "Array packing not supported for non-pod data");
+        append(data, n*sizeof(T), position);
+    }
+
+    //! \brief Unpack a variable.
+    //! \tparam T The type of the data to be unpacked
+    //! \param data The variable to unpack
+    //! \param position Position in image.  Advanced past unpacked data.
+    template<class T>
+    void unpack(T& data,
+                const std::vector<char>&,
+                std::size_t& position) const
+    {
+        if constexpr (detail::is_pod_v<T>) {
+            read(&data, sizeof(T), position);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            std::size_t size = 0;
+            read(&size, sizeof(size), position);
+            data.resize(size);
+            read(data.data(), size, position);
+        } else if constexpr (std::is_same_v<T, time_point>) {
+            time_point::duration::rep count{};
+            read(&count, sizeof(count), position);
+            data = time_point(time_point::duration(count));
+        } else if constexpr (detail::is_bitset<T>::value) {
+            unsigned long long bits{};
+            read(&bits, sizeof(bits), position);
+            data = T(bits);
+        } else {
+            static_assert(!std::is_same_v<T,T>, "Packing not supported for type");
+        }
+    }
+
+    //! \brief Unpack an array.
+    //! \tparam T The type of the data to be unpacked
+    //! \param data The array to unpack
+    //! \param n Length of array
+    //! \param position Position in image.  Advanced past unpacked data.
+    template<class T>
+    void unpack(T* data,
+                std::size_t n,
+                const std::vector<char>&,
+                std::size_t& position) const
+    {
+        static_assert(detail::is_pod_v<T>, "Array packing not supported for non-pod data");
+        read(data, n*sizeof(T), position);
+    }
+
+private:
+    //! \brief Image to pack into and unpack from.
+    PackedImage* image_{nullptr};
+
+    void append(const void* data, std::size_t n, std::size_t& position) const
+    {
+        image_->append(data, n);
+        position += n;
+    }
+
+    void read(void* data, std::size_t n, std::size_t& position) const
+    {
+        image_->read(position, data, n);
+        position += n;
+    }
+};
+
+} // end namespace Serialization
+} // end namespace Opm
+
+#endif // STREAM_PACKER_HPP
@@ -0,0 +1,146 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CELL_GEOMETRY_HPP
+#define OPM_CELL_GEOMETRY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+/// Derived geometric quantities of corner-point cells, and a bulk driver
+/// computing them for many cells in a single pass.
+///
+/// Corners are numbered as in EclipseGrid::getCornerPos(), with corners
+/// 0..3 on the top face and corners 4..7 on the bottom face.
+namespace Opm::CellGeometry {
+
+/// Destination arrays of a bulk geometry computation.
+///
+/// Each non-empty span receives one value per requested cell.  Empty
+/// spans are skipped.
+struct Output
+{
+    std::span<std::array<double, 3>> center{};
+    std::span<double> volume{};
+    std::span<double> depth{};
+    std::span<double> thickness{};
+};
+
+/// Cell centre as the average of the corners.
+inline std::array<double, 3> center(const std::array<double, 8>& X,
+                                    const std::array<double, 8>& Y,
+                                    const std::array<double, 8>& Z)
+{
+    return { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+             std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+             std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 };
+}
+
+/// Difference between average bottom and average top depth.
+inline double thickness(const std::array<double, 8>& Z)
+{
+    const double z2 = (Z[4] + Z[5] + Z[6] + Z[7]) / 4.0;
+    const double z1 = (Z[0] + Z[1] + Z[2] + Z[3]) / 4.0;
+
+    return z2 - z1;
+}
+
+/// Average of top and bottom depths.
+inline double depth(const std::array<double, 8>& Z)
+{
+    const double z2 = (Z[4] + Z[5] + Z[6] + Z[7]) / 4.0;
+    const double z1 = (Z[0] + Z[1] + Z[2] + Z[3]) / 4.0;
+
+    return (z1 + z2) / 2.0;
+}
+
+/// Compute the requested quantities of cells 0..numCells-1.
+///
+/// Cells are processed in order, split into contiguous chunks across
+/// threads, so that cells which are neighbours in the caller's numbering
+/// share pillar and ZCORN data in cache.
+///
+/// \param[in] numCells Number of cells.
+///
+/// \param[in] cellCorners Callback, cellCorners(c, X, Y, Z), filling in
+///   the corners of cell \c c.  Called concurrently, must not throw.
+///
+/// \param[in] cellVolume Callback, cellVolume(c, X, Y, Z), returning the
+///   bulk volume of cell \c c.  Called concurrently, must not throw.
+///
+/// \param[in] out Destination arrays.
+template <class CellCorners, class CellVolume>
+void compute(const std::size_t numCells,
+             CellCorners&& cellCorners,
+             CellVolume&& cellVolume,
+             const Output& out)
+{
+    auto checkSize = [numCells](const std::size_t size, const char* what)
+    {
+        if ((size != 0) && (size != numCells)) {
+            throw std::invalid_argument {
+                std::string { "Size of cell " } + what +
+                " array does not match number of cells"
+            };
+        }
+    };
+
+    checkSize(out.center.size(), "center");
+    checkSize(out.volume.size(), "volume");
+    checkSize(out.depth.size(), "depth");
+    checkSize(out.thickness.size(), "thickness");
+
+    const auto n = static_cast<std::int64_t>(numCells);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (std::int64_t c = 0; c < n; ++c) {
+        std::array<double, 8> X;
+        std::array<double, 8> Y;
+        std::array<double, 8> Z;
+
+        cellCorners(c, X, Y, Z);
+
+        if (! out.center.empty()) {
+            out.center[c] = center(X, Y, Z);
+        }
+
+        if (! out.volume.empty()) {
+            out.volume[c] = cellVolume(c, X, Y, Z);
+        }
+
+        if (! out.depth.empty()) {
+            out.depth[c] = depth(Z);
+        }
+
+        if (! out.thickness.empty()) {
+            out.thickness[c] = thickness(Z);
+        }
+    }
+}
+
+} // namespace Opm::CellGeometry
+
+#endif // OPM_CELL_GEOMETRY_HPP
@@ -73,6 +73,20 @@ double C(const double* r, int i1, int i2, int i3)
    return  r[7] + r[4] + r[2] + r[1] - r[6] - r[5] - r[3] - r[0];
 }
 
+/*
+    All eight expressions C(r, i1, i2, i3) for one coordinate direction,
+    indexed by g = i1 + 2*i2 + 4*i3.  Evaluating these once per cell
+    instead of once per term leaves a branch free inner loop.
+*/
+std::array<double,8> coefficients(const std::array<double,8>& r)
+{
+    std::array<double,8> c;
+    for (int g = 0; g < 8; ++g)
+        c[g] = C(r.data(), g & 1, (g >> 1) & 1, (g >> 2) & 1);
+
+    return c;
+}
+
 struct pqr_t {
     int pb;
     int pg;
@@ -122,15 +136,15 @@ double calculateCellVol(const std::array<double,8>& X,
             {1, 1, 1, 1, 0, 0}, {1, 1, 1, 1, 0, 1}, {1, 1, 1, 1, 1, 0}, {1, 1, 1, 1, 1, 1}}};
 
     double volume = 0.0;
-    const double* vect[3];
-    const std::array<std::array<double,8>,3> data = {{X, Y, Z}};
+    const std::array<std::array<double,8>,3> coef = {{coefficients(X), coefficients(Y), coefficients(Z)}};
     double perm_sign = 1;
     for (const auto& perm : permutation) {
-        for (std::size_t perm_index = 0; perm_index < 3; perm_index++)
-            vect[perm_index] = data[perm[perm_index]].data();
+        const auto& c0 = coef[perm[0]];
+        const auto& c1 = coef[perm[1]];
+        const auto& c2 = coef[perm[2]];
 
         for (const auto& pqr : pqr_array) {
-            const double cprod = C(vect[0], 1, pqr.pb, pqr.pg)*C(vect[1], pqr.qa, 1, pqr.qg)*C(vect[2], pqr.ra, pqr.rb, 1);
+            const double cprod = c0[1 + 2*pqr.pb + 4*pqr.pg]*c1[pqr.qa + 2 + 4*pqr.qg]*c2[pqr.ra + 2*pqr.rb + 4];
             const double denom = (pqr.qa + pqr.ra + 1) * (pqr.pb + pqr.rb + 1) * (pqr.pg + pqr.qg + 1);
             volume += perm_sign * cprod / denom;
         }
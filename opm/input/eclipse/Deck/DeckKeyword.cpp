@@ -133,11 +133,12 @@ namespace Opm {
                       case type_tag::fdouble:
                           {
                               auto& dim = parser_item.dimensions();
+                              auto& dim_id = parser_item.dimensionIDs();
                               std::vector<Dimension> active_dimensions;
                               std::vector<Dimension> default_dimensions;
                               if (dim.size() > 0) {
-                                 active_dimensions.push_back( system_active.parse(dim[0]) );
-                                 default_dimensions.push_back( system_default.parse(dim[0]) );
+                                 active_dimensions.push_back( system_active.parse(dim_id[0], dim[0]) );
+                                 default_dimensions.push_back( system_default.parse(dim_id[0], dim[0]) );
                               }
                               DeckItem deck_item(parser_item.name(), double(), active_dimensions, default_dimensions);
                               add_deckvalue<double>(std::move(deck_item), deck_record, parser_item, input_record, j);
@@ -152,13 +153,14 @@ namespace Opm {
                       case type_tag::uda:
                          {
                              auto& dimensions = parser_item.dimensions();
+                             auto& dimension_ids = parser_item.dimensionIDs();
                              std::vector<Dimension> active_dimensions;
                              std::vector<Dimension> default_dimensions;
-                             for (const auto& dim_string : dimensions) {
+                             for (std::size_t d = 0; d < dimensions.size(); ++d) {
                                  active_dimensions.push_back(
-                                     system_active.parse(dim_string));
+                                     system_active.parse(dimension_ids[d], dimensions[d]));
                                  default_dimensions.push_back(
-                                     system_default.parse(dim_string));
+                                     system_default.parse(dimension_ids[d], dimensions[d]));
                              }
                              DeckItem deck_item(parser_item.name(), UDAValue(),
                                  active_dimensions, default_dimensions);
@@ -211,11 +213,12 @@ namespace Opm {
             throw std::invalid_argument("Input to DeckKeyword '" + name() + "': cannot be std::vector<double>.");
 
         auto& dim = parser_item.dimensions();
+        auto& dim_id = parser_item.dimensionIDs();
         std::vector<Dimension> active_dimensions;
         std::vector<Dimension> default_dimensions;
         if (dim.size() > 0) {
-             active_dimensions.push_back( system_active.parse(dim[0]) );
-             default_dimensions.push_back( system_default.parse(dim[0]) );
+             active_dimensions.push_back( system_active.parse(dim_id[0], dim[0]) );
+             default_dimensions.push_back( system_default.parse(dim_id[0], dim[0]) );
         }
         DeckItem item(parser_item.name(), double(), active_dimensions, default_dimensions);
         std::ranges::for_each(data, [&item](const double val) { item.push_back(val); });
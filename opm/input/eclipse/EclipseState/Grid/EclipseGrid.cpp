@@ -1565,13 +1565,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
                 std::array<double,8> Z;
                 auto global_index = this->m_active_to_global[active_index];
                 this->getCellCorners(global_index, X, Y, Z );
-                if (m_rv && m_thetav) {
-                    const auto[i,j,k] = this->getIJK(global_index);
-                    const auto& r = *m_rv;
-                    const auto& t = *m_thetav;
-                    volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-                } else
-                    volume[active_index] = calculateCellVol(X, Y, Z);
+                volume[active_index] = this->cellVolume(global_index, X, Y, Z);
             }
 
             this->active_volume = std::move(volume);
@@ -1592,6 +1586,13 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
+        return this->cellVolume(globalIndex, X, Y, Z);
+    }
+
+    double EclipseGrid::cellVolume(std::size_t globalIndex,
+                                   const std::array<double,8>& X,
+                                   const std::array<double,8>& Y,
+                                   const std::array<double,8>& Z) const {
         if (m_rv && m_thetav) {
             const auto[i,j,k] = this->getIJK(globalIndex);
             const auto& r = *m_rv;
@@ -1850,6 +1851,114 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return this->getCellDepth(globalIndex);
     }
 
+    void EclipseGrid::cellGeometry(const CellGeometry::Output& out) const {
+        const auto dims = this->getNXYZ();
+        const auto nxy = static_cast<std::size_t>(dims[0]) * dims[1];
+
+        CellGeometry::compute(this->getCartesianSize(),
+                              [this, &dims, nxy](const std::size_t globalIndex, auto& X, auto& Y, auto& Z)
+                              {
+                                  const auto rest = globalIndex % nxy;
+                                  const std::array<int,3> ijk {
+                                      static_cast<int>(rest % dims[0]),
+                                      static_cast<int>(rest / dims[0]),
+                                      static_cast<int>(globalIndex / nxy)
+                                  };
+
+                                  this->getCellCorners(ijk, dims, X, Y, Z);
+                              },
+                              [this](const std::size_t globalIndex, const auto& X, const auto& Y, const auto& Z)
+                              { return this->cellVolume(globalIndex, X, Y, Z); },
+                              out);
+
+        if (! out.depth.empty()) {
+            this->applyCellDepthOverrides({}, out.depth);
+        }
+    }
+
+    void EclipseGrid::cellGeometry(std::span<const int> globalIndices,
+                                   const CellGeometry::Output& out) const {
+        this->assertGlobalIndices(globalIndices);
+
+        const auto dims = this->getNXYZ();
+
+        CellGeometry::compute(globalIndices.size(),
+                              [this, &dims, globalIndices](const std::size_t c, auto& X, auto& Y, auto& Z)
+                              { this->getCellCorners(this->getIJK(globalIndices[c]), dims, X, Y, Z); },
+                              [this, globalIndices](const std::size_t c, const auto& X, const auto& Y, const auto& Z)
+                              { return this->cellVolume(globalIndices[c], X, Y, Z); },
+                              out);
+
+        if (! out.depth.empty()) {
+            this->applyCellDepthOverrides(globalIndices, out.depth);
+        }
+    }
+
+    void EclipseGrid::getCellCorners(std::span<const int> globalIndices,
+                                     std::span<std::array<double,8>> X,
+                                     std::span<std::array<double,8>> Y,
+                                     std::span<std::array<double,8>> Z) const {
+        if ((X.size() != globalIndices.size()) ||
+            (Y.size() != globalIndices.size()) ||
+            (Z.size() != globalIndices.size()))
+        {
+            throw std::invalid_argument("Size of corner arrays does not match number of cells");
+        }
+
+        this->assertGlobalIndices(globalIndices);
+
+        const auto dims = this->getNXYZ();
+        const auto n = static_cast<std::int64_t>(globalIndices.size());
+
+        #pragma omp parallel for schedule(static)
+        for (std::int64_t c = 0; c < n; ++c) {
+            this->getCellCorners(this->getIJK(globalIndices[c]), dims, X[c], Y[c], Z[c]);
+        }
+    }
+
+    void EclipseGrid::assertGlobalIndices(std::span<const int> globalIndices) const {
+        const auto invalid = std::ranges::find_if(globalIndices, [this](const int globalIndex)
+        {
+            return (globalIndex < 0) ||
+                (static_cast<std::size_t>(globalIndex) >= this->getCartesianSize());
+        });
+
+        if (invalid != globalIndices.end()) {
+            this->assertGlobalIndex(static_cast<std::size_t>(*invalid));
+        }
+    }
+
+    // Depth values which getCellDepth() takes from aquifer cells or from
+    // an explicitly assigned depth vector rather than from the geometry.
+    // Empty globalIndices means all cells in global index order.
+    void EclipseGrid::applyCellDepthOverrides(std::span<const int> globalIndices,
+                                              std::span<double> depth) const {
+        auto globalIndex = [globalIndices](const std::size_t c) -> std::size_t
+        {
+            return globalIndices.empty() ? c : static_cast<std::size_t>(globalIndices[c]);
+        };
+
+        if (this->m_depth.has_value()) {
+            const auto n = static_cast<std::int64_t>(depth.size());
+
+            #pragma omp parallel for schedule(static)
+            for (std::int64_t c = 0; c < n; ++c) {
+                if (const auto actIx = this->m_global_to_active[globalIndex(c)]; actIx >= 0) {
+                    depth[c] = (*this->m_depth)[actIx];
+                }
+            }
+        }
+
+        if (! this->m_aquifer_cell_depths.empty()) {
+            for (std::size_t c = 0; c < depth.size(); ++c) {
+                auto it = this->m_aquifer_cell_depths.find(globalIndex(c));
+                if (it != this->m_aquifer_cell_depths.end()) {
+                    depth[c] = it->second;
+                }
+            }
+        }
+    }
+
     const std::map<std::size_t, std::array<int,2>>& EclipseGrid::getAquiferCellTabnums() const {
         return m_aquifer_cell_tabnums;
     }
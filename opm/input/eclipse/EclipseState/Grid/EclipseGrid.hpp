@@ -26,12 +26,15 @@
 #include <opm/input/eclipse/EclipseState/Grid/NNC.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/PinchMode.hpp>
 
+#include <opm/common/utility/numeric/CellGeometry.hpp>
+
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
@@ -276,6 +279,23 @@ namespace Opm {
 
         double getCellDepth(std::size_t i,std::size_t j, std::size_t k) const;
         double getCellDepth(std::size_t globalIndex) const;
+
+        /// Bulk cell geometry in a single parallel sweep.
+        ///
+        /// Computes the quantities requested in \p out for all cells, in
+        /// global index order, or for the cells in \p globalIndices, e.g.,
+        /// getActiveMap().  Volumes and depths equal those of
+        /// getCellVolume() and getCellDepth().
+        void cellGeometry(const CellGeometry::Output& out) const;
+        void cellGeometry(std::span<const int> globalIndices,
+                          const CellGeometry::Output& out) const;
+
+        /// Corners of the cells in \p globalIndices.  Output spans must
+        /// have one element per cell.
+        void getCellCorners(std::span<const int> globalIndices,
+                            std::span<std::array<double,8>> X,
+                            std::span<std::array<double,8>> Y,
+                            std::span<std::array<double,8>> Z) const;
         ZcornMapper zcornMapper() const;
 
         const std::vector<double>& getCOORD() const;
@@ -438,6 +458,14 @@ namespace Opm {
                             std::array<double,8>& Y,
                             std::array<double,8>& Z) const;
 
+        double cellVolume(std::size_t globalIndex,
+                          const std::array<double,8>& X,
+                          const std::array<double,8>& Y,
+                          const std::array<double,8>& Z) const;
+        void assertGlobalIndices(std::span<const int> globalIndices) const;
+        void applyCellDepthOverrides(std::span<const int> globalIndices,
+                                     std::span<double> depth) const;
+
         void save_nnc(Opm::EclIO::EclOutput& egridfile, const std::vector<Opm::NNCdata>& nnc) const;
         void save_nnc(Opm::EclIO::EclOutput& egridfile, const Opm::NNCCollection& nnc_col) const;
 
@@ -32,7 +32,22 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/T.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/V.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    // Largest number of entries, i.e., (max region + 1)^2, for which the
+    // region pair lookup uses a dense matrix.  About 4 MB of indices.
+    constexpr std::size_t maxDenseLookupSize = std::size_t{1} << 20;
+}
 
 namespace Opm {
 
@@ -134,6 +149,8 @@ namespace Opm {
                 else
                     addBarrier( r1 , r2 );
             }
+
+            this->buildLookup();
         }
     }
 
@@ -177,25 +194,20 @@ namespace Opm {
         result.m_irreversible = true;
         result.m_thresholdPressureTable = {{true, 1.0}, {false, 2.0}};
         result.m_pressureTable = {{{1,2},{false,3.0}},{{2,3},{true,4.0}}};
+        result.buildLookup();
         return result;
     }
 
     bool ThresholdPressure::hasRegionBarrier(int r1 , int r2) const {
-        std::pair<int,int> indexPair = this->makeIndex(r1,r2);
-        if (m_pressureTable.find( indexPair ) == m_pressureTable.end())
-            return false;
-        else
-            return true;
+        return this->findEntry(r1, r2).has_value();
     }
 
     double ThresholdPressure::getThresholdPressure(int r1 , int r2) const {
-        std::pair<int,int> indexPair = this->makeIndex(r1,r2);
-        auto iter = m_pressureTable.find( indexPair );
-        if (iter == m_pressureTable.end())
+        const auto entry = this->findEntry(r1, r2);
+        if (! entry.has_value())
             return 0.0;
         else {
-            auto pair_pair = *iter;
-            auto value_pair = pair_pair.second;
+            const auto& value_pair = this->m_lookupValues[*entry];
             if (value_pair.first)
                 return value_pair.second;
             else {
@@ -206,6 +218,31 @@ namespace Opm {
 
     }
 
+    void ThresholdPressure::getThresholdPressures(std::span<const int> region1,
+                                                  std::span<const int> region2,
+                                                  std::span<double>    thpres) const
+    {
+        if ((region1.size() != region2.size()) || (region1.size() != thpres.size())) {
+            throw std::invalid_argument {
+                "Region and threshold pressure arrays must have the same size"
+            };
+        }
+
+        const auto n = static_cast<std::int64_t>(thpres.size());
+
+        #pragma omp parallel for schedule(static)
+        for (std::int64_t i = 0; i < n; ++i) {
+            const auto entry = this->findEntry(region1[i], region2[i]);
+            if (! entry.has_value()) {
+                thpres[i] = 0.0;
+                continue;
+            }
+
+            const auto& [initialized, value] = this->m_lookupValues[*entry];
+            thpres[i] = initialized ? value : std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
     double ThresholdPressure::getThresholdPressureFault(int idx) const {
         return m_thresholdFaultTable[idx];
     }
@@ -256,15 +293,72 @@ namespace Opm {
     }
 
     bool ThresholdPressure::hasThresholdPressure(int r1 , int r2) const {
-        std::pair<int,int> indexPair = makeIndex(r1,r2);
-        auto iter = m_pressureTable.find( indexPair );
-        if (iter == m_pressureTable.end())
+        const auto entry = this->findEntry(r1, r2);
+        if (! entry.has_value())
             return false;
-        else {
-            auto pair_pair = *iter;
-            auto value_pair = pair_pair.second;
-            return value_pair.first;
+        else
+            return this->m_lookupValues[*entry].first;
+    }
+
+    void ThresholdPressure::buildLookup() {
+        this->m_lookupKeys.clear();
+        this->m_lookupValues.clear();
+        this->m_lookupDense.clear();
+        this->m_lookupDim = 0;
+
+        // std::map iterates in sorted key order.
+        auto minRegion = 0;
+        auto maxRegion = -1;
+        for (const auto& [key, value] : this->m_pressureTable) {
+            this->m_lookupKeys.push_back(key);
+            this->m_lookupValues.push_back(value);
+            minRegion = std::min({ minRegion, key.first, key.second });
+            maxRegion = std::max({ maxRegion, key.first, key.second });
         }
+
+        if ((maxRegion < 0) || (minRegion < 0)) {
+            // No barriers or negative region IDs.  Use binary search.
+            return;
+        }
+
+        const auto dim = static_cast<std::size_t>(maxRegion) + 1;
+        if (dim * dim > maxDenseLookupSize) {
+            return;
+        }
+
+        this->m_lookupDim = dim;
+        this->m_lookupDense.assign(dim * dim, -1);
+        for (auto i = 0*this->m_lookupKeys.size(); i < this->m_lookupKeys.size(); ++i) {
+            const auto& [r1, r2] = this->m_lookupKeys[i];
+            this->m_lookupDense[r1*dim + r2] = static_cast<int>(i);
+        }
+    }
+
+    std::optional<std::size_t> ThresholdPressure::findEntry(int r1 , int r2) const {
+        const auto key = this->makeIndex(r1, r2);
+
+        if (this->m_lookupDim > 0) {
+            if ((key.first < 0) || (key.second < 0) ||
+                (static_cast<std::size_t>(key.first)  >= this->m_lookupDim) ||
+                (static_cast<std::size_t>(key.second) >= this->m_lookupDim))
+            {
+                return {};
+            }
+
+            const auto entry = this->m_lookupDense[key.first*this->m_lookupDim + key.second];
+            if (entry < 0) {
+                return {};
+            }
+
+            return static_cast<std::size_t>(entry);
+        }
+
+        const auto pos = std::ranges::lower_bound(this->m_lookupKeys, key);
+        if ((pos == this->m_lookupKeys.end()) || (*pos != key)) {
+            return {};
+        }
+
+        return static_cast<std::size_t>(std::distance(this->m_lookupKeys.begin(), pos));
     }
 
     bool ThresholdPressure::operator==(const ThresholdPressure& data) const {
@@ -22,6 +22,9 @@
 
 #include <cstddef>
 #include <map>
+#include <optional>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -81,6 +84,19 @@ namespace Opm {
         */
         double getThresholdPressure(int r1 , int r2) const;
 
+        /*
+          Batch version of getThresholdPressure() for a list of region
+          pairs, typically one pair for each face of the grid.  On return,
+          thpres[i] holds the threshold pressure between regions
+          region1[i] and region2[i].  Pairs without a barrier get zero
+          and pairs whose pressure has been defaulted get NaN, rather than
+          raising an error, so that the caller can fill in these values
+          from the initial solution.  All spans must have the same size.
+        */
+        void getThresholdPressures(std::span<const int> region1,
+                                   std::span<const int> region2,
+                                   std::span<double>    thpres) const;
+
         //! \brief Returns threshold pressure for a fault.
         double getThresholdPressureFault(int idx) const;
 
@@ -103,6 +119,10 @@ namespace Opm {
             serializer(m_thresholdPressureTable);
             serializer(m_pressureTable);
             serializer(m_thresholdFaultTable);
+
+            if (! serializer.isSerializing()) {
+                this->buildLookup();
+            }
         }
 
     private:
@@ -117,6 +137,21 @@ namespace Opm {
         std::vector<std::pair<bool,double>> m_thresholdPressureTable;
         std::map<std::pair<int,int> , std::pair<bool , double> > m_pressureTable;
         std::vector<double> m_thresholdFaultTable;
+
+        // Lookup structure derived from m_pressureTable by buildLookup().
+        // Not serialised.  The region pairs and values are stored in
+        // sorted order in m_lookupKeys and m_lookupValues.  For moderate
+        // region counts m_lookupDense additionally maps each pair, as a
+        // row major (m_lookupDim x m_lookupDim) matrix, to its position
+        // in those arrays or to -1 if the pair has no barrier.  Otherwise
+        // m_lookupDim is zero and pairs are located by binary search.
+        std::vector<std::pair<int,int>> m_lookupKeys;
+        std::vector<std::pair<bool,double>> m_lookupValues;
+        std::vector<int> m_lookupDense;
+        std::size_t m_lookupDim{0};
+
+        void buildLookup();
+        std::optional<std::size_t> findEntry(int r1, int r2) const;
     };
 } //namespace Opm
 
@@ -54,15 +54,19 @@
 #include <array>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <regex>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -146,6 +150,113 @@ namespace {
         std::unordered_map<std::string, std::unique_ptr<ConnectionSet>> wellConns_;
     };
 
+    /// Name-indexed catalogue of the run's wells at the end of the
+    /// simulation.
+    ///
+    /// Resolves the well name patterns of summary keywords without
+    /// matching every pattern against every well.  Plain well names and
+    /// templates whose only wildcard is a trailing asterisk, e.g., 'PROD*',
+    /// are resolved by binary search in a lexicographically sorted index.
+    /// Other patterns, e.g., well lists, are forwarded to the Schedule.
+    /// Results are cached per pattern since summary keywords typically
+    /// repeat the same well patterns many times over.
+    class WellNameCatalog
+    {
+    public:
+        /// Constructor.
+        ///
+        /// \param[in] schedule Run's collection of dynamic objects.
+        explicit WellNameCatalog(const Schedule& schedule)
+            : schedule_ { &schedule }
+            , names_    { schedule.wellNames() }
+        {
+            this->sorted_.resize(this->names_.size());
+            std::iota(this->sorted_.begin(), this->sorted_.end(), std::size_t{0});
+
+            std::ranges::sort(this->sorted_, std::less<>{},
+                              [this](const std::size_t i) -> const std::string&
+                              { return this->names_[i]; });
+        }
+
+        /// Retrieve wells matching a pattern.
+        ///
+        /// \param[in] pattern Well name, well name template, well list name
+        /// or well list template.
+        ///
+        /// \return Names of wells matching \p pattern, in well order.
+        /// Same as \code Schedule::wellNames(pattern) \endcode.
+        const std::vector<std::string>& wells(const std::string& pattern)
+        {
+            auto [pos, inserted] = this->matches_.try_emplace(pattern);
+            if (inserted) {
+                pos->second = this->match(pattern);
+            }
+
+            return pos->second;
+        }
+
+    private:
+        /// Schedule from which to resolve general patterns.
+        const Schedule* schedule_{nullptr};
+
+        /// Well names in well order.
+        std::vector<std::string> names_{};
+
+        /// Indices into names_, sorted by name.
+        std::vector<std::size_t> sorted_{};
+
+        /// Previously resolved patterns.
+        std::unordered_map<std::string, std::vector<std::string>> matches_{};
+
+        /// Resolve single pattern.
+        std::vector<std::string> match(const std::string& pattern) const
+        {
+            const auto wildcard = pattern.find_first_of("*?\\");
+            if ((wildcard == std::string::npos) ||
+                ((wildcard + 1 == pattern.size()) &&
+                 (pattern.back() == '*') && (pattern.size() > 1)))
+            {
+                return this->prefixMatch(std::string_view { pattern }.substr(0, wildcard),
+                                         wildcard != std::string::npos);
+            }
+
+            return this->schedule_->wellNames(pattern);
+        }
+
+        /// Resolve plain well name, or trailing-asterisk template, by
+        /// binary search.
+        std::vector<std::string> prefixMatch(const std::string_view prefix,
+                                             const bool isTemplate) const
+        {
+            const auto name = [this](const std::size_t i)
+            { return std::string_view { this->names_[i] }; };
+
+            auto first = std::ranges::lower_bound(this->sorted_, prefix, std::less<>{}, name);
+
+            if (! isTemplate) {
+                return ((first != this->sorted_.end()) && (name(*first) == prefix))
+                    ? std::vector<std::string> { this->names_[*first] }
+                    : std::vector<std::string> {};
+            }
+
+            auto last = first;
+            while ((last != this->sorted_.end()) && name(*last).starts_with(prefix)) {
+                ++last;
+            }
+
+            auto ix = std::vector<std::size_t>(first, last);
+            std::ranges::sort(ix);
+
+            auto wells = std::vector<std::string>{};
+            wells.reserve(ix.size());
+            std::ranges::transform(ix, std::back_inserter(wells),
+                                   [this](const std::size_t i)
+                                   { return this->names_[i]; });
+
+            return wells;
+        }
+    };
+
     /// Callback type: given a grid identifier, returns the grid's dimensions.
     ///
     /// \param gridID  Empty string for the global grid; LGR name for a local grid.
@@ -228,6 +339,27 @@ namespace {
             return this->uniqueConnVectors_.try_emplace(connVector).first->second;
         }
 
+        /// Retrieve wells matching a well name pattern.
+        ///
+        /// Establishes the run's well name catalogue on first access.
+        ///
+        /// \param[in] schedule Run's collection of dynamic objects.  Must
+        /// be the same object in all calls.
+        ///
+        /// \param[in] pattern Well name, well name template, well list name
+        /// or well list template.
+        ///
+        /// \return Names of wells matching \p pattern, in well order.
+        const std::vector<std::string>&
+        wellNames(const Schedule& schedule, const std::string& pattern)
+        {
+            if (! this->wellNames_.has_value()) {
+                this->wellNames_.emplace(schedule);
+            }
+
+            return this->wellNames_->wells(pattern);
+        }
+
         /// Retrieve maximum supported region ID in named region set.
         ///
         /// \param[in] regset Region set name.
@@ -308,6 +440,9 @@ namespace {
         /// Currently known connection vectors and their associated
         /// well/connection IDs.
         std::unordered_map<std::string, KnownWellConnections> uniqueConnVectors_{};
+
+        /// Run's well name catalogue.  Established on first access.
+        std::optional<WellNameCatalog> wellNames_{};
     };
 
     void SummaryConfigContext::RegSet::summariseContents(const std::vector<int>& regIDs)
@@ -1061,7 +1196,8 @@ void keywordW(SummaryConfig::keyword_list& list,
               const ParseContext&          parseContext,
               ErrorGuard&                  errors,
               const DeckKeyword&           keyword,
-              const Schedule&              schedule)
+              const Schedule&              schedule,
+              SummaryConfigContext&        context)
 {
     if (is_well_completion(keyword.name())) {
         keywordWL(list, parseContext, errors, keyword, schedule);
@@ -1076,7 +1212,7 @@ void keywordW(SummaryConfig::keyword_list& list,
 
     if (!keyword.empty() && keyword.getDataRecord().getDataItem().hasValue(0)) {
         for (const auto& pattern : keyword.getStringData()) {
-            const auto well_names = schedule.wellNames(pattern);
+            const auto& well_names = context.wellNames(schedule, pattern);
 
             if (well_names.empty()) {
                 handleMissingWell(parseContext, errors, keyword.location(), pattern);
@@ -1726,9 +1862,9 @@ void connectionKeyword(const bool                   isGeomechWithFracturingRun,
     for (const auto& record : keyword) {
         const auto& wellitem = record.getItem(0);
 
-        const auto well_names = wellitem.defaultApplied(0)
+        const auto& well_names = wellitem.defaultApplied(0)
             ? schedule.wellNames()
-            : schedule.wellNames(wellitem.getTrimmedString(0));
+            : context.wellNames(schedule, wellitem.getTrimmedString(0));
 
         if (well_names.empty()) {
             handleMissingWell(parseContext, errors, keyword.location(),
@@ -1854,6 +1990,7 @@ void connectionKeyword(const bool                   isGeomechWithFracturingRun,
                              ErrorGuard&                  errors,
                              const DeckKeyword&           keyword,
                              const Schedule&              schedule,
+                             SummaryConfigContext&        context,
                              SummaryConfig::keyword_list& list)
     {
         // Keyword has explicit records.  Process those and create
@@ -1876,7 +2013,7 @@ void connectionKeyword(const bool                   isGeomechWithFracturingRun,
             const auto& wellitem = record.getItem(0);
             const auto& well_names = wellitem.defaultApplied(0)
                 ? schedule.wellNames()
-                : schedule.wellNames(wellitem.getTrimmedString(0));
+                : context.wellNames(schedule, wellitem.getTrimmedString(0));
 
             if (well_names.empty()) {
                 handleMissingWell(parseContext, errors, keyword.location(),
@@ -1898,7 +2035,8 @@ void connectionKeyword(const bool                   isGeomechWithFracturingRun,
                   const ParseContext&          parseContext,
                   ErrorGuard&                  errors,
                   const DeckKeyword&           keyword,
-                  const Schedule&              schedule)
+                  const Schedule&              schedule,
+                  SummaryConfigContext&        context)
     {
         // Generate SMSPEC nodes for SUMMARY keywords of the form
         //
@@ -1925,7 +2063,7 @@ void connectionKeyword(const bool                   isGeomechWithFracturingRun,
             // Keyword with explicit records.  Handle as alternatives SOFR
             // and SPR above
             keywordSWithRecords(parseContext, errors,
-                                keyword, schedule, list);
+                                keyword, schedule, context, list);
         }
         else {
             // Keyword with no explicit records.  Handle as alternative SGFR
@@ -2017,7 +2155,7 @@ void handleKW(const std::vector<std::string>& node_names,
                 return;
             }
 
-            keywordW(list, parseContext, errors, keyword, schedule);
+            keywordW(list, parseContext, errors, keyword, schedule, context);
         }
         break;
 
@@ -2064,7 +2202,7 @@ void handleKW(const std::vector<std::string>& node_names,
         break;
 
     case Cat::Segment:
-        keywordS(list, parseContext, errors, keyword, schedule);
+        keywordS(list, parseContext, errors, keyword, schedule, context);
         break;
 
     case Cat::Node:
@@ -2145,14 +2283,163 @@ void handleKW(SummaryConfig::keyword_list& list,
     }
 }
 
+/// Compact, integer valued representation of a summary node's identity.
+///
+/// Strings are replaced by their rank among all distinct strings of the
+/// node collection, so comparing keys is equivalent to comparing the
+/// nodes themselves with operator<() and operator==(), but without any
+/// string comparisons.  Fields that do not participate in the node's
+/// identity, e.g., the named entity of a region level vector, are zero.
+struct NodeKey
+{
+    std::uint32_t keyword{};
+    std::uint32_t lgr{};
+    std::uint32_t entity{};
+    int number{};
+
+    /// Position in original node collection.
+    std::size_t index{};
+
+    /// Identity tuple.
+    auto identity() const
+    {
+        return std::tie(this->keyword, this->lgr, this->entity, this->number);
+    }
+};
+
+/// Interned string ranks of a collection of summary nodes.
+///
+/// References the strings of the node collection, which must therefore
+/// outlive this object and must not be modified.
+class NodeStringRanks
+{
+public:
+    /// Constructor.
+    ///
+    /// \param[in] nodes Summary nodes whose strings to rank.
+    explicit NodeStringRanks(const SummaryConfig::keyword_list& nodes)
+    {
+        for (const auto& node : nodes) {
+            this->rank_.try_emplace(node.keyword());
+            this->rank_.try_emplace(node.namedEntity());
+
+            if (node.lgr_name().has_value()) {
+                this->rank_.try_emplace(*node.lgr_name());
+            }
+        }
+
+        auto strings = std::vector<std::string_view>{};
+        strings.reserve(this->rank_.size());
+        for (const auto& elm : this->rank_) {
+            strings.push_back(elm.first);
+        }
+
+        std::ranges::sort(strings);
+
+        // Rank zero is reserved for absent LGR names which sort before all
+        // named LGRs.
+        auto rank = std::uint32_t{1};
+        for (const auto& string : strings) {
+            this->rank_[string] = rank++;
+        }
+    }
+
+    /// Compute node's identity key.
+    ///
+    /// \param[in] node Summary node.  Must be part of the collection
+    /// passed to the constructor.
+    ///
+    /// \param[in] index Position of \p node in the collection.
+    NodeKey key(const SummaryConfigNode& node, const std::size_t index) const
+    {
+        using Cat = SummaryConfigNode::Category;
+
+        auto key = NodeKey { this->rank(node.keyword()), 0, 0, 0, index };
+
+        switch (node.category()) {
+        case Cat::Field:
+        case Cat::Miscellaneous:
+            break;
+
+        case Cat::Well:
+        case Cat::Node:
+        case Cat::Group:
+            key.lgr = this->lgrRank(node);
+            key.entity = this->rank(node.namedEntity());
+            break;
+
+        case Cat::Aquifer:
+        case Cat::Region:
+        case Cat::Block:
+            key.lgr = this->lgrRank(node);
+            key.number = node.number();
+            break;
+
+        case Cat::Connection:
+        case Cat::Completion:
+        case Cat::Segment:
+            key.lgr = this->lgrRank(node);
+            key.entity = this->rank(node.namedEntity());
+            key.number = node.number();
+            break;
+        }
+
+        return key;
+    }
+
+private:
+    /// Rank of each distinct string.
+    std::unordered_map<std::string_view, std::uint32_t> rank_{};
+
+    std::uint32_t rank(const std::string& string) const
+    {
+        return this->rank_.find(string)->second;
+    }
+
+    std::uint32_t lgrRank(const SummaryConfigNode& node) const
+    {
+        return node.lgr_name().has_value()
+            ? this->rank(*node.lgr_name())
+            : std::uint32_t{0};
+    }
+};
+
 void uniq(SummaryConfig::keyword_list& vec)
 {
     if (vec.empty()) {
         return;
     }
 
-    std::ranges::sort(vec);
-    vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
+    // Sort and deduplicate on compact keys, keeping the first occurrence
+    // of each distinct node, then move the surviving nodes into place.
+    {
+        auto keys = std::vector<NodeKey>{};
+        keys.reserve(vec.size());
+
+        {
+            const auto ranks = NodeStringRanks { vec };
+            for (auto i = 0*vec.size(); i < vec.size(); ++i) {
+                keys.push_back(ranks.key(vec[i], i));
+            }
+        }
+
+        std::ranges::sort(keys, [](const NodeKey& k1, const NodeKey& k2)
+        {
+            return std::tie(k1.keyword, k1.lgr, k1.entity, k1.number, k1.index)
+                <  std::tie(k2.keyword, k2.lgr, k2.entity, k2.number, k2.index);
+        });
+
+        const auto last = std::unique(keys.begin(), keys.end(),
+                                      [](const NodeKey& k1, const NodeKey& k2)
+                                      { return k1.identity() == k2.identity(); });
+
+        auto nodes = SummaryConfig::keyword_list{};
+        nodes.reserve(std::distance(keys.begin(), last));
+        std::for_each(keys.begin(), last, [&vec, &nodes](const NodeKey& key)
+                      { nodes.push_back(std::move(vec[key.index])); });
+
+        vec.swap(nodes);
+    }
 
     // This is a desperate hack to ensure that the ROEW keywords come after
     // WOPT keywords, to ensure that the WOPT keywords have been fully
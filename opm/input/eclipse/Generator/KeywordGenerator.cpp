@@ -25,12 +25,15 @@
 
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
+#include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -63,6 +66,32 @@ namespace {
         write_file(stream.str(), file, verbose, desc);
     }
 
+    // Compact IDs of all distinct measure expressions in the keyword
+    // set.  Assigned in lexicographical order so that generated code is
+    // stable under reordering of the keyword list.
+    Opm::ParserItem::DimensionIDs dimensionIDs(const Opm::KeywordLoader& loader)
+    {
+        auto ids = Opm::ParserItem::DimensionIDs{};
+        for (const auto& [first_char, keywords] : loader) {
+            for (const auto& kw : keywords) {
+                for (const auto& record : kw) {
+                    for (const auto& item : record) {
+                        for (const auto& dim : item.dimensions()) {
+                            ids.emplace(dim, 0);
+                        }
+                    }
+                }
+            }
+        }
+
+        auto id = std::size_t{0};
+        for (auto& elm : ids) {
+            elm.second = id++;
+        }
+
+        return ids;
+    }
+
     const std::string sourceHeader = R"(// Generated code.  Please do not edit this file directly.
 
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
@@ -239,6 +268,31 @@ namespace Opm::ParserKeywords {{
 
             write_file(header, charHeaderFile, m_verbose, fmt::format("init header for {}", first_char));
 
+            // Keywords matched through regular expressions, and code
+            // keywords, must be fully known to the parser up front.  All
+            // other keywords are entered into a static table of deck names
+            // and instantiated on first use.
+            std::stringstream eagerStr;
+            std::stringstream tableStr;
+
+            for (const auto& kw : keywords) {
+                if (kw.hasMatchRegex() || kw.isCodeKeyword()) {
+                    eagerStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+                    continue;
+                }
+
+                auto deck_names = std::vector<std::string> {
+                    kw.deck_names().begin(), kw.deck_names().end()
+                };
+
+                std::sort(deck_names.begin(), deck_names.end());
+
+                for (const auto& deck_name : deck_names) {
+                    tableStr << fmt::format("        Parser::BuiltinKeyword {{ \"{}\", &makeKeyword<{}> }},",
+                                            deck_name, kw.className()) << '\n';
+                }
+            }
+
             std::stringstream sourceStr;
             sourceStr << fmt::format(R"(// Generated code.  Please do not edit this file directly.
 
@@ -247,14 +301,28 @@ namespace Opm::ParserKeywords {{
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/{0}.hpp>
 
+#include <array>
+
+namespace {{
+
+template <class Keyword>
+::Opm::ParserKeyword makeKeyword() {{ return Keyword{{}}; }}
+
+}} // Anonymous namespace
+
 void Opm::ParserKeywords::addDefaultKeywords{0}([[maybe_unused]] Parser& p)
 {{
     // Built-in '{0}' keywords.
 )",
                                      first_char);
 
-            for (const auto& kw : keywords) {
-                sourceStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+            sourceStr << eagerStr.str();
+
+            if (! tableStr.str().empty()) {
+                sourceStr << "\n    static constexpr auto builtin = std::array {\n"
+                          << tableStr.str()
+                          << "    };\n\n"
+                          << "    p.addBuiltinKeywords(builtin);\n";
             }
 
             // End of Opm::ParserKeywords::addDefaultKeywords{0}()
@@ -323,6 +391,11 @@ void python::common::export_ParserKeywords(py::module& module)
     void KeywordGenerator::updateKeywordSource(const KeywordLoader& loader,
                                                const std::string& sourcePath) const
     {
+        // Measure expressions are resolved to IDs here, rather than when
+        // the keywords are instantiated, so that the parser only needs a
+        // table lookup per item to find its unit conversion.
+        const auto dimension_ids = dimensionIDs(loader);
+
         for (const auto& [first_char, keywords] : loader) {
             std::stringstream newSource;
 
@@ -331,7 +404,7 @@ void python::common::export_ParserKeywords(py::module& module)
                       << "namespace Opm::ParserKeywords {\n";
 
             for (const auto& kw : keywords) {
-                newSource << kw.createCode() << '\n';
+                newSource << kw.createCode(dimension_ids) << '\n';
             }
 
             newSource << "} // namespace Opm::ParserKeywords\n";
@@ -418,6 +491,14 @@ void test_keyword(const Opm::ParserKeyword& inline_keyword, const std::string& j
                 BOOST_CHECK_NO_THROW(unitSystem.getNewDimension(dim));
             }
         }
+
+        const auto& inlineRecord = inline_keyword.getRecord(0);
+        for (std::size_t i = 0; i < inlineRecord.size(); ++i) {
+            for (const auto& id : inlineRecord.get(i).dimensionIDs()) {
+                BOOST_CHECK_MESSAGE(id != Opm::UnitSystem::noDimensionID,
+                                    "Dimension ID must be resolved in generated keyword");
+            }
+        }
     }
 }
 
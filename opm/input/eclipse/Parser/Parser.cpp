@@ -64,8 +64,13 @@
 #include <filesystem>
 #include <iostream>
 #include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <ranges>
 #include <regex>
+#include <span>
 #include <stack>
 #include <stdexcept>
 #include <string>
@@ -1764,7 +1769,7 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
     }
 
     std::size_t Parser::size() const {
-        return m_deckParserKeywords.size();
+        return m_deckParserKeywords.size() + m_builtinKeywords.size();
     }
 
     const ParserKeyword* Parser::matchingKeyword(const std::string_view& name) const
@@ -1785,14 +1790,14 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
             return false;
         }
 
-        return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+        return this->hasDeckKeyword(name)
             || (this->matchingKeyword(name) != nullptr);
     }
 
     bool Parser::isBaseRecognizedKeyword(std::string_view name) const
     {
         return ParserKeyword::validDeckName(name)
-            && (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end());
+            && this->hasDeckKeyword(name);
     }
 
 void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
@@ -1817,6 +1822,7 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
     const ParserKeyword * ptr = std::addressof(this->keyword_storage.back());
     for (const auto& deck_name : ptr->deck_names())
     {
+        m_builtinKeywords.erase(deck_name);
         m_deckParserKeywords[deck_name] = ptr;
     }
 
@@ -1834,9 +1840,54 @@ void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
     addParserKeyword( ParserKeyword( jsonKeyword ) );
 }
 
+void Parser::addBuiltinKeywords(std::span<const BuiltinKeyword> keywords)
+{
+    // Deck names of the same keyword share a single pending keyword.
+    auto pending = std::map<ParserKeyword (*)(), const PendingKeyword*>{};
+
+    for (const auto& keyword : keywords) {
+        auto pos = pending.find(keyword.factory);
+        if (pos == pending.end()) {
+            const auto* ptr = std::addressof(this->builtin_storage.emplace_back(keyword.factory));
+            pos = pending.emplace(keyword.factory, ptr).first;
+        }
+
+        this->m_deckParserKeywords.erase(keyword.deckName);
+        this->m_builtinKeywords.insert_or_assign(keyword.deckName, pos->second);
+    }
+}
+
+bool Parser::hasDeckKeyword(std::string_view deckName) const
+{
+    return this->m_deckParserKeywords.contains(deckName)
+        || this->m_builtinKeywords.contains(deckName);
+}
+
+const ParserKeyword* Parser::findDeckKeyword(std::string_view deckName) const
+{
+    if (auto pos = this->m_deckParserKeywords.find(deckName);
+        pos != this->m_deckParserKeywords.end())
+    {
+        return pos->second;
+    }
+
+    const auto builtin = this->m_builtinKeywords.find(deckName);
+    if (builtin == this->m_builtinKeywords.end()) {
+        return nullptr;
+    }
+
+    // Create the ParserKeyword object on first use of this builtin
+    // keyword.  Lookups only modify the pending keyword itself, so
+    // concurrent lookups are safe and do not lock once it exists.
+    const auto& pending = *builtin->second;
+    std::call_once(pending.created, [&pending]()
+    { pending.keyword = std::make_unique<ParserKeyword>(pending.factory()); });
+
+    return pending.keyword.get();
+}
+
 bool Parser::hasKeyword( const std::string& name ) const {
-    return this->m_deckParserKeywords.find( std::string_view( name ) )
-        != this->m_deckParserKeywords.end();
+    return this->hasDeckKeyword(name);
 }
 
 const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
@@ -1844,9 +1895,8 @@ const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
 }
 
 const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view& name ) const {
-    auto candidate = m_deckParserKeywords.find( name );
-
-    if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
+    if (const auto* candidate = this->findDeckKeyword(name); candidate != nullptr)
+        return *candidate;
 
     const auto* wildCardKeyword = matchingKeyword( name );
 
@@ -1858,9 +1908,14 @@ const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view
 
 std::vector<std::string> Parser::getAllDeckNames () const {
     std::vector<std::string> keywords;
-    for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
-        keywords.push_back(std::string(iterator->first));
+    keywords.reserve(m_deckParserKeywords.size() + m_builtinKeywords.size() + m_wildCardKeywords.size());
+    for (const auto& deck_name : m_deckParserKeywords | std::views::keys) {
+        keywords.emplace_back(deck_name);
+    }
+    for (const auto& deck_name : m_builtinKeywords | std::views::keys) {
+        keywords.emplace_back(deck_name);
     }
+    std::ranges::sort(keywords);
     for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
@@ -23,12 +23,16 @@
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
 #include <cstddef>
+#include <deque>
 #include <filesystem>
 #include <iosfwd>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -59,6 +63,21 @@ namespace Opm {
 
     class Parser {
     public:
+        /// Entry of the builtin keyword table generated by genkw.
+        ///
+        /// Builtin keywords are registered by deck name only, and the
+        /// corresponding ParserKeyword object is created the first time
+        /// the parser needs it.  A keyword with multiple deck names has one
+        /// entry for each deck name, all with the same factory function.
+        struct BuiltinKeyword
+        {
+            /// Deck name recognised by this entry.
+            std::string_view deckName;
+
+            /// Create ParserKeyword object for this entry's keyword.
+            ParserKeyword (*factory)();
+        };
+
         explicit Parser(bool addDefault = true);
         explicit Parser(std::shared_ptr<Python> python, bool addDefault = true);
 
@@ -92,6 +111,15 @@ namespace Opm {
         void addParserKeyword(const Json::JsonObject& jsonKeyword);
         void addParserKeyword(ParserKeyword parserKeyword);
 
+        /// Register builtin keywords for on-demand instantiation.
+        ///
+        /// Entries must outlive the parser, typically by being part of a
+        /// static table.  Later registrations, including those through
+        /// addParserKeyword(), take precedence over earlier ones.
+        ///
+        /// \param[in] keywords Builtin keyword table.
+        void addBuiltinKeywords(std::span<const BuiltinKeyword> keywords);
+
         /*!
          * \brief Returns whether the parser knows about a keyword
          */
@@ -179,12 +207,33 @@ namespace Opm {
 
         bool silentMode {false}; // Silence information messages (warnings and errors are still emitted)
 
+        // builtin keyword which is created on first use.  Created at most
+        // once, also when looked up concurrently, and without locking once
+        // it exists.
+        struct PendingKeyword
+        {
+            explicit PendingKeyword(ParserKeyword (*f)()) : factory(f) {}
+
+            ParserKeyword (*factory)();
+            mutable std::once_flag created{};
+            mutable std::unique_ptr<ParserKeyword> keyword{};
+        };
+
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
         std::list<ParserKeyword> keyword_storage{};
 
         // associative map of deck names and the corresponding ParserKeyword object
         std::map<std::string_view, const ParserKeyword*> m_deckParserKeywords{};
 
+        // builtin keywords registered through addBuiltinKeywords().  Elements
+        // are never moved, so m_builtinKeywords may refer to them.
+        std::deque<PendingKeyword> builtin_storage{};
+
+        // associative map of deck names and the corresponding builtin
+        // keyword.  Disjoint from m_deckParserKeywords.  Not modified by
+        // keyword lookups.
+        std::map<std::string_view, const PendingKeyword*> m_builtinKeywords{};
+
         // associative map of the parser internal names and the corresponding
         // ParserKeyword object for keywords which match a regular expression
         std::map<std::string_view, const ParserKeyword*> m_wildCardKeywords{};
@@ -194,6 +243,8 @@ namespace Opm {
         bool hasWildCardKeyword(const std::string& keyword) const;
 
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
+        const ParserKeyword* findDeckKeyword(std::string_view deckName) const;
+        bool hasDeckKeyword(std::string_view deckName) const;
         void addDefaultKeywords();
     };
 
@@ -230,7 +230,15 @@ const std::vector<std::string>& ParserItem::dimensions() const {
     return this->m_dimensions;
 }
 
+const std::vector<std::size_t>& ParserItem::dimensionIDs() const {
+    return this->m_dimension_ids;
+}
+
 void ParserItem::push_backDimension( const std::string& dim ) {
+    this->push_backDimension( dim, UnitSystem::noDimensionID );
+}
+
+void ParserItem::push_backDimension( const std::string& dim, const std::size_t id ) {
     if (!(this->input_type == ParserItem::itype::DOUBLE || this->input_type == ParserItem::itype::UDA))
         throw std::invalid_argument( "Invalid type, does not have dimension." );
 
@@ -241,6 +249,7 @@ void ParserItem::push_backDimension( const std::string& dim ) {
     }
 
     this->m_dimensions.push_back( dim );
+    this->m_dimension_ids.push_back( id );
 }
 
     const std::string& ParserItem::name() const {
@@ -389,7 +398,8 @@ ParserItem::itype ParserItem::from_string(const std::string& string_value) {
     throw std::invalid_argument( string_value + " cannot be converted to ParserInputType" );
 }
 
-std::string ParserItem::createCode(const std::string& indent) const {
+std::string ParserItem::createCode(const std::string& indent,
+                                   const DimensionIDs& dimensionIDs) const {
     std::stringstream stream;
     stream << indent << "ParserItem item(\"" << this->name() <<"\", " << this->type_literal() << ");" << '\n';
     if (this->m_sizeType != ParserItem::item_size::SINGLE)
@@ -427,8 +437,13 @@ std::string ParserItem::createCode(const std::string& indent) const {
         stream << " );" << '\n';
     }
 
-    for (const auto& dim : this->m_dimensions)
-        stream << indent <<"item.push_backDimension(\"" << dim << "\");" << '\n';
+    for (const auto& dim : this->m_dimensions) {
+        const auto id = dimensionIDs.find(dim);
+        if (id == dimensionIDs.end())
+            stream << indent <<"item.push_backDimension(\"" << dim << "\");" << '\n';
+        else
+            stream << indent <<"item.push_backDimension(\"" << dim << "\", " << id->second << ");" << '\n';
+    }
 
     if (this->m_description.size() > 0)
         stream << indent << "item.setDescription(\"" << this->m_description << "\");" << '\n';
@@ -557,9 +572,10 @@ DeckItem ParserItem::scan( RawRecord& record, UnitSystem& active_unitsystem, Uni
         {
             std::vector<Dimension> active_dimensions;
             std::vector<Dimension> default_dimensions;
-            for (const auto& dim_string : this->m_dimensions) {
-                active_dimensions.push_back( active_unitsystem.getNewDimension(dim_string) );
-                default_dimensions.push_back( default_unitsystem.getNewDimension(dim_string) );
+            for (std::size_t i = 0; i < this->m_dimensions.size(); ++i) {
+                const auto id = this->m_dimension_ids[i];
+                active_dimensions.push_back( active_unitsystem.getNewDimension(id, this->m_dimensions[i]) );
+                default_dimensions.push_back( default_unitsystem.getNewDimension(id, this->m_dimensions[i]) );
             }
 
             DeckItem item(this->name(), double(), active_dimensions, default_dimensions);
@@ -586,9 +602,10 @@ DeckItem ParserItem::scan( RawRecord& record, UnitSystem& active_unitsystem, Uni
         {
             std::vector<Dimension> active_dimensions;
             std::vector<Dimension> default_dimensions;
-            for (const auto& dim_string : this->m_dimensions) {
-                active_dimensions.push_back( active_unitsystem.getNewDimension(dim_string) );
-                default_dimensions.push_back( default_unitsystem.getNewDimension(dim_string) );
+            for (std::size_t i = 0; i < this->m_dimensions.size(); ++i) {
+                const auto id = this->m_dimension_ids[i];
+                active_dimensions.push_back( active_unitsystem.getNewDimension(id, this->m_dimensions[i]) );
+                default_dimensions.push_back( default_unitsystem.getNewDimension(id, this->m_dimensions[i]) );
             }
 
             DeckItem item(this->name(), UDAValue(), active_dimensions, default_dimensions);
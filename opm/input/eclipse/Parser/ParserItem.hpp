@@ -19,7 +19,9 @@
 #ifndef PARSER_ITEM_H
 #define PARSER_ITEM_H
 
+#include <cstddef>
 #include <iosfwd>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -73,8 +75,18 @@ namespace Opm {
         explicit ParserItem( const std::string& name, ParserItem::itype input_type );
         explicit ParserItem( const Json::JsonObject& jsonConfig );
 
+        /// Compact IDs of measure expressions, keyed by expression.
+        /// Assigned by the keyword generator.
+        using DimensionIDs = std::map<std::string, std::size_t>;
+
         void push_backDimension( const std::string& );
+        void push_backDimension( const std::string&, std::size_t id );
         const std::vector<std::string>& dimensions() const;
+
+        /// Generator assigned IDs of dimensions(), or
+        /// UnitSystem::noDimensionID for items not created by generated
+        /// code.
+        const std::vector<std::size_t>& dimensionIDs() const;
         const std::string& name() const;
         item_size sizeType() const;
         type_tag dataType() const;
@@ -97,7 +109,8 @@ namespace Opm {
 
         std::string size_literal() const;
         const std::string& className() const;
-        std::string createCode(const std::string& indent) const;
+        std::string createCode(const std::string& indent,
+                               const DimensionIDs& dimensionIDs = {}) const;
         std::ostream& inlineClass(std::ostream&, const std::string& indent) const;
         std::string inlineClassInit(const std::string& parentClass,
                                     const std::string* defaultValue = nullptr ) const;
@@ -109,6 +122,7 @@ namespace Opm {
         RawString rsval{};
         UDAValue uval{};
         std::vector< std::string > m_dimensions;
+        std::vector< std::size_t > m_dimension_ids;
 
         std::string m_name;
         item_size m_sizeType = item_size::SINGLE;
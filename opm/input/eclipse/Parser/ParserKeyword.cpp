@@ -975,7 +975,7 @@ void set_dimensions( ParserItem& item,
         return className() + "::" + className() + "()";
     }
 
-    std::string ParserKeyword::createCode() const {
+    std::string ParserKeyword::createCode(const ParserItem::DimensionIDs& dimensionIDs) const {
         std::stringstream ss;
         const std::string indent = "  ";
 
@@ -1067,7 +1067,7 @@ void set_dimensions( ParserItem& item,
                         ss << local_indent << "{" << '\n';
                         {
                             std::string indent3 = local_indent + "   ";
-                            ss << item.createCode(indent3);
+                            ss << item.createCode(indent3, dimensionIDs);
                             {
                                 std::string addItemMethod = "addItem";
                                 if (isDataKeyword())
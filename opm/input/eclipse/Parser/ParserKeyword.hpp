@@ -144,7 +144,7 @@ namespace Opm {
 
         std::string createDeclaration(const std::string& indent) const;
         std::string createDecl() const;
-        std::string createCode() const;
+        std::string createCode(const ParserItem::DimensionIDs& dimensionIDs = {}) const;
 
         bool operator==( const ParserKeyword& ) const;
         bool operator!=( const ParserKeyword& ) const;
@@ -0,0 +1,156 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp>
+
+#include <opm/input/eclipse/Schedule/Group/Group.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleState.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+Opm::GroupHierarchy::GroupHierarchy(const ScheduleState& state,
+                                    const std::string&   root)
+{
+    // Assign IDs in depth-first pre-order.  Children are pushed in
+    // reverse order so that the first child is visited first.
+    auto pending = std::vector<std::pair<std::string, std::size_t>> {
+        { root, npos }
+    };
+
+    while (! pending.empty()) {
+        auto [name, parent] = std::move(pending.back());
+        pending.pop_back();
+
+        const auto id = this->group_.size();
+        if (! this->id_.emplace(name, id).second) {
+            throw std::logic_error {
+                fmt::format("Group {} occurs more than once in group tree", name)
+            };
+        }
+
+        auto group = state.groups.get_ptr(name);
+        if (group == nullptr) {
+            throw std::invalid_argument {
+                fmt::format("Unknown group {} in group tree", name)
+            };
+        }
+
+        this->group_.push_back(std::move(group));
+        this->parent_.push_back(parent);
+        this->level_.push_back((parent == npos) ? 0 : this->level_[parent] + 1);
+
+        const auto& children = this->group_.back()->groups();
+        for (auto child = children.rbegin(); child != children.rend(); ++child) {
+            pending.emplace_back(*child, id);
+        }
+    }
+
+    const auto num_groups = this->group_.size();
+
+    // Child groups.  Visiting IDs in increasing order preserves each
+    // group's own child order.
+    this->child_start_.assign(num_groups + 1, 0);
+    for (auto id = 1 + 0*num_groups; id < num_groups; ++id) {
+        ++this->child_start_[this->parent_[id] + 1];
+    }
+
+    std::partial_sum(this->child_start_.begin(),
+                     this->child_start_.end(),
+                     this->child_start_.begin());
+
+    this->child_.resize(this->child_start_.back());
+    {
+        auto fill = std::vector<std::size_t>(this->child_start_.begin(),
+                                             this->child_start_.end() - 1);
+
+        for (auto id = 1 + 0*num_groups; id < num_groups; ++id) {
+            this->child_[fill[this->parent_[id]]++] = id;
+        }
+    }
+
+    // Wells.
+    this->well_start_.reserve(num_groups + 1);
+    this->well_start_.push_back(0);
+    for (const auto& group : this->group_) {
+        const auto& wells = group->wells();
+        this->well_.insert(this->well_.end(), wells.begin(), wells.end());
+        this->well_start_.push_back(this->well_.size());
+    }
+
+    // Traversal orders.
+    this->pre_order_.resize(num_groups);
+    std::iota(this->pre_order_.begin(), this->pre_order_.end(), std::size_t{0});
+
+    this->post_order_.reserve(num_groups);
+    {
+        // Pairs of group ID and number of children already visited.
+        auto stack = std::vector<std::pair<std::size_t, std::size_t>> {};
+        stack.reserve(num_groups);
+        stack.emplace_back(0, 0);
+
+        while (! stack.empty()) {
+            auto& [id, visited] = stack.back();
+            const auto children = this->children(id);
+
+            if (visited < children.size()) {
+                const auto child = children[visited++];
+                stack.emplace_back(child, 0);
+            }
+            else {
+                this->post_order_.push_back(id);
+                stack.pop_back();
+            }
+        }
+    }
+}
+
+bool Opm::GroupHierarchy::isCurrent(const ScheduleState& state) const
+{
+    return std::ranges::all_of(this->group_, [&state](const auto& group)
+    {
+        // Null if the group no longer exists.
+        return state.groups.get_ptr(group->name()) == group;
+    });
+}
+
+std::optional<std::size_t>
+Opm::GroupHierarchy::groupID(const std::string& name) const
+{
+    const auto pos = this->id_.find(name);
+    if (pos == this->id_.end()) {
+        return {};
+    }
+
+    return pos->second;
+}
+
+const std::string& Opm::GroupHierarchy::name(const std::size_t id) const
+{
+    return this->group_[id]->name();
+}
@@ -0,0 +1,140 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GROUP_HIERARCHY_HPP
+#define GROUP_HIERARCHY_HPP
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+
+class Group;
+class ScheduleState;
+
+/// Immutable, integer indexed snapshot of the group tree at a single
+/// report step.
+///
+/// Groups are identified by their position in a depth-first, pre-order
+/// traversal from the root group, meaning the root has ID zero and the
+/// descendants of each group form a contiguous ID range immediately
+/// following that group.  Child groups and wells are stored in
+/// compressed sparse row format, so all queries are allocation free.
+class GroupHierarchy
+{
+public:
+    /// Parent ID of root group.
+    static constexpr auto npos = std::numeric_limits<std::size_t>::max();
+
+    /// Constructor.
+    ///
+    /// \param[in] state Report step whose group tree to index.
+    ///
+    /// \param[in] root Name of root group.  Must exist in \p state.
+    explicit GroupHierarchy(const ScheduleState& state,
+                            const std::string& root = "FIELD");
+
+    /// Whether or not this hierarchy still describes the group tree of
+    /// \p state.
+    ///
+    /// Group objects are updated by replacement, so a structural change
+    /// anywhere in the tree implies a new object for at least one of the
+    /// groups in this hierarchy.
+    bool isCurrent(const ScheduleState& state) const;
+
+    /// Number of groups in hierarchy.
+    std::size_t size() const { return this->group_.size(); }
+
+    /// Group ID of named group.  Nullopt if the group is not part of
+    /// this hierarchy.
+    std::optional<std::size_t> groupID(const std::string& name) const;
+
+    /// Group object of particular group ID.
+    const Group& group(const std::size_t id) const { return *this->group_[id]; }
+
+    /// Name of particular group ID.
+    const std::string& name(std::size_t id) const;
+
+    /// Parent group ID.  Returns npos for the root group.
+    std::size_t parent(const std::size_t id) const { return this->parent_[id]; }
+
+    /// Distance from root group.  Zero for the root group itself.
+    std::size_t level(const std::size_t id) const { return this->level_[id]; }
+
+    /// IDs of immediate child groups, in the group's own order.
+    std::span<const std::size_t> children(const std::size_t id) const
+    {
+        return { this->child_.data() + this->child_start_[id],
+                 this->child_start_[id + 1] - this->child_start_[id] };
+    }
+
+    /// Names of wells directly owned by group, in the group's own order.
+    std::span<const std::string> wells(const std::size_t id) const
+    {
+        return { this->well_.data() + this->well_start_[id],
+                 this->well_start_[id + 1] - this->well_start_[id] };
+    }
+
+    /// Group IDs in depth-first pre-order.  Parents before children.
+    const std::vector<std::size_t>& preOrder() const { return this->pre_order_; }
+
+    /// Group IDs in depth-first post-order.  Children before parents.
+    const std::vector<std::size_t>& postOrder() const { return this->post_order_; }
+
+private:
+    /// Group objects, shared with the ScheduleState.  Indexed by ID.
+    std::vector<std::shared_ptr<const Group>> group_{};
+
+    /// Name to ID lookup.
+    std::unordered_map<std::string, std::size_t> id_{};
+
+    /// Parent ID of each group.
+    std::vector<std::size_t> parent_{};
+
+    /// Level of each group.
+    std::vector<std::size_t> level_{};
+
+    /// Start pointers into child_.
+    std::vector<std::size_t> child_start_{};
+
+    /// Child group IDs.
+    std::vector<std::size_t> child_{};
+
+    /// Start pointers into well_.
+    std::vector<std::size_t> well_start_{};
+
+    /// Well names.
+    std::vector<std::string> well_{};
+
+    /// Depth-first pre-order.
+    std::vector<std::size_t> pre_order_{};
+
+    /// Depth-first post-order.
+    std::vector<std::size_t> post_order_{};
+};
+
+} // namespace Opm
+
+#endif // GROUP_HIERARCHY_HPP
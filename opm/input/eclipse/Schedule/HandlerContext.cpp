@@ -108,6 +108,14 @@ bool HandlerContext::updateWellStatus(const std::string& well,
                                       status, location);
 }
 
+bool HandlerContext::updateWellStatus(Well& well,
+                                      WellStatus status,
+                                      const std::optional<KeywordLocation>& location)
+{
+    return schedule_.updateWellStatus(well, currentStep,
+                                      status, location);
+}
+
 WellStatus HandlerContext::getWellStatus(const std::string& well) const
 {
     return schedule_.getWell(well, currentStep).getStatus();
@@ -46,6 +46,7 @@ class ScheduleGrid;
 class ScheduleState;
 struct ScheduleStatic;
 struct SimulatorUpdate;
+class Well;
 enum class WellStatus : std::uint8_t;
 class WelSegsSet;
 }
@@ -136,6 +137,13 @@ public:
                           WellStatus status,
                           const std::optional<KeywordLocation>& location = {});
 
+    //! \brief Update status of a well object owned by the caller.
+    //! \details Emits the same events as the name based overload, but
+    //!          leaves storing the well in the current state to the caller.
+    bool updateWellStatus(Well& well,
+                          WellStatus status,
+                          const std::optional<KeywordLocation>& location = {});
+
     //! \brief Get status of a well
     WellStatus getWellStatus(const std::string& well) const;
 
@@ -640,7 +640,7 @@ namespace Opm {
         return this->m_comp_pressure_drop == rhs.m_comp_pressure_drop
             && this->m_segments.size() == rhs.m_segments.size()
             && this->segment_number_to_index.size() == rhs.segment_number_to_index.size()
-            && std::ranges::equal(this->m_segments, rhs.m_segments)
+            && (this->m_segments == rhs.m_segments)
             && std::ranges::equal(this->segment_number_to_index, rhs.segment_number_to_index);
     }
 
@@ -700,13 +700,19 @@ namespace Opm {
     bool WellSegments::updateICDScalingFactors(const WellConnections& connections)
     {
         bool update = false;
-        for (auto& segment : this->m_segments) {
+        for (auto i = 0*this->m_segments.size(); i < this->m_segments.size(); ++i) {
+            // Update a copy of the segment and store it only if changed so
+            // that unaffected segments remain shared with earlier copies.
+            auto segment = std::as_const(this->m_segments)[i];
             if (segment.isSpiralICD() || segment.isAICD()) {
                 const int segment_number = segment.segmentNumber();
                 const auto outlet_segment = this->getFromSegmentNumber(segment_number).outletSegment();
                 const auto outlet_segment_length = this->segmentLength(outlet_segment);
                 const auto completion_length = connections.segment_perf_length(segment_number);
-                update |= segment.updateICDScalingFactor(outlet_segment_length, completion_length);
+                if (segment.updateICDScalingFactor(outlet_segment_length, completion_length)) {
+                    this->m_segments[i] = std::move(segment);
+                    update = true;
+                }
             }
         }
         return update;
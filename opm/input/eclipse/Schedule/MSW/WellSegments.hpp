@@ -22,6 +22,8 @@
 
 #include <opm/input/eclipse/Schedule/MSW/Segment.hpp>
 
+#include <opm/utility/CopyOnWriteVector.hpp>
+
 #include <cstddef>
 #include <map>
 #include <set>
@@ -170,7 +172,10 @@ namespace Opm {
         // There are other three properties for segment related to thermal conduction,
         // while they are not supported by the keyword at the moment.
 
-        std::vector< Segment > m_segments{};
+        // Chunked copy-on-write storage.  Copies of a WellSegments object,
+        // e.g., when updating valves or ICDs in a new report step, share
+        // all unchanged segments with the original object.
+        Utility::CopyOnWriteVector<Segment> m_segments{};
         // the mapping from the segment number to the
         // storage index in the vector
         std::map<int, int> segment_number_to_index{};
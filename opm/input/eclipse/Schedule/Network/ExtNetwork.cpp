@@ -28,12 +28,42 @@
 #include <cassert>
 #include <functional>
 #include <iterator>
+#include <numeric>
 #include <stack>
 #include <stdexcept>
 #include <vector>
 
 #include <fmt/format.h>
 
+namespace {
+
+    // Row of CSR structure.  Empty if the row was added after the
+    // structure was built, e.g., for a node in the process of being
+    // connected to the network.
+    std::span<const std::size_t>
+    csr_row(const std::vector<std::size_t>& start,
+            const std::vector<std::size_t>& values,
+            const std::size_t               row)
+    {
+        if (row + 1 >= start.size()) {
+            return {};
+        }
+
+        return { values.data() + start[row], start[row + 1] - start[row] };
+    }
+
+    void check_node_id(const std::size_t node_id, const std::size_t num_nodes)
+    {
+        if (node_id >= num_nodes) {
+            throw std::out_of_range {
+                fmt::format("Node ID {} outside network of {} nodes",
+                            node_id, num_nodes)
+            };
+        }
+    }
+
+} // Anonymous namespace
+
 namespace Opm::Network {
 
 ExtNetwork ExtNetwork::serializationTestObject()
@@ -43,6 +73,7 @@ ExtNetwork ExtNetwork::serializationTestObject()
     object.insert_indexed_node_names = {"test1", "test2"};
     object.m_nodes = {{"test3", Node::serializationTestObject()}};
     object.m_is_standard_network = true;
+    object.build_topology();
     return object;
 }
 
@@ -112,6 +143,7 @@ void ExtNetwork::add_branch(Branch branch)
         }
     }
     this->m_branches.push_back( std::move(branch) );
+    this->build_topology();
 }
 
 void ExtNetwork::add_or_replace_branch(Branch branch)
@@ -138,6 +170,7 @@ void ExtNetwork::add_or_replace_branch(Branch branch)
     }
 
     this->m_branches.push_back( std::move(branch) );
+    this->build_topology();
 }
 
 void ExtNetwork::drop_branch(const std::string& uptree_node, const std::string& downtree_node)
@@ -150,6 +183,7 @@ void ExtNetwork::drop_branch(const std::string& uptree_node, const std::string&
                                             });
     if (branch_iter != this->m_branches.end()) {
         this->m_branches.erase(branch_iter);
+        this->build_topology();
     }
 }
 
@@ -160,16 +194,18 @@ std::optional<Branch> ExtNetwork::uptree_branch(const std::string& node) const
         throw std::out_of_range(msg);
     }
 
-    std::vector<Branch> branch;
-    std::ranges::copy_if(this->m_branches, std::back_inserter(branch),
-                         [&node](const Branch& b) { return b.downtree_node() == node; });
+    const auto id = this->find_node_id(node);
+    if (! id.has_value()) {
+        return {};
+    }
 
+    const auto branch = this->uptree_branch_ids(*id);
     if (branch.empty()) {
         return {};
     }
 
     if (branch.size() == 1) {
-        return std::move(branch[0]);
+        return this->m_branches[branch.front()];
     }
 
     throw std::logic_error("Bug - more than one uptree branch for node: " + node);
@@ -183,8 +219,16 @@ std::vector<Branch> ExtNetwork::downtree_branches(const std::string& node) const
     }
 
     std::vector<Branch> branch;
-    std::ranges::copy_if(this->m_branches, std::back_inserter(branch),
-                         [&node](const Branch& b) { return b.uptree_node() == node; });
+
+    const auto id = this->find_node_id(node);
+    if (! id.has_value()) {
+        return branch;
+    }
+
+    for (const auto branch_id : this->downtree_branch_ids(*id)) {
+        branch.push_back(this->m_branches[branch_id]);
+    }
+
     return branch;
 }
 
@@ -206,6 +250,156 @@ int ExtNetwork::NoOfNodes() const
     return this->m_nodes.size();
 }
 
+std::size_t ExtNetwork::node_id(const std::string& name) const
+{
+    const auto id = this->find_node_id(name);
+    if (! id.has_value()) {
+        throw std::out_of_range {
+            fmt::format("Node {} is not part of any network branch", name)
+        };
+    }
+
+    return *id;
+}
+
+const Branch& ExtNetwork::branch(const std::size_t branch_id) const
+{
+    return this->m_branches.at(branch_id);
+}
+
+std::span<const std::size_t>
+ExtNetwork::downtree_branch_ids(const std::size_t node_id) const
+{
+    check_node_id(node_id, this->insert_indexed_node_names.size());
+
+    return csr_row(this->m_down_start, this->m_down_branch, node_id);
+}
+
+std::optional<std::size_t>
+ExtNetwork::uptree_branch_id(const std::size_t node_id) const
+{
+    check_node_id(node_id, this->insert_indexed_node_names.size());
+
+    const auto branch = this->uptree_branch_ids(node_id);
+    if (branch.empty()) {
+        return {};
+    }
+
+    if (branch.size() > 1) {
+        throw std::logic_error {
+            "Bug - more than one uptree branch for node: "
+            + this->insert_indexed_node_names[node_id]
+        };
+    }
+
+    return branch.front();
+}
+
+const std::vector<std::size_t>& ExtNetwork::topological_order() const
+{
+    return this->m_topological_order;
+}
+
+const std::vector<std::size_t>& ExtNetwork::reverse_topological_order() const
+{
+    return this->m_reverse_topological_order;
+}
+
+std::optional<std::size_t> ExtNetwork::find_node_id(const std::string& name) const
+{
+    const auto pos = this->m_node_id.find(name);
+    if (pos == this->m_node_id.end()) {
+        return {};
+    }
+
+    return pos->second;
+}
+
+std::span<const std::size_t>
+ExtNetwork::uptree_branch_ids(const std::size_t node_id) const
+{
+    return csr_row(this->m_up_start, this->m_up_branch, node_id);
+}
+
+void ExtNetwork::build_topology()
+{
+    const auto num_nodes = this->insert_indexed_node_names.size();
+
+    this->m_node_id.clear();
+    for (auto node = 0*num_nodes; node < num_nodes; ++node) {
+        this->m_node_id.emplace(this->insert_indexed_node_names[node], node);
+    }
+
+    // Branch end points as node IDs.  Branches referring to nodes which
+    // are not indexed do not participate in the topology.
+    auto up_node = std::vector<std::size_t>(this->m_branches.size(), num_nodes);
+    auto down_node = up_node;
+    for (auto b = 0*this->m_branches.size(); b < this->m_branches.size(); ++b) {
+        const auto up = this->find_node_id(this->m_branches[b].uptree_node());
+        const auto down = this->find_node_id(this->m_branches[b].downtree_node());
+        if (up.has_value() && down.has_value()) {
+            up_node[b] = *up;
+            down_node[b] = *down;
+        }
+    }
+
+    // Counting sort of branch IDs by uptree and downtree node
+    // respectively.  Preserves branch definition order within each node.
+    auto build_csr = [num_nodes](const std::vector<std::size_t>& key,
+                                 std::vector<std::size_t>& start,
+                                 std::vector<std::size_t>& values)
+    {
+        start.assign(num_nodes + 1, 0);
+        for (const auto node : key) {
+            if (node < num_nodes) {
+                ++start[node + 1];
+            }
+        }
+
+        std::partial_sum(start.begin(), start.end(), start.begin());
+
+        values.resize(start.back());
+        auto fill = std::vector<std::size_t>(start.begin(), start.end() - 1);
+        for (auto b = 0*key.size(); b < key.size(); ++b) {
+            if (key[b] < num_nodes) {
+                values[fill[key[b]]++] = b;
+            }
+        }
+    };
+
+    build_csr(up_node, this->m_down_start, this->m_down_branch);
+    build_csr(down_node, this->m_up_start, this->m_up_branch);
+
+    // Breadth-first traversal from every node without an uptree branch.
+    this->m_topological_order.clear();
+    this->m_topological_order.reserve(num_nodes);
+    for (auto node = 0*num_nodes; node < num_nodes; ++node) {
+        if (this->m_up_start[node] == this->m_up_start[node + 1]) {
+            this->m_topological_order.push_back(node);
+        }
+    }
+
+    auto visited = std::vector<bool>(num_nodes, false);
+    for (const auto node : this->m_topological_order) {
+        visited[node] = true;
+    }
+
+    for (auto i = 0*num_nodes; i < this->m_topological_order.size(); ++i) {
+        const auto node = this->m_topological_order[i];
+        for (const auto b : this->downtree_branch_ids(node)) {
+            const auto child = down_node[b];
+            if (! visited[child]) {
+                visited[child] = true;
+                this->m_topological_order.push_back(child);
+            }
+        }
+    }
+
+    this->m_reverse_topological_order
+        .assign(this->m_topological_order.rbegin(),
+                this->m_topological_order.rend());
+}
+
 /*
   The validation of the network structure is very weak. The current validation
   goes as follows:
@@ -240,15 +434,13 @@ void ExtNetwork::update_node(Node node)
 
 void ExtNetwork::add_indexed_node_name(const std::string& name)
 {
+    this->m_node_id.emplace(name, this->insert_indexed_node_names.size());
     this->insert_indexed_node_names.emplace_back(name);
 }
 
 bool ExtNetwork::has_indexed_node_name(const std::string& name) const
 {
-    // Find given element in vector
-    const auto it = std::ranges::find(this->insert_indexed_node_names, name);
-
-    return (it != this->insert_indexed_node_names.end());
+    return this->m_node_id.find(name) != this->m_node_id.end();
 }
 
 const std::vector<std::string>& ExtNetwork::node_names() const
@@ -260,17 +452,22 @@ std::set<std::string> ExtNetwork::leaf_nodes() const
 {
     std::set<std::string> leaf_nodes;
     for (const auto& root : this->roots()) {
-        std::stack<std::string> children;
-        children.push(root.get().name());
+        const auto root_id = this->find_node_id(root.get().name());
+        if (! root_id.has_value()) {
+            continue;
+        }
+
+        std::stack<std::size_t> children;
+        children.push(*root_id);
         while (!children.empty()) {
-            const auto& top_node = children.top();
+            const auto top_node = children.top();
             children.pop();
-            auto dbranches = this->downtree_branches(top_node);
+            const auto dbranches = this->downtree_branch_ids(top_node);
             if (dbranches.empty()) {
-                leaf_nodes.emplace(top_node);
+                leaf_nodes.emplace(this->insert_indexed_node_names[top_node]);
             }
-            for (const auto& branch : dbranches) {
-                children.push(branch.downtree_node());
+            for (const auto branch : dbranches) {
+                children.push(this->m_node_id.at(this->m_branches[branch].downtree_node()));
             }
         }
     }
@@ -23,11 +23,14 @@
 #include <opm/input/eclipse/Schedule/Network/Branch.hpp>
 #include <opm/input/eclipse/Schedule/Network/Node.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Opm {
@@ -58,6 +61,37 @@ public:
     int NoOfBranches() const;
     int NoOfNodes() const;
 
+    // Integer indexed view of the network topology.  Node IDs are
+    // positions in node_names() and branch IDs are positions in the
+    // internal branch list.  The index is rebuilt whenever the set of
+    // branches changes, so lookups are constant time and do not copy
+    // any Branch objects.
+
+    /// ID of named node.  Throws std::out_of_range if the node is not
+    /// connected to any branch.
+    std::size_t node_id(const std::string& name) const;
+
+    /// Branch with ID \p branch_id.
+    const Branch& branch(std::size_t branch_id) const;
+
+    /// IDs of branches whose uptree node is \p node_id, in the order in
+    /// which the branches were defined.
+    std::span<const std::size_t> downtree_branch_ids(std::size_t node_id) const;
+
+    /// ID of the branch whose downtree node is \p node_id.  Nullopt if
+    /// \p node_id is the top of a tree.
+    std::optional<std::size_t> uptree_branch_id(std::size_t node_id) const;
+
+    /// Node IDs ordered such that each node appears before all nodes
+    /// downtree of it.  Nodes which are not reachable from the top of a
+    /// tree, i.e., nodes on a cycle, are not included.
+    const std::vector<std::size_t>& topological_order() const;
+
+    /// Node IDs ordered such that each node appears after all nodes
+    /// downtree of it.  Suitable for accumulating quantities from the
+    /// leaves towards the roots.
+    const std::vector<std::size_t>& reverse_topological_order() const;
+
     bool operator==(const ExtNetwork& other) const;
     static ExtNetwork serializationTestObject();
 
@@ -68,6 +102,10 @@ public:
         serializer(insert_indexed_node_names);
         serializer(m_nodes);
         serializer(m_is_standard_network);
+
+        if (! serializer.isSerializing()) {
+            this->build_topology();
+        }
     }
 
 private:
@@ -80,8 +118,23 @@ private:
     std::map<std::string, Node> m_nodes;
     bool m_is_standard_network{false};
 
+    // Derived from m_branches and insert_indexed_node_names by
+    // build_topology().  Not serialised.  Adjacency is stored in
+    // compressed sparse row format, with start pointers indexed by node
+    // ID and values being branch IDs.
+    std::unordered_map<std::string, std::size_t> m_node_id{};
+    std::vector<std::size_t> m_down_start{};
+    std::vector<std::size_t> m_down_branch{};
+    std::vector<std::size_t> m_up_start{};
+    std::vector<std::size_t> m_up_branch{};
+    std::vector<std::size_t> m_topological_order{};
+    std::vector<std::size_t> m_reverse_topological_order{};
+
     bool has_indexed_node_name(const std::string& name) const;
     void add_indexed_node_name(const std::string& name);
+    void build_topology();
+    std::optional<std::size_t> find_node_id(const std::string& name) const;
+    std::span<const std::size_t> uptree_branch_ids(std::size_t node_id) const;
 };
 
 } // namespace Opm::Network
@@ -47,6 +47,7 @@
 #include <opm/input/eclipse/Schedule/Group/GConSale.hpp>
 #include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
 #include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp>
 #include <opm/input/eclipse/Schedule/Group/GSatProd.hpp>
 #include <opm/input/eclipse/Schedule/Group/GTNode.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
@@ -1006,12 +1007,23 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
       Well pointer that will go stale and needs to be refreshed.
     */
     bool Schedule::updateWellStatus( const std::string& well_name, std::size_t reportStep , Well::Status status, std::optional<KeywordLocation> location) {
+        auto& snapshot = this->snapshots[reportStep];
+        auto well2 = snapshot.wells.get(well_name);
+        if (! this->updateWellStatus(well2, reportStep, status, location)) {
+            return false;
+        }
+
+        snapshot.wells.update( std::move(well2) );
+        return true;
+    }
+
+    bool Schedule::updateWellStatus(Well& well, std::size_t reportStep, Well::Status status, const std::optional<KeywordLocation>& location) {
+        const auto& well_name = well.name();
         if (status != Well::Status::SHUT) {
             this->potential_wellopen_patterns.insert(well_name);
         }
         auto& snapshot = this->snapshots[reportStep];
-        auto well2 = snapshot.wells.get(well_name);
-        if (well2.getConnections().empty() && status == Well::Status::OPEN) {
+        if (well.getConnections().empty() && status == Well::Status::OPEN) {
             if (location) {
                 auto msg = fmt::format("Problem with {}\n"
                                        "In {} line{}\n"
@@ -1022,9 +1034,9 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
             return false;
         }
 
-        auto old_status = well2.getStatus();
+        auto old_status = well.getStatus();
         bool update = false;
-        if (well2.updateStatus(status)) {
+        if (well.updateStatus(status)) {
             if (status == Well::Status::OPEN) {
                 auto new_rft = snapshot.rft_config().well_open(well_name);
                 if (new_rft.has_value())
@@ -1041,13 +1053,12 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
             auto& wellgroup_events = snapshot.wellgroup_events();
             if (old_status != status) {
                 snapshot.events().addEvent( ScheduleEvents::WELL_STATUS_CHANGE);
-                wellgroup_events.addEvent( well2.name(), ScheduleEvents::WELL_STATUS_CHANGE);
+                wellgroup_events.addEvent( well_name, ScheduleEvents::WELL_STATUS_CHANGE);
             }
-            const bool has_open_request = wellgroup_events.hasEvent( well2.name(), ScheduleEvents::REQUEST_OPEN_WELL);
+            const bool has_open_request = wellgroup_events.hasEvent( well_name, ScheduleEvents::REQUEST_OPEN_WELL);
             if (status == Well::Status::SHUT && has_open_request) {
-                wellgroup_events.clearEvent( well2.name(), ScheduleEvents::REQUEST_OPEN_WELL);
+                wellgroup_events.clearEvent( well_name, ScheduleEvents::REQUEST_OPEN_WELL);
             }
-            snapshot.wells.update( std::move(well2) );
             update = true;
         }
         return update;
@@ -1096,25 +1107,39 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
         return {};
     }
 
-    GTNode Schedule::groupTree(const std::string& root_node, std::size_t report_step, std::size_t level, const std::optional<std::string>& parent_name) const {
-        auto root_group = this->getGroup(root_node, report_step);
-        GTNode tree(root_group, level, parent_name);
+    GTNode Schedule::groupTree(const std::string& root_node, std::size_t report_step) const {
+        const auto& state = this->snapshots[report_step];
 
-        for (const auto& wname : root_group.wells()) {
-            const auto& well = this->getWell(wname, report_step);
-            tree.add_well(well);
+        auto hierarchy = state.group_hierarchy();
+        auto root = hierarchy->groupID(root_node);
+        if (! root.has_value()) {
+            // Group not connected to FIELD.  Index its own subtree.
+            hierarchy = std::make_shared<const GroupHierarchy>(state, root_node);
+            root = 0;
         }
 
-        for (const auto& gname : root_group.groups()) {
-            auto child_group = this->groupTree(gname, report_step, level + 1, root_node);
-            tree.add_group(child_group);
-        }
+        const auto root_level = hierarchy->level(*root);
+        auto make_node = [&state, &hierarchy, root = *root, root_level]
+            (const std::size_t id, auto&& self) -> GTNode
+        {
+            const auto parent_name = (id == root)
+                ? std::optional<std::string>{}
+                : std::optional<std::string>{ hierarchy->name(hierarchy->parent(id)) };
 
-        return tree;
-    }
+            GTNode tree(hierarchy->group(id), hierarchy->level(id) - root_level, parent_name);
 
-    GTNode Schedule::groupTree(const std::string& root_node, std::size_t report_step) const {
-        return this->groupTree(root_node, report_step, 0, {});
+            for (const auto& wname : hierarchy->wells(id)) {
+                tree.add_well(state.wells.get(wname));
+            }
+
+            for (const auto child : hierarchy->children(id)) {
+                tree.add_group(self(child, self));
+            }
+
+            return tree;
+        };
+
+        return make_node(*root, make_node);
     }
 
     GTNode Schedule::groupTree(std::size_t report_step) const {
@@ -3058,6 +3083,13 @@ void Schedule::create_next(const time_point& start_time, const std::optional<tim
         this->create_first(start_time, end_time);
     else {
         const auto& last = this->snapshots.back();
+
+        // Index the group tree of the completed report step so that
+        // subsequent report steps share it until the tree changes.
+        if (last.groups.has("FIELD")) {
+            last.group_hierarchy();
+        }
+
         if (end_time.has_value())
             this->snapshots.emplace_back( last, start_time, end_time.value() );
         else
@@ -576,8 +576,11 @@ namespace Opm {
         bool updateWPAVE(const std::string& wname, std::size_t report_step, const PAvg& pavg);
 
         void updateGuideRateModel(const GuideRateModel& new_model, std::size_t report_step);
-        GTNode groupTree(const std::string& root_node, std::size_t report_step, std::size_t level, const std::optional<std::string>& parent_name) const;
         bool updateWellStatus( const std::string& well, std::size_t reportStep, WellStatus status, std::optional<KeywordLocation> = {});
+        // Apply a status change to a caller-owned copy of a well, emitting the
+        // associated events.  The caller is responsible for storing the well
+        // in the report step's snapshot.
+        bool updateWellStatus(Well& well, std::size_t reportStep, WellStatus status, const std::optional<KeywordLocation>& location);
         void addWellToGroup( const std::string& group_name, const std::string& well_name , std::size_t timeStep);
         void iterateScheduleSection(std::size_t load_start,
                                     std::size_t load_end,
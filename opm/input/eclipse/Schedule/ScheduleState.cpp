@@ -27,6 +27,7 @@
 #include <opm/input/eclipse/Schedule/Group/GConSale.hpp>
 #include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
 #include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp>
 #include <opm/input/eclipse/Schedule/Group/GroupSatelliteInjection.hpp>
 #include <opm/input/eclipse/Schedule/Group/GSatProd.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
@@ -47,6 +48,8 @@
 #include <chrono>
 #include <cstddef>
 #include <ctime>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -354,6 +357,62 @@ void ScheduleState::rptonly(const bool only)
     this->m_rptonly = only;
 }
 
+ScheduleState::GroupHierarchyCache::
+GroupHierarchyCache(const GroupHierarchyCache& that)
+    : hierarchy_ { that.cached() }
+{}
+
+// Moved-from objects are not shared with other threads, so moving needs
+// no locking.
+ScheduleState::GroupHierarchyCache::
+GroupHierarchyCache(GroupHierarchyCache&& that) noexcept
+    : hierarchy_ { std::move(that.hierarchy_) }
+{}
+
+ScheduleState::GroupHierarchyCache&
+ScheduleState::GroupHierarchyCache::operator=(GroupHierarchyCache&& that) noexcept
+{
+    this->hierarchy_ = std::move(that.hierarchy_);
+    return *this;
+}
+
+ScheduleState::GroupHierarchyCache&
+ScheduleState::GroupHierarchyCache::operator=(const GroupHierarchyCache& that)
+{
+    if (this != &that) {
+        auto hierarchy = that.cached();
+
+        std::lock_guard<std::mutex> lock { this->mutex_ };
+        this->hierarchy_ = std::move(hierarchy);
+    }
+
+    return *this;
+}
+
+std::shared_ptr<const GroupHierarchy>
+ScheduleState::GroupHierarchyCache::get(const ScheduleState& state) const
+{
+    std::lock_guard<std::mutex> lock { this->mutex_ };
+
+    if ((this->hierarchy_ == nullptr) || ! this->hierarchy_->isCurrent(state)) {
+        this->hierarchy_ = std::make_shared<const GroupHierarchy>(state);
+    }
+
+    return this->hierarchy_;
+}
+
+std::shared_ptr<const GroupHierarchy>
+ScheduleState::GroupHierarchyCache::cached() const
+{
+    std::lock_guard<std::mutex> lock { this->mutex_ };
+    return this->hierarchy_;
+}
+
+std::shared_ptr<const GroupHierarchy> ScheduleState::group_hierarchy() const
+{
+    return this->m_group_hierarchy.get(*this);
+}
+
 bool ScheduleState::operator==(const ScheduleState& other) const {
 
     return this->m_start_time == other.m_start_time
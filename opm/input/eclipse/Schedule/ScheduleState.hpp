@@ -48,6 +48,7 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -77,6 +78,7 @@ namespace Opm {
     class GConSale;
     class GConSump;
     class GroupEconProductionLimits;
+    class GroupHierarchy;
     class GroupOrder;
     class GroupSatelliteInjection;
     class GSatProd;
@@ -430,6 +432,30 @@ namespace Opm {
             ListChangeStatus listsChanged_{{false, false}};
         };
 
+        /// Group hierarchy derived from a report step's groups.
+        ///
+        /// Safe to query concurrently.  Copies share the cached hierarchy
+        /// until the group structure of either copy changes.
+        class GroupHierarchyCache
+        {
+        public:
+            GroupHierarchyCache() = default;
+            GroupHierarchyCache(const GroupHierarchyCache& that);
+            GroupHierarchyCache(GroupHierarchyCache&& that) noexcept;
+            GroupHierarchyCache& operator=(const GroupHierarchyCache& that);
+            GroupHierarchyCache& operator=(GroupHierarchyCache&& that) noexcept;
+
+            /// Group hierarchy of \p state.  Rebuilt if the cached
+            /// hierarchy no longer describes the groups of \p state.
+            std::shared_ptr<const GroupHierarchy> get(const ScheduleState& state) const;
+
+        private:
+            mutable std::mutex mutex_{};
+            mutable std::shared_ptr<const GroupHierarchy> hierarchy_{};
+
+            std::shared_ptr<const GroupHierarchy> cached() const;
+        };
+
         ScheduleState() = default;
         explicit ScheduleState(const time_point& start_time);
         ScheduleState(const time_point& start_time, const time_point& end_time);
@@ -459,6 +485,14 @@ namespace Opm {
         std::size_t num_lgr_groups_in_group(const Group& grp, const std::string& lgr_tag) const;
 
 
+        /// Integer indexed group tree rooted at FIELD.
+        ///
+        /// Built on first use and reused, also by subsequent report steps
+        /// copied from this one, for as long as the group structure does
+        /// not change.  Safe to call concurrently as long as the groups
+        /// are not modified at the same time.
+        std::shared_ptr<const GroupHierarchy> group_hierarchy() const;
+
         bool operator==(const ScheduleState& other) const;
         static ScheduleState serializationTestObject();
 
@@ -737,6 +771,9 @@ namespace Opm {
         WellProducerCMode m_whistctl_mode = WellProducerCMode::CMODE_UNDEFINED;
         std::optional<double> m_sumthin{};
         bool m_rptonly{false};
+
+        // Derived from 'groups' on demand.  Not serialised or compared.
+        GroupHierarchyCache m_group_hierarchy{};
     };
 
 } // namespace Opm
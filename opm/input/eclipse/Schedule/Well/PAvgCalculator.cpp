@@ -682,29 +682,33 @@ void PAvgCalculator<Scalar>::pruneInactiveWBPCells(const std::vector<bool>& isAc
         newIndex[activeIx[i]] = i;
     }
 
-    const auto neighList = std::array {
-        &PAvgConnection::rectNeighbours,
-        &PAvgConnection::diagNeighbours,
-    };
-
-    // 2) Affect element index renumbering.
+    // 2) Affect element index renumbering.  Rebuild neighbour structure
+    // in the process since inactive and well cells leave gaps.
+    auto newStart = std::vector<ContrIndexType>{};
+    auto newNeighbours = std::vector<ContrIndexType>{};
+    newStart.reserve(2*this->connections_.size() + 1);
+    newNeighbours.reserve(this->neighbours_.size());
+
+    newStart.push_back(0);
     for (auto& conn : this->connections_) {
         conn.cell = newIndex[conn.cell]; // Known to be active.
 
-        for (const auto& neighbours : neighList) {
-            auto newNeigbour = std::vector<ContrIndexType>{};
-            newNeigbour.reserve((conn.*neighbours).size());
-
+        for (const auto group : { 0, 1 }) {
             // Final neighbourship includes active, non-well cells only.
-            for (const auto& neighbour : conn.*neighbours) {
+            for (const auto& neighbour : this->neighbours(conn, group)) {
                 if (isActive[neighbour] && !isWellCell[neighbour]) {
-                    newNeigbour.push_back(newIndex[neighbour]);
+                    newNeighbours.push_back(newIndex[neighbour]);
                 }
             }
 
-            (conn.*neighbours).swap(newNeigbour);
+            newStart.push_back(newNeighbours.size());
         }
+
+        conn.nbGroup = newStart.size() - 3;
     }
+
+    this->neighbourStart_.swap(newStart);
+    this->neighbours_.swap(newNeighbours);
 }
 
 template<class Scalar>
@@ -740,16 +744,18 @@ void PAvgCalculator<Scalar>::accumulateLocalContributions(const Sources& sources
     this->accumCTF_.prepareAccumulation();
     this->accumPV_.prepareAccumulation();
 
+    this->gatherCellSources(sources);
+
     const auto connDensity =
         this->connectionDensity(sources, controls, gravity);
 
     if (controls.open_connections()) {
-        this->accumulateLocalContribOpen(sources, controls,
+        this->accumulateLocalContribOpen(controls,
                                          gravity, refDepth,
                                          connDensity);
     }
     else {
-        this->accumulateLocalContribAll(sources, controls,
+        this->accumulateLocalContribAll(controls,
                                         gravity, refDepth,
                                         connDensity);
     }
@@ -790,6 +796,7 @@ addConnection(const GridDims&   cellIndexMap,
     this->inputConn_.push_back(this->connections_.size());
 
     this->connections_.emplace_back(conn.CF(), localCellPos->second);
+    this->connections_.back().nbGroup = this->neighbourStart_.size() - 1;
 
     if (conn.dir() == Connection::Direction::X) {
         this->addNeighbours_X(cellIndexMap, setupHelperMap);
@@ -800,6 +807,8 @@ addConnection(const GridDims&   cellIndexMap,
     else if (conn.dir() == Connection::Direction::Z) {
         this->addNeighbours_Z(cellIndexMap, setupHelperMap);
     }
+
+    assert (this->neighbourStart_.size() == 2*this->connections_.size() + 1);
 }
 
 template<class Scalar>
@@ -866,7 +875,6 @@ void PAvgCalculator<Scalar>::pruneInactiveConnections(const std::vector<bool>& i
 template<class Scalar>
 void PAvgCalculator<Scalar>::
 addNeighbour(std::optional<std::size_t> neighbour,
-             const NeighbourKind        neighbourKind,
              SetupMap&                  setupHelperMap)
 {
     if (! neighbour) {
@@ -880,11 +888,49 @@ addNeighbour(std::optional<std::size_t> neighbour,
         this->contributingCells_.push_back(localCellPos->first);
     }
 
-    auto& neighbours = (neighbourKind == NeighbourKind::Rectangular)
-        ? this->connections_.back().rectNeighbours
-        : this->connections_.back().diagNeighbours;
+    this->neighbours_.push_back(localCellPos->second);
+}
+
+template<class Scalar>
+void PAvgCalculator<Scalar>::closeNeighbourGroup()
+{
+    this->neighbourStart_.push_back(this->neighbours_.size());
+}
+
+template<class Scalar>
+std::span<const typename PAvgCalculator<Scalar>::ContrIndexType>
+PAvgCalculator<Scalar>::neighbours(const PAvgConnection& conn,
+                                   const int             group) const
+{
+    const auto begin = this->neighbourStart_[conn.nbGroup + group + 0];
+    const auto end   = this->neighbourStart_[conn.nbGroup + group + 1];
+
+    return { this->neighbours_.data() + begin, end - begin };
+}
+
+template<class Scalar>
+void PAvgCalculator<Scalar>::gatherCellSources(const Sources& sources)
+{
+    using Item = typename PAvgDynamicSourceData<Scalar>::
+        template SourceDataSpan<const Scalar>::Item;
+
+    const auto ncell = this->contributingCells_.size();
 
-    neighbours.push_back(localCellPos->second);
+    this->cellSrc_.pressure      .resize(ncell);
+    this->cellSrc_.mixtureDensity.resize(ncell);
+    this->cellSrc_.poreVol       .resize(ncell);
+    this->cellSrc_.depth         .resize(ncell);
+
+    const auto& wbSrc = sources.wellBlocks();
+
+    for (auto i = 0*ncell; i < ncell; ++i) {
+        const auto src = wbSrc[this->contributingCells_[i]];
+
+        this->cellSrc_.pressure[i]       = src[Item::Pressure];
+        this->cellSrc_.mixtureDensity[i] = src[Item::MixtureDensity];
+        this->cellSrc_.poreVol[i]        = src[Item::PoreVol];
+        this->cellSrc_.depth[i]          = src[Item::Depth];
+    }
 }
 
 template<class Scalar>
@@ -899,15 +945,17 @@ addNeighbours_X(const GridDims& cellIndexMap, SetupMap& setupHelperMap)
 {
     const auto& [i, j, k] = cellIndexMap.getIJK(this->lastConnsCell());
 
-    this->addNeighbour(globalCellIndex(cellIndexMap, i,j  ,k+1), NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i,j  ,k-1), NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i,j+1,k),   NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i,j-1,k),   NeighbourKind::Rectangular, setupHelperMap);
-
-    this->addNeighbour(globalCellIndex(cellIndexMap, i,j+1,k+1), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i,j+1,k-1), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i,j-1,k+1), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i,j-1,k-1), NeighbourKind::Diagonal, setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i,j  ,k+1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i,j  ,k-1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i,j+1,k),   setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i,j-1,k),   setupHelperMap);
+    this->closeNeighbourGroup();
+
+    this->addNeighbour(globalCellIndex(cellIndexMap, i,j+1,k+1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i,j+1,k-1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i,j-1,k+1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i,j-1,k-1), setupHelperMap);
+    this->closeNeighbourGroup();
 }
 
 template<class Scalar>
@@ -916,15 +964,17 @@ addNeighbours_Y(const GridDims& cellIndexMap, SetupMap& setupHelperMap)
 {
     const auto& [i, j, k] = cellIndexMap.getIJK(this->lastConnsCell());
 
-    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j,k),   NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j,k),   NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i  ,j,k+1), NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i  ,j,k-1), NeighbourKind::Rectangular, setupHelperMap);
-
-    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j,k+1), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j,k+1), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j,k-1), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j,k-1), NeighbourKind::Diagonal, setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j,k),   setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j,k),   setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i  ,j,k+1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i  ,j,k-1), setupHelperMap);
+    this->closeNeighbourGroup();
+
+    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j,k+1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j,k+1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j,k-1), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j,k-1), setupHelperMap);
+    this->closeNeighbourGroup();
 }
 
 template<class Scalar>
@@ -933,22 +983,23 @@ addNeighbours_Z(const GridDims& cellIndexMap, SetupMap& setupHelperMap)
 {
     const auto& [i, j, k] = cellIndexMap.getIJK(this->lastConnsCell());
 
-    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j  ,k), NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j  ,k), NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i  ,j+1,k), NeighbourKind::Rectangular, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i  ,j-1,k), NeighbourKind::Rectangular, setupHelperMap);
-
-    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j+1,k), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j+1,k), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j-1,k), NeighbourKind::Diagonal, setupHelperMap);
-    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j-1,k), NeighbourKind::Diagonal, setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j  ,k), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j  ,k), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i  ,j+1,k), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i  ,j-1,k), setupHelperMap);
+    this->closeNeighbourGroup();
+
+    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j+1,k), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j+1,k), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i+1,j-1,k), setupHelperMap);
+    this->addNeighbour(globalCellIndex(cellIndexMap, i-1,j-1,k), setupHelperMap);
+    this->closeNeighbourGroup();
 }
 
 template<class Scalar>
 template <typename ConnIndexMap, typename CTFPressureWeightFunction>
 void PAvgCalculator<Scalar>::
-accumulateLocalContributions(const Sources&             sources,
-                             const PAvg&                controls,
+accumulateLocalContributions(const PAvg&                controls,
                              const Scalar               gravity,
                              const Scalar               refDepth,
                              const std::vector<Scalar>& connDensity,
@@ -968,24 +1019,22 @@ accumulateLocalContributions(const Sources&             sources,
     // Intermediate, per connection results pertaining to CTF-weighted sum.
     auto accumCTF_c = Accumulator{};
 
-    auto addContrib = [gravity, refDepth, &sources, &ctfPressWeight, &accumCTF_c, this]
+    const auto& cellSrc = this->cellSrc_;
+
+    auto addContrib = [gravity, refDepth, &cellSrc, &ctfPressWeight, &accumCTF_c, this]
         (const ContrIndexType i, const Scalar density, PressureTermHandler handler)
     {
-        using Item = typename PAvgDynamicSourceData<Scalar>::
-            template SourceDataSpan<const Scalar>::Item;
-
-        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
-        const auto p   = src[Item::Pressure] +
-            pressureOffset(density, src[Item::Depth], gravity, refDepth);
+        const auto p = cellSrc.pressure[i] +
+            pressureOffset(density, cellSrc.depth[i], gravity, refDepth);
 
         // Use std::invoke() to simplify the calling syntax here.
-        std::invoke(handler, accumCTF_c    , ctfPressWeight(src), p);
-        std::invoke(handler, this->accumPV_, src[Item::PoreVol] , p);
+        std::invoke(handler, accumCTF_c    , ctfPressWeight(cellSrc, i), p);
+        std::invoke(handler, this->accumPV_, cellSrc.poreVol[i]        , p);
     };
 
     const auto handlers = std::array {
-        std::pair { &PAvgConnection::rectNeighbours, &Accumulator::addRectangular },
-        std::pair { &PAvgConnection::diagNeighbours, &Accumulator::addDiagonal },
+        std::pair { 0, &Accumulator::addRectangular },
+        std::pair { 1, &Accumulator::addDiagonal },
     };
 
     const auto nconn = connDensity.size();
@@ -999,8 +1048,8 @@ accumulateLocalContributions(const Sources&             sources,
         addContrib(conn.cell, connDensity[connID], &Accumulator::addCentre);
 
         // 2) Connecting cell's neighbours.
-        for (const auto& [neighbours, handler] : handlers) {
-            for (const auto& neighIdx : conn.*neighbours) {
+        for (const auto& [group, handler] : handlers) {
+            for (const auto& neighIdx : this->neighbours(conn, group)) {
                 addContrib(neighIdx, connDensity[connID], handler);
             }
         }
@@ -1019,8 +1068,7 @@ accumulateLocalContributions(const Sources&             sources,
 template<class Scalar>
 template <typename ConnIndexMap>
 void PAvgCalculator<Scalar>::
-accumulateLocalContributions(const Sources&             sources,
-                             const PAvg&                controls,
+accumulateLocalContributions(const PAvg&                controls,
                              const Scalar               gravity,
                              const Scalar               refDepth,
                              const std::vector<Scalar>& connDensity,
@@ -1030,41 +1078,36 @@ accumulateLocalContributions(const Sources&             sources,
         // F1 < 0 => pore-volume weighting of individual cell contributions,
         // no weighting when commiting term.
 
-        this->accumulateLocalContributions(sources, controls,
+        this->accumulateLocalContributions(controls,
                                            gravity, refDepth, connDensity,
                                            std::forward<ConnIndexMap>(connIndex),
-                                           [](const auto& src)
-                                           {
-                                               using Span = std::remove_cv_t<
-                                                   std::remove_reference_t<decltype(src)>>;
-                                               using Item = typename Span::Item;
-
-                                               return src[Item::PoreVol];
-                                           });
+                                           [](const GatheredCellSources& cellSrc,
+                                              const ContrIndexType       i)
+                                           { return cellSrc.poreVol[i]; });
     }
     else {
         // F1 >= 0 => unit weighting of individual cell contributions,
         // F1-weighting when committing term.
 
-        this->accumulateLocalContributions(sources, controls,
+        this->accumulateLocalContributions(controls,
                                            gravity, refDepth, connDensity,
                                            std::forward<ConnIndexMap>(connIndex),
-                                           [](const auto&)
+                                           [](const GatheredCellSources&,
+                                              const ContrIndexType)
                                            { return static_cast<Scalar>(1.0); });
     }
 }
 
 template<class Scalar>
 void PAvgCalculator<Scalar>::
-accumulateLocalContribOpen(const Sources&             sources,
-                           const PAvg&                controls,
+accumulateLocalContribOpen(const PAvg&                controls,
                            const Scalar               gravity,
                            const Scalar               refDepth,
                            const std::vector<Scalar>& connDensity)
 {
     assert (connDensity.size() == this->openConns_.size());
 
-    this->accumulateLocalContributions(sources, controls,
+    this->accumulateLocalContributions(controls,
                                        gravity, refDepth, connDensity,
                                        [this](const auto i)
                                        { return this->openConns_[i]; });
@@ -1072,15 +1115,14 @@ accumulateLocalContribOpen(const Sources&             sources,
 
 template<class Scalar>
 void PAvgCalculator<Scalar>::
-accumulateLocalContribAll(const Sources&             sources,
-                          const PAvg&                controls,
+accumulateLocalContribAll(const PAvg&                controls,
                           const Scalar               gravity,
                           const Scalar               refDepth,
                           const std::vector<Scalar>& connDensity)
 {
     assert (connDensity.size() == this->connections_.size());
 
-    this->accumulateLocalContributions(sources, controls,
+    this->accumulateLocalContributions(controls,
                                        gravity, refDepth, connDensity,
                                        [](const auto i) { return i; });
 }
@@ -1110,26 +1152,16 @@ template<class Scalar>
 template <typename ConnIndexMap>
 std::vector<Scalar> PAvgCalculator<Scalar>::
 connectionDensityRes(const std::size_t nconn,
-                     const Sources&    sources,
                      ConnIndexMap      connIndex) const
 {
     auto connDensity = std::vector<Scalar>(nconn);
 
-    const auto neighList = std::array {
-        &PAvgConnection::rectNeighbours,
-        &PAvgConnection::diagNeighbours,
-    };
-
     auto density = WeightedRunningAverage<Scalar, Scalar>{};
 
-    auto includeDensity = [this, &sources, &density](const ContrIndexType i)
+    auto includeDensity = [this, &density](const ContrIndexType i)
     {
-        using Item = typename PAvgDynamicSourceData<Scalar>::
-            template SourceDataSpan<const Scalar>::Item;
-
-        const auto src = sources.wellBlocks()[this->contributingCells_[i]];
-
-        density.add(src[Item::MixtureDensity], src[Item::PoreVol]);
+        density.add(this->cellSrc_.mixtureDensity[i],
+                    this->cellSrc_.poreVol[i]);
     };
 
     for (auto connID = 0*nconn; connID < nconn; ++connID) {
@@ -1139,8 +1171,8 @@ connectionDensityRes(const std::size_t nconn,
 
         includeDensity(conn.cell);
 
-        for (const auto& neighbours : neighList) {
-            for (const auto& neighIdx : conn.*neighbours) {
+        for (const auto group : { 0, 1 }) {
+            for (const auto& neighIdx : this->neighbours(conn, group)) {
                 includeDensity(neighIdx);
             }
         }
@@ -1175,11 +1207,11 @@ connectionDensity(const Sources& sources,
 
     if (controls.depth_correction() == PAvg::DepthCorrection::RES) {
         if (! controls.open_connections()) {
-            return this->connectionDensityRes(nconn, sources,
+            return this->connectionDensityRes(nconn,
                                               [](const auto i) { return i; });
         }
 
-        return this->connectionDensityRes(nconn, sources,
+        return this->connectionDensityRes(nconn,
                                           [this](const auto i)
                                           { return this->openConns_[i]; });
     }
@@ -25,6 +25,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -35,6 +36,7 @@ namespace Opm {
 class Connection;
 class GridDims;
 class PAvg;
+template<class Scalar> class PAvgCalculatorCollection;
 template<class Scalar> class PAvgDynamicSourceData;
 class WellConnections;
 
@@ -136,6 +138,10 @@ private:
 template<class Scalar>
 class PAvgCalculator
 {
+    /// Grant collection access to the individual calculation stages in
+    /// order to run the local accumulation for all wells in one pass.
+    friend class PAvgCalculatorCollection<Scalar>;
+
 protected:
     class Accumulator;
 
@@ -401,16 +407,6 @@ private:
     /// Only used during construction/setup.
     using SetupMap = std::unordered_map<std::size_t, ContrIndexType>;
 
-    /// Type of neighbour of connection's connecting cell.
-    enum class NeighbourKind
-    {
-        /// Neighbour is of the direct, rectangular, level 1 kind.
-        Rectangular,
-
-        /// Neighbour is of the diagonal level 2 kind.
-        Diagonal,
-    };
-
     /// Well's reservoir connection, stripped to hold only information
     /// necessary to infer block-averaged pressures.
     struct PAvgConnection
@@ -435,15 +431,39 @@ private:
         /// Index into \c contributingCells_ of connection's cell.
         ContrIndexType cell{};
 
-        /// Connecting cell's immediate (level-1) neighbours
-        ///   ((i-1,j), (i+1,j), (i,j-1), and (i,j+1))
-        /// Indices into \c contributingCells_.
-        std::vector<ContrIndexType> rectNeighbours{};
+        /// Index into \c neighbourStart_ of connection's neighbour groups.
+        ///
+        /// Connecting cell's immediate (level-1) neighbours, i.e.,
+        /// ((i-1,j), (i+1,j), (i,j-1), and (i,j+1)), are
+        ///
+        ///   neighbours_[neighbourStart_[nbGroup + 0] .. neighbourStart_[nbGroup + 1])
+        ///
+        /// while the connecting cell's diagonal (level-2) neighbours, i.e.,
+        /// ((i-1,j-1), (i+1,j-1), (i-1,j+1), and (i+1,j+1)), are
+        ///
+        ///   neighbours_[neighbourStart_[nbGroup + 1] .. neighbourStart_[nbGroup + 2])
+        typename std::vector<ContrIndexType>::size_type nbGroup{};
+    };
 
-        /// Connecting cell's diagnoal (level-2) neighbours
-        ///   ((i-1,j-1), (i+1,j-1), (i-1,j+1), and (i+1,j+1))
-        /// Indices into \c contributingCells_.
-        std::vector<ContrIndexType> diagNeighbours{};
+    /// Cell-level source terms gathered into contributing cell order.
+    ///
+    /// Element \c i of each vector holds the value pertaining to cell \code
+    /// contributingCells_[i] \endcode.  Populated once for each call to
+    /// \code inferBlockAveragePressures() \endcode, whence all subsequent
+    /// accumulation is simple indexed loads.
+    struct GatheredCellSources
+    {
+        /// Cell pressure values.
+        std::vector<Scalar> pressure{};
+
+        /// Cell mixture densities.
+        std::vector<Scalar> mixtureDensity{};
+
+        /// Cell pore volumes.
+        std::vector<Scalar> poreVol{};
+
+        /// Cell centre depths.
+        std::vector<Scalar> depth{};
     };
 
     /// Number of input connections.
@@ -472,6 +492,23 @@ private:
     /// to this block-average well pressure calculation.
     std::vector<std::size_t> contributingCells_{};
 
+    /// Start pointers, in compressed sparse row format, of the
+    /// connections' neighbour groups.
+    ///
+    /// Two groups--rectangular and diagonal--for each connection, in
+    /// connection order.  See \c PAvgConnection::nbGroup.
+    std::vector<ContrIndexType> neighbourStart_{0};
+
+    /// Neighbouring cells of all connections' connecting cells.  Indices
+    /// into \c contributingCells_.
+    std::vector<ContrIndexType> neighbours_{};
+
+    /// Cell-level source terms in contributing cell order.
+    ///
+    /// Buffer reused across calls to \code inferBlockAveragePressures()
+    /// \endcode.
+    GatheredCellSources cellSrc_{};
+
     /// Well level pressure values derived from block-averaging procedures.
     ///
     /// Cached end result from \code inferBlockAveragePressures() \endcode.
@@ -510,7 +547,8 @@ private:
     ///
     /// Will dispatch to lower-level entry points depending on control's
     /// flag for whether to average over the set of open or the set of all
-    /// reservoir connections.  Writes to \c accumCTF_ and \c accumPV_.
+    /// reservoir connections.  Writes to \c cellSrc_, \c accumCTF_, and
+    /// \c accumPV_.
     ///
     /// \param[in] sources Connection and cell-level raw data.
     ///
@@ -547,23 +585,43 @@ private:
     /// Include individual neighbour of currently latest connection's
     /// connecting cell into known cell set.
     ///
-    /// Writes to \code connections_.back() \endcode and \c
-    /// contributingCells_.
+    /// Writes to \c neighbours_ and \c contributingCells_.
     ///
     /// \param[in] neighbour Global, linearised cell index.  Nullopt if
     ///    neighbour happens to be in an inactive cell or outside the
     ///    model's Cartesian dimensions.  In that case, no change is made to
     ///    any data member.
     ///
-    /// \param[in] neighbourKind Classification for \p neighbour.
-    ///
     /// \param[inout] setupHelperMap Translation between linearised global
     ///   cell indices and enumerated local contributing cells.  Updated as
     ///   new contributing cells are discovered.
     void addNeighbour(std::optional<std::size_t> neighbour,
-                      NeighbourKind              neighbourKind,
                       SetupMap&                  setupHelperMap);
 
+    /// Terminate current neighbour group of currently latest connection.
+    ///
+    /// Writes to \c neighbourStart_.
+    void closeNeighbourGroup();
+
+    /// Get neighbour group of single connection.
+    ///
+    /// \param[in] conn Reservoir connection.
+    ///
+    /// \param[in] group Group index.  Zero for the rectangular (level 1)
+    ///   neighbours and one for the diagonal (level 2) neighbours.
+    ///
+    /// \return Neighbouring cells in group.  Indices into \c
+    ///   contributingCells_.
+    std::span<const ContrIndexType>
+    neighbours(const PAvgConnection& conn, const int group) const;
+
+    /// Extract cell-level source terms for all contributing cells.
+    ///
+    /// Writes to \c cellSrc_.
+    ///
+    /// \param[in] sources Connection and cell-level raw data.
+    void gatherCellSources(const Sources& sources);
+
     /// Global index of currently latest connection's connecting cell.
     ///
     /// Convenience function for inferring connecting cell's IJK index.
@@ -572,7 +630,7 @@ private:
     /// Include all level 1 and level 2 neighbours orthogonal to X axis of
     /// currently latest connection's connecting cell into known cell set.
     ///
-    /// Writes to \code connections_.back() \endcode and \c
+    /// Writes to \c neighbours_, \c neighbourStart_, and \c
     /// contributingCells_.
     ///
     /// \param[in] grid Collection of active cells.
@@ -585,7 +643,7 @@ private:
     /// Include all level 1 and level 2 neighbours orthogonal to Y axis of
     /// currently latest connection's connecting cell into known cell set.
     ///
-    /// Writes to \code connections_.back() \endcode and \c
+    /// Writes to \c neighbours_, \c neighbourStart_, and \c
     /// contributingCells_.
     ///
     /// \param[in] grid Collection of active cells.
@@ -598,7 +656,7 @@ private:
     /// Include all level 1 and level 2 neighbours orthogonal to Z axis of
     /// currently latest connection's connecting cell into known cell set.
     ///
-    /// Writes to \code connections_.back() \endcode and \c
+    /// Writes to \c neighbours_, \c neighbourStart_, and \c
     /// contributingCells_.
     ///
     /// \param[in] grid Collection of active cells.
@@ -626,17 +684,15 @@ private:
     ///   weighting values for the CTF-weighted connection contributions.
     ///   Must provide a call operator such that
     /// \code
-    ///   double w = weight(src)
+    ///   double w = weight(cellSrc, i)
     /// \endcode
     ///   is well formed for an object \c weight of type \p
-    ///   CTFPressureWeightFunction and a \c src object of type \code
-    ///   PAvgDynamicSourceData::SourceDataSpan<const double> \endcode.
-    ///   Will typically be a lambda that returns the pore volume in \c src
+    ///   CTFPressureWeightFunction, a \c cellSrc object of type \c
+    ///   GatheredCellSources and a contributing cell index \c i.  Will
+    ///   typically be a lambda that returns the pore volume of cell \c i
     ///   if the weighting factor F1 in WPAVE is negative, or a lambda that
     ///   just returns the number one (1.0) otherwise.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
@@ -654,8 +710,7 @@ private:
     /// \param[in] ctfPressWeight Pressure weighting method for CTF term's
     ///   individual contributions.
     template <typename ConnIndexMap, typename CTFPressureWeightFunction>
-    void accumulateLocalContributions(const Sources&             sources,
-                                      const PAvg&                controls,
+    void accumulateLocalContributions(const PAvg&                controls,
                                       const Scalar               gravity,
                                       const Scalar               refDepth,
                                       const std::vector<Scalar>& connDensity,
@@ -684,8 +739,6 @@ private:
     ///   identity mapping \code [](i){return i} \endcode or the open
     ///   connection mapping \code [](i){return openConns_[i]} \endcode.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
@@ -700,8 +753,7 @@ private:
     /// \param[in] connIndex Translation method from active connection index
     ///   to index into all known reservoir connections.
     template <typename ConnIndexMap>
-    void accumulateLocalContributions(const Sources&             sources,
-                                      const PAvg&                controls,
+    void accumulateLocalContributions(const PAvg&                controls,
                                       const Scalar               gravity,
                                       const Scalar               refDepth,
                                       const std::vector<Scalar>& connDensity,
@@ -712,8 +764,6 @@ private:
     ///
     /// Invokes final dispatch level on set of open connections only.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
@@ -724,8 +774,7 @@ private:
     ///
     /// \param[in] connDensity Mixture density for pressure correction term
     ///   for each reservoir connection.
-    void accumulateLocalContribOpen(const Sources&             sources,
-                                    const PAvg&                controls,
+    void accumulateLocalContribOpen(const PAvg&                controls,
                                     const Scalar               gravity,
                                     const Scalar               refDepth,
                                     const std::vector<Scalar>& connDP);
@@ -735,8 +784,6 @@ private:
     ///
     /// Invokes final dispatch level on set of all known connections.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] controls Averaging procedure controls.
     ///
     /// \param[in] gravity Strength of gravity in SI units [m/s^2].
@@ -747,8 +794,7 @@ private:
     ///
     /// \param[in] connDensity Mixture density for pressure correction term
     ///   for each reservoir connection.
-    void accumulateLocalContribAll(const Sources&             sources,
-                                   const PAvg&                controls,
+    void accumulateLocalContribAll(const PAvg&                controls,
                                    const Scalar               gravity,
                                    const Scalar               refDepth,
                                    const std::vector<Scalar>& connDensity);
@@ -787,7 +833,8 @@ private:
     /// Compute connection level mixture density using Reservoir method
     ///
     /// Uses pore-volume weighted mixture density from connecting cell and
-    /// its level 1 and level 2 neighbours.
+    /// its level 1 and level 2 neighbours.  Reads cell-level values from
+    /// \c cellSrc_.
     ///
     /// \tparam ConnIndexMap Callable type translating from requested set of
     ///   connections to linear index into all known reservoir connections.
@@ -803,8 +850,6 @@ private:
     ///
     /// \param[in] nconn Number of elements in active connection subset.
     ///
-    /// \param[in] sources Connection and cell-level raw data.
-    ///
     /// \param[in] connIndex Translation method from active connection index
     ///   to index into all known reservoir connections.
     ///
@@ -813,7 +858,6 @@ private:
     template <typename ConnIndexMap>
     std::vector<Scalar>
     connectionDensityRes(const std::size_t nconn,
-                         const Sources&    sources,
                          ConnIndexMap      connIndex) const;
 
     /// Top-level entry point for computing connection level mixture
@@ -19,10 +19,13 @@
 
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculatorCollection.hpp>
 
+#include <opm/input/eclipse/Schedule/Well/PAvg.hpp>
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <stdexcept>
 #include <string>
@@ -125,6 +128,40 @@ allWBPCells() const
     return { wbpCells.begin(), std::unique(wbpCells.begin(), wbpCells.end()) };
 }
 
+template<class Scalar>
+void PAvgCalculatorCollection<Scalar>::
+inferBlockAveragePressures(const std::vector<typename PAvgCalculator<Scalar>::Sources>& sources,
+                           const std::vector<PAvg>&   controls,
+                           const Scalar               gravity,
+                           const std::vector<Scalar>& refDepth)
+{
+    assert (sources .size() == this->calculators_.size());
+    assert (controls.size() == this->calculators_.size());
+    assert (refDepth.size() == this->calculators_.size());
+
+    const auto numCalc = static_cast<std::int64_t>(this->calculators_.size());
+
+    // Local accumulation touches calculator-private state only and is
+    // therefore safe to run concurrently across wells.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::int64_t calcIx = 0; calcIx < numCalc; ++calcIx) {
+        this->calculators_[calcIx]->
+            accumulateLocalContributions(sources[calcIx], controls[calcIx],
+                                         gravity, refDepth[calcIx]);
+    }
+
+    // Global contributions may entail communication and must therefore be
+    // collected in a fixed order on all ranks.
+    for (std::int64_t calcIx = 0; calcIx < numCalc; ++calcIx) {
+        auto& calculator = *this->calculators_[calcIx];
+
+        calculator.collectGlobalContributions();
+        calculator.assignResults(controls[calcIx]);
+    }
+}
+
 template class PAvgCalculatorCollection<double>;
 template class PAvgCalculatorCollection<float>;
 
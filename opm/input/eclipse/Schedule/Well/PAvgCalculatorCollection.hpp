@@ -20,6 +20,8 @@
 #ifndef PAVE_CALC_COLLECTIONHPP
 #define PAVE_CALC_COLLECTIONHPP
 
+#include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
+
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -27,7 +29,7 @@
 #include <vector>
 
 namespace Opm {
-    template<class Scalar> class PAvgCalculator;
+    class PAvg;
 } // namespace Opm
 
 namespace Opm {
@@ -125,6 +127,32 @@ public:
     /// Mainly intended to configure \c PAvgDynamicSourceData objects.
     std::vector<std::size_t> allWBPCells() const;
 
+    /// Compute block-average well-level pressure values for all wells in
+    /// collection.
+    ///
+    /// Equivalent to calling \code inferBlockAveragePressures() \endcode
+    /// on each individual calculation object, but runs the local
+    /// accumulation stage for all wells in a single, possibly
+    /// multi-threaded, pass before collecting global contributions and
+    /// forming the final results in calculator order.  Results are
+    /// identical to the individual calls.
+    ///
+    /// \param[in] sources Connection and cell-level raw data for each
+    ///   calculation object.  Indexed by calculator index.
+    ///
+    /// \param[in] controls Averaging procedure controls for each
+    ///   calculation object.  Indexed by calculator index.
+    ///
+    /// \param[in] gravity Strength of gravity in SI units [m/s^2].
+    ///
+    /// \param[in] refDepth Reference depth for block-average pressure
+    ///   calculation of each calculation object.  Indexed by calculator
+    ///   index.
+    void inferBlockAveragePressures(const std::vector<typename PAvgCalculator<Scalar>::Sources>& sources,
+                                    const std::vector<PAvg>&   controls,
+                                    const Scalar               gravity,
+                                    const std::vector<Scalar>& refDepth);
+
 private:
     /// Representation of calculator indices.
     using CalcIndex = typename std::vector<CalculatorPtr>::size_type;
@@ -1536,17 +1536,10 @@ bool Well::handleWELOPENConnections(const DeckRecord&       record,
         return true;
     };
 
-    auto new_connections = std::make_shared<WellConnections>
-        (this->connections->ordering(), this->headI, this->headJ);
-
-    for (const auto& connection : *this->connections) {
-        if (! match(connection)) {
-            // No state change needed here.  Include connection as-is into
-            // new connection set.
-            new_connections->add(connection);
-            continue;
-        }
+    auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
+    new_connections->updateSelected(match, [&](Connection& connection)
+    {
         if (state_arg == Connection::State::OPEN) {
             // Report connections requested to open so the caller can raise a
             // REQUEST_OPEN_COMPLETION event (see WellConnections::loadCOMPDATX
@@ -1560,11 +1553,8 @@ bool Well::handleWELOPENConnections(const DeckRecord&       record,
             requested_shut_complnums.push_back(connection.complnum());
         }
 
-        auto connection_copy = connection;
-        connection_copy.setState(state_arg);
-
-        new_connections->add(connection_copy);
-    }
+        connection.setState(state_arg);
+    });
 
     return this->updateConnections(std::move(new_connections), false);
 }
@@ -1585,20 +1575,12 @@ bool Well::handleCSKIN(const DeckRecord&      record,
 
     // New connection set which will be updated with new connection level
     // skin factors.
-    auto new_connections = std::make_shared<WellConnections>
-        (this->connections->ordering(), this->headI, this->headJ);
+    auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
     const auto skin_factor = record.getItem<Kw::CONNECTION_SKIN_FACTOR>().getSIDouble(0);
-    for (const auto& connection : *this->connections) {
-        if (! need_skin_adjustment(connection)) {
-            // No CSKIN adjustment needed here.  Include connection as-is
-            // into new connection set.
-            new_connections->add(connection);
-            continue;
-        }
-
-        // If we get here, we must make the connection's skin factor be
-        // 'skin_factor'.
+    new_connections->updateSelected(need_skin_adjustment, [&](Connection& connection)
+    {
+        // Make the connection's skin factor be 'skin_factor'.
         //
         // First guard against this adjustment making the CTF go negative,
         // typically because the 'skin_factor' value is large and negative
@@ -1619,11 +1601,8 @@ bool Well::handleCSKIN(const DeckRecord&      record,
             };
         }
 
-        auto connection_copy = connection;
-        connection_copy.setSkinFactor(skin_factor);
-
-        new_connections->add(connection_copy);
-    }
+        connection.setSkinFactor(skin_factor);
+    });
 
     return this->updateConnections(std::move(new_connections), false);
 }
@@ -1650,21 +1629,11 @@ bool Well::handleCECON(const DeckRecord&      record,
 
     const auto connection_econ_limits = ConnectionEconLimits { record };
 
-    auto new_connections = std::make_shared<WellConnections>
-        (this->connections->ordering(), this->headI, this->headJ);
+    auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
-    bool matched_any = false;
-    for (const auto& connection : *this->connections) {
-        if (!need_econ_limits(connection)) {
-            new_connections->add(connection);
-            continue;
-        }
-
-        matched_any = true;
-        auto connection_copy = connection;
-        connection_copy.setEconLimits(connection_econ_limits);
-        new_connections->add(connection_copy);
-    }
+    const bool matched_any = new_connections->
+        updateSelected(need_econ_limits, [&connection_econ_limits](Connection& connection)
+        { connection.setEconLimits(connection_econ_limits); });
 
     // Diagnose a connection set that did not select anything.
     if (!matched_any) {
@@ -1698,8 +1667,7 @@ bool Well::handleCOMPLUMP(const DeckRecord& record)
         return true;
     };
 
-    auto new_connections = std::make_shared<WellConnections>
-        (this->connections->ordering(), this->headI, this->headJ);
+    auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
     const int complnum = record.getItem("N").get<int>(0);
     if (complnum <= 0) {
@@ -1708,17 +1676,8 @@ bool Well::handleCOMPLUMP(const DeckRecord& record)
         };
     }
 
-    for (const auto& connection : *this->connections) {
-        if (! match(connection)) {
-            new_connections->add(connection);
-            continue;
-        }
-
-        auto connection_copy = connection;
-        connection_copy.setComplnum(complnum);
-
-        new_connections->add(connection_copy);
-    }
+    new_connections->updateSelected(match, [complnum](Connection& connection)
+    { connection.setComplnum(complnum); });
 
     return this->updateConnections(std::move(new_connections), false);
 }
@@ -1735,22 +1694,12 @@ bool Well::handleWPIMULT(const DeckRecord& record)
         return true;
     };
 
-    auto new_connections = std::make_shared<WellConnections>
-        (this->connections->ordering(), this->headI, this->headJ);
+    auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
     const auto wellPi = record.getItem("WELLPI").get<double>(0);
 
-    for (const auto& connection : *this->connections) {
-        if (! match(connection)) {
-            new_connections->add(connection);
-            continue;
-        }
-
-        auto connection_copy = connection;
-        connection_copy.scaleWellPi(wellPi);
-
-        new_connections->add(connection_copy);
-    }
+    new_connections->updateSelected(match, [wellPi](Connection& connection)
+    { connection.scaleWellPi(wellPi); });
 
     return this->updateConnections(std::move(new_connections), false);
 }
@@ -1777,23 +1726,15 @@ bool Well::handleWINJCLN(const DeckRecord& record, const KeywordLocation& locati
         return true;
     };
 
-    auto new_connections = std::make_shared<WellConnections>
-        (this->connections->ordering(), this->headI, this->headJ);
-
-    for (const auto& connection : *this->connections) {
-        if (! match(connection)) {
-            new_connections->add(connection);
-            continue;
-        }
+    auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
+    new_connections->updateSelected(match, [fraction_removal](Connection& connection)
+    {
         auto filter_cake = connection.getFilterCake();
         filter_cake.applyCleanMultiplier(1.0 - fraction_removal);
 
-        auto connection_copy = connection;
-        connection_copy.setFilterCake(filter_cake);
-
-        new_connections->add(connection_copy);
-    }
+        connection.setFilterCake(filter_cake);
+    });
 
     return this->updateConnections(std::move(new_connections), false);
 }
@@ -1810,20 +1751,10 @@ bool Well::handleWINJDAM(const DeckRecord& record, const KeywordLocation& locati
 
     const FilterCake filter_cake {record, location};
 
-    auto new_connections = std::make_shared<WellConnections>
-        (this->connections->ordering(), this->headI, this->headJ);
-
-    for (const auto& connection : *this->connections) {
-        if (! match(connection)) {
-            new_connections->add(connection);
-            continue;
-        }
+    auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
-        auto connection_copy = connection;
-        connection_copy.setFilterCake(filter_cake);
-
-        new_connections->add(connection_copy);
-    }
+    new_connections->updateSelected(match, [&filter_cake](Connection& connection)
+    { connection.setFilterCake(filter_cake); });
 
     return this->updateConnections(std::move(new_connections), false);
 }
@@ -1873,20 +1804,10 @@ bool Well::handleWINJMULT(const Opm::DeckRecord& record, const KeywordLocation&
     else if ((mode == InjMultMode::CREV) ||
              (mode == InjMultMode::CIRR))
     {
-        auto new_connections = std::make_shared<WellConnections>
-            (this->connections->ordering(), this->headI, this->headJ);
-
-        for (const auto& connection : *this->connections) {
-            if (! match(connection)) {
-                new_connections->add(connection);
-                continue;
-            }
+        auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
-            auto connection_copy = connection;
-            connection_copy.setInjMult(inj_mult);
-
-            new_connections->add(connection_copy);
-        }
+        new_connections->updateSelected(match, [&inj_mult](Connection& connection)
+        { connection.setInjMult(inj_mult); });
 
         connections_update = this->updateConnections(std::move(new_connections), false);
     }
@@ -1897,15 +1818,11 @@ bool Well::handleWINJMULT(const Opm::DeckRecord& record, const KeywordLocation&
 
 bool Opm::Well::applyGlobalWPIMULT(const double scaling_factor)
 {
-    auto new_connections = std::make_shared<WellConnections>
-        (this->connections->ordering(), this->headI, this->headJ);
+    auto new_connections = std::make_shared<WellConnections>(*this->connections);
 
-    for (const auto& connection : *this->connections) {
-        auto connection_copy = connection;
-
-        connection_copy.scaleWellPi(scaling_factor);
-        new_connections->add(connection_copy);
-    }
+    new_connections->updateSelected([](const Connection&) { return true; },
+                                    [scaling_factor](Connection& connection)
+                                    { connection.scaleWellPi(scaling_factor); });
 
     return this->updateConnections(std::move(new_connections), false);
 }
@@ -357,9 +357,15 @@ namespace Opm {
 
     bool WellConnections::prepareWellPIScaling()
     {
+        // Copy before modifying to avoid unsharing the storage of
+        // connections that are already subject to WELPI scaling.
         auto update = false;
-        for (auto& conn : this->m_connections) {
-            update = conn.prepareWellPIScaling() || update;
+        for (auto connIx = 0*this->m_connections.size(); connIx < this->m_connections.size(); ++connIx) {
+            auto conn = std::as_const(this->m_connections)[connIx];
+            if (conn.prepareWellPIScaling()) {
+                this->m_connections[connIx] = std::move(conn);
+                update = true;
+            }
         }
 
         return update;
@@ -370,13 +376,16 @@ namespace Opm {
     {
         scalingApplicable.resize(std::max(scalingApplicable.size(), this->m_connections.size()), true);
 
-        auto i = std::size_t{0};
-        for (auto& conn : this->m_connections) {
-            if (scalingApplicable[i]) {
-                scalingApplicable[i] = conn.applyWellPIScaling(scaleFactor);
+        for (auto i = 0*this->m_connections.size(); i < this->m_connections.size(); ++i) {
+            if (! scalingApplicable[i]) {
+                continue;
             }
 
-            ++i;
+            auto conn = std::as_const(this->m_connections)[i];
+            scalingApplicable[i] = conn.applyWellPIScaling(scaleFactor);
+            if (scalingApplicable[i]) {
+                this->m_connections[i] = std::move(conn);
+            }
         }
     }
 
@@ -622,11 +631,11 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
             ctf_props.static_dfac_corr_coeff =
                 staticForchheimerCoefficient(ctf_props, props->poro, wdfac);
 
-            const auto prev = std::ranges::find_if(this->m_connections,
+            const auto prev = std::ranges::find_if(std::as_const(this->m_connections),
                                                   [I, J, k](const Connection& c)
                                                   { return c.sameCoordinate(I, J, k); });
 
-            if (prev == this->m_connections.end()) {
+            if (prev == this->m_connections.cend()) {
                 const std::size_t noConn = this->m_connections.size();
                 this->addConnection(I, J, k, cell.global_index, state,
                                     cell.depth, ctf_props, satTableId,
@@ -656,14 +665,15 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
                     requested_shut_complnums.push_back(compl_num);
                 }
 
-                *prev = Connection {
+                auto& conn = this->m_connections[prev - this->m_connections.cbegin()];
+                conn = Connection {
                     I, J, k, cell.global_index, compl_num,
                     state, direction, ctf_kind, satTableId,
                     cell.depth, ctf_props,
                     css_ind, defaultSatTable, lgr_grid_number
                 };
 
-                prev->updateSegment(conSegNo, cell.depth, css_ind, perf_range);
+                conn.updateSegment(conSegNo, cell.depth, css_ind, perf_range);
             }
         }
     }
@@ -895,11 +905,11 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
             }
 
             const auto prev =
-                std::ranges::find_if(this->m_connections,
+                std::ranges::find_if(std::as_const(this->m_connections),
                                      [&ijk](const Connection& c)
                                      { return c.sameCoordinate(ijk[0], ijk[1], ijk[2]); });
 
-            if (prev == this->m_connections.end()) {
+            if (prev == this->m_connections.cend()) {
                 const std::size_t noConn = this->m_connections.size();
                 this->addConnection(ijk[0], ijk[1], ijk[2],
                                     cell.global_index, state,
@@ -914,7 +924,8 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
                 const auto conSegNo = prev->segment();
                 const auto perf_range = prev->perf_range();
 
-                *prev = Connection {
+                auto& conn = this->m_connections[prev - this->m_connections.cbegin()];
+                conn = Connection {
                     ijk[0], ijk[1], ijk[2],
                     cell.global_index, compl_num,
                     state, direction, ctf_kind, satTableId,
@@ -922,7 +933,7 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
                     css_ind, defaultSatTable
                 };
 
-                prev->updateSegment(conSegNo, cell.depth, css_ind, *perf_range);
+                conn.updateSegment(conSegNo, cell.depth, css_ind, *perf_range);
             }
         }
     }
@@ -951,15 +962,19 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
     void WellConnections::applyDFactorCorrelation(const ScheduleGrid& grid,
                                                   const WDFAC&        wdfac)
     {
-        for (auto& conn : this->m_connections) {
+        for (auto connIx = 0*this->m_connections.size(); connIx < this->m_connections.size(); ++connIx) {
+            const auto& conn = std::as_const(this->m_connections)[connIx];
             const auto& complCell = grid.get_cell(conn.getI(), conn.getJ(), conn.getK());
             if (! complCell.is_active()) {
                 continue;
             }
 
-            conn.setStaticDFacCorrCoeff
-                (staticForchheimerCoefficient(conn.ctfProperties(),
-                                              complCell.props->poro, wdfac));
+            const auto coeff = staticForchheimerCoefficient(conn.ctfProperties(),
+                                                            complCell.props->poro, wdfac);
+
+            if (coeff != conn.ctfProperties().static_dfac_corr_coeff) {
+                this->m_connections[connIx].setStaticDFacCorrCoeff(coeff);
+            }
         }
     }
 
@@ -1050,16 +1065,16 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
 
     Connection* WellConnections::maybeGetFromGlobalIndex(const std::size_t global_index)
     {
-        auto conn_iter =
-            std::ranges::find_if(*this,
+        const auto conn_iter =
+            std::ranges::find_if(std::as_const(*this),
                                  [global_index] (const Connection& conn)
                                  { return conn.global_index() == global_index; });
 
-        if (conn_iter == this->end()) {
+        if (conn_iter == this->m_connections.cend()) {
             return nullptr;
         }
 
-        return &*conn_iter;
+        return &this->m_connections[conn_iter - this->m_connections.cbegin()];
     }
 
     bool WellConnections::allConnectionsShut() const
@@ -1079,7 +1094,7 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
             return;
         }
 
-        if (this->m_connections[0].attachedToSegment()) {
+        if (std::as_const(this->m_connections)[0].attachedToSegment()) {
             this->orderMSW();
         }
         else if (this->m_ordering == Connection::Order::TRACK) {
@@ -1092,9 +1107,14 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
 
     void WellConnections::orderMSW()
     {
-        std::ranges::sort(this->m_connections,
-                          [](const Opm::Connection& conn1, const Opm::Connection& conn2)
-                          { return conn1.sort_value() < conn2.sort_value(); });
+        auto by_sort_value = [](const Opm::Connection& conn1, const Opm::Connection& conn2)
+        { return conn1.sort_value() < conn2.sort_value(); };
+
+        // Connections are typically already ordered.  Don't unshare their
+        // storage in that case.
+        if (! std::ranges::is_sorted(std::as_const(this->m_connections), by_sort_value)) {
+            std::ranges::sort(this->m_connections, by_sort_value);
+        }
     }
 
     void WellConnections::orderTRACK()
@@ -1102,7 +1122,9 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
         // Find the first connection and swap it into the 0-position.
         const double surface_z = 0.0;
         std::size_t first_index = findClosestConnection(this->headI, this->headJ, surface_z, 0);
-        std::swap(m_connections[first_index], m_connections[0]);
+        if (first_index != 0) {
+            std::swap(m_connections[first_index], m_connections[0]);
+        }
 
         // Repeat for remaining connections.
         //
@@ -1115,10 +1137,12 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
         }
 
         for (std::size_t pos = 1; pos < m_connections.size() - 1; ++pos) {
-            const auto& prev = m_connections[pos - 1];
+            const auto& prev = std::as_const(m_connections)[pos - 1];
             const double prevz = prev.depth();
             std::size_t next_index = findClosestConnection(prev.getI(), prev.getJ(), prevz, pos);
-            std::swap(m_connections[next_index], m_connections[pos]);
+            if (next_index != pos) {
+                std::swap(m_connections[next_index], m_connections[pos]);
+            }
         }
     }
 
@@ -1128,7 +1152,7 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
         int min_ijdist2 = std::numeric_limits<int>::max();
         double min_zdiff = std::numeric_limits<double>::max();
         for (std::size_t pos = start_pos; pos < m_connections.size(); ++pos) {
-            const auto& connection = m_connections[ pos ];
+            const auto& connection = std::as_const(m_connections)[ pos ];
 
             const double depth = connection.depth();
             const int ci = connection.getI();
@@ -1153,9 +1177,12 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
 
     void WellConnections::orderDEPTH()
     {
-        std::ranges::sort(this->m_connections,
-                          [](const Opm::Connection& conn1, const Opm::Connection& conn2)
-                          { return conn1.depth() < conn2.depth(); });
+        auto by_depth = [](const Opm::Connection& conn1, const Opm::Connection& conn2)
+        { return conn1.depth() < conn2.depth(); };
+
+        if (! std::ranges::is_sorted(std::as_const(this->m_connections), by_depth)) {
+            std::ranges::sort(this->m_connections, by_depth);
+        }
     }
 
     bool WellConnections::operator==(const WellConnections& rhs) const
@@ -1164,7 +1191,7 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
             && (this->m_ordering == rhs.m_ordering)
             && (this->coord == rhs.coord)
             && (this->md == rhs.md)
-            && std::ranges::equal(*this, rhs);
+            && (this->m_connections == rhs.m_connections);
     }
 
     bool WellConnections::operator!=(const WellConnections& rhs) const
@@ -22,10 +22,13 @@
 
 #include <opm/input/eclipse/Schedule/Well/Connection.hpp>
 
+#include <opm/utility/CopyOnWriteVector.hpp>
+
 #include <array>
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -46,7 +49,12 @@ namespace Opm {
     class WellConnections
     {
     public:
-        using const_iterator = std::vector<Connection>::const_iterator;
+        /// Connections are stored in chunks that are shared between copies
+        /// of a connection set, and which are unshared only when modified.
+        /// Report step snapshots of a well with many connections therefore
+        /// share all connections that did not change between the steps.
+        using Storage = Utility::CopyOnWriteVector<Connection>;
+        using const_iterator = Storage::const_iterator;
 
         WellConnections() = default;
         WellConnections(const Connection::Order ordering, const int headI, const int headJ);
@@ -144,9 +152,44 @@ namespace Opm {
 
         const_iterator begin() const { return this->m_connections.begin(); }
         const_iterator end() const { return this->m_connections.end(); }
+
+        // Note: Dereferencing these iterators unshares the storage of the
+        // connection, even if it is only read.
         auto begin() { return this->m_connections.begin(); }
         auto end() { return this->m_connections.end(); }
         bool allConnectionsShut() const;
+
+        /// Apply an update to selected connections.
+        ///
+        /// Connections which are not selected, or which the update leaves
+        /// unchanged, keep sharing their storage with copies of this set.
+        ///
+        /// \param[in] select Predicate selecting connections to update.
+        /// \param[in] update Function modifying a selected connection.
+        ///
+        /// \return Whether or not any connection was selected.
+        template <typename Select, typename Update>
+        bool updateSelected(Select&& select, Update&& update)
+        {
+            auto selected = false;
+            for (auto connIx = 0*this->m_connections.size(); connIx < this->m_connections.size(); ++connIx) {
+                const auto& conn = std::as_const(this->m_connections)[connIx];
+                if (! select(conn)) {
+                    continue;
+                }
+
+                selected = true;
+
+                auto new_conn = conn;
+                update(new_conn);
+                if (new_conn != conn) {
+                    this->m_connections[connIx] = std::move(new_conn);
+                }
+            }
+
+            return selected;
+        }
+
         /// Order connections irrespective of input order.
         /// The algorithm used is the following:
         ///     1. The connection nearest to the given (well_i, well_j)
@@ -202,7 +245,7 @@ namespace Opm {
         Connection::Order m_ordering { Connection::Order::TRACK };
         int headI{0};
         int headJ{0};
-        std::vector<Connection> m_connections{};
+        Storage m_connections{};
 
         std::array<std::vector<double>, 3> coord{};
         std::vector<double> md{};
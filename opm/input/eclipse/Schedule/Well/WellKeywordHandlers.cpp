@@ -60,9 +60,12 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -102,103 +105,258 @@ std::string trim_wgname(const DeckKeyword& keyword,
     return wgname;
 }
 
-void updateOpenShutEvents(HandlerContext& handlerContext, const std::string& well_name){
-    if (handlerContext.getWellStatus(well_name) == WellStatus::OPEN) {
+void updateOpenShutEvents(HandlerContext& handlerContext,
+                          const std::string& well_name,
+                          const WellStatus status)
+{
+    if (status == WellStatus::OPEN) {
         handlerContext.state().wellgroup_events().addEvent( well_name, ScheduleEvents::REQUEST_OPEN_WELL);
         handlerContext.state().wellgroup_events().clearEvent( well_name, ScheduleEvents::REQUEST_SHUT_WELL);
     }
-    if (handlerContext.getWellStatus(well_name) == WellStatus::SHUT) {
+    if (status == WellStatus::SHUT) {
         handlerContext.state().wellgroup_events().addEvent( well_name, ScheduleEvents::REQUEST_SHUT_WELL);
         handlerContext.state().wellgroup_events().clearEvent( well_name, ScheduleEvents::REQUEST_OPEN_WELL);
     }
 }
 
-void handleWCONHIST(HandlerContext& handlerContext)
+void updateOpenShutEvents(HandlerContext& handlerContext, const std::string& well_name){
+    updateOpenShutEvents(handlerContext, well_name, handlerContext.getWellStatus(well_name));
+}
+
+/*
+  History decks commonly carry one WCONHIST/WCONPROD record for each of
+  several thousand wells at every report step.  Rather than copying a Well
+  out of the ScheduleState for every record (and once more for the status
+  update), the records of such a keyword are grouped by well and applied to
+  a single copy of each well.
+
+  Processing happens in two phases.  The first phase applies the records
+  to the well copies and touches nothing but the copies themselves, so the
+  wells may be handled concurrently.  The second phase replays the records
+  in keyword order to update well status, emit events and record UDQ
+  usage, and then stores each modified well once.  An exception raised
+  while applying a record in the first phase is rethrown when the second
+  phase reaches that record, i.e., after the effects of all preceding
+  records have been committed, exactly as with serial processing.
+*/
+
+template <typename RecordUpdate>
+struct WellRecordBatch
 {
-    for (const auto& record : handlerContext.keyword) {
+    explicit WellRecordBatch(const std::string& name_)
+        : name { name_ }
+    {}
+
+    std::string name{};
+    std::vector<std::size_t> records{};
+    std::optional<Well> well{};
+    std::vector<RecordUpdate> updates{};
+    std::exception_ptr error{};
+};
+
+// Process wells concurrently only when there is enough work to amortise
+// starting the thread team.
+constexpr std::int64_t minParallelWellBatches = 128;
+
+template <typename RecordUpdate, typename ApplyRecord, typename CommitRecord>
+void handleRecordsByWell(HandlerContext& handlerContext,
+                         ApplyRecord&&   applyRecord,
+                         CommitRecord&&  commitRecord)
+{
+    const auto& keyword = handlerContext.keyword;
+    const auto numRecords = keyword.size();
+
+    auto batches = std::vector<WellRecordBatch<RecordUpdate>>{};
+    auto recordBatches = std::vector<std::vector<std::size_t>>(numRecords);
+    auto batchIndex = std::unordered_map<std::string, std::size_t>{};
+
+    // DeckItem converts to SI units in place on first access, so a record
+    // matching several wells must not be read from several threads.
+    auto sharedRecords = false;
+
+    for (auto recordIx = 0*numRecords; recordIx < numRecords; ++recordIx) {
+        const auto& record = keyword.getRecord(recordIx);
         const std::string& wellNamePattern = record.getItem("WELL").getTrimmedString(0);
         const auto well_names = handlerContext.wellNames(wellNamePattern, false);
 
-        const Well::Status status = WellStatusFromString(record.getItem("STATUS").getTrimmedString(0));
+        sharedRecords = sharedRecords || (well_names.size() > 1);
 
         for (const auto& well_name : well_names) {
-            handlerContext.updateWellStatus(well_name, status,
-                                            handlerContext.keyword.location());
+            const auto [pos, inserted] = batchIndex.try_emplace(well_name, batches.size());
+            if (inserted) {
+                batches.emplace_back(well_name);
+            }
 
-            std::optional<VFPProdTable::ALQ_TYPE> alq_type;
-            auto well2 = handlerContext.state().wells.get( well_name );
-            const bool switching_from_injector = !well2.isProducer();
-            auto properties = std::make_shared<Well::WellProductionProperties>(well2.getProductionProperties());
-            bool update_well = false;
+            batches[pos->second].records.push_back(recordIx);
+            recordBatches[recordIx].push_back(pos->second);
+        }
+    }
 
-            auto table_nr = record.getItem("VFP_TABLE").get< int >(0);
-            if (record.getItem("VFP_TABLE").defaultApplied(0)) { // Default 1* use the privious set vfp table
-                table_nr = properties->VFPTableNumber;
-            }
+    const auto& wells = handlerContext.state().wells;
+    const auto numBatches = static_cast<std::int64_t>(batches.size());
 
-            if (table_nr != 0) {
-                const auto& vfpprod = handlerContext.state().vfpprod;
-                if (vfpprod.has(table_nr)) {
-                    alq_type = handlerContext.state().vfpprod(table_nr).getALQType();
-                } else {
-                    std::string reason = fmt::format("Problem with well:{} VFP table: {} not defined", well_name, table_nr);
-                    throw OpmInputError(reason, handlerContext.keyword.location());
-                }
-            }
-            double default_bhp;
-            if (handlerContext.state().bhp_defaults.get().prod_target) {
-                default_bhp = *handlerContext.state().bhp_defaults.get().prod_target;
-            } else {
-                default_bhp = UnitSystem::newMETRIC().to_si(UnitSystem::measure::pressure,
-                                                            ParserKeywords::FBHPDEF::TARGET_BHP::defaultValue);
-            }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (!sharedRecords && (numBatches >= minParallelWellBatches))
+#endif
+    for (std::int64_t batchIx = 0; batchIx < numBatches; ++batchIx) {
+        auto& batch = batches[batchIx];
+
+        try {
+            batch.well.emplace(wells.get(batch.name));
+            batch.updates.reserve(batch.records.size());
 
-            // Injectors at a restart time will not have any WellProductionProperties with the
-            // proper whistctl_cmode, so this needs to be set before the call to handleWCONHIST
-            if (switching_from_injector) {
-                properties->whistctl_cmode = handlerContext.state().whistctl();
+            for (const auto recordIx : batch.records) {
+                batch.updates.push_back(applyRecord(*batch.well, keyword.getRecord(recordIx)));
             }
+        }
+        catch (...) {
+            batch.error = std::current_exception();
+        }
+    }
 
-            properties->handleWCONHIST(alq_type,
-                                       table_nr,
-                                       default_bhp,
-                                       handlerContext.static_schedule().m_unit_system, record);
+    auto nextUpdate = std::vector<std::size_t>(batches.size(), 0);
+    auto wellChanged = std::vector<bool>(batches.size(), false);
 
-            if (switching_from_injector) {
-                if (properties->bhp_hist_limit_defaulted) {
-                    properties->setBHPLimit(default_bhp);
-                }
+    for (auto recordIx = 0*numRecords; recordIx < numRecords; ++recordIx) {
+        const auto& record = keyword.getRecord(recordIx);
 
-                auto inj_props = std::make_shared<Well::WellInjectionProperties>(well2.getInjectionProperties());
-                inj_props->resetBHPLimit();
-                well2.updateInjection(inj_props);
-                update_well = true;
-                handlerContext.state().wellgroup_events().addEvent( well2.name(), ScheduleEvents::WELL_SWITCHED_INJECTOR_PRODUCER);
-            }
+        for (const auto batchIx : recordBatches[recordIx]) {
+            auto& batch = batches[batchIx];
 
-            if (well2.updateProduction(properties)) {
-                update_well = true;
+            const auto updateIx = nextUpdate[batchIx]++;
+            if (updateIx == batch.updates.size()) {
+                std::rethrow_exception(batch.error);
             }
 
-            if (well2.updatePrediction(false)) {
-                update_well = true;
+            if (commitRecord(*batch.well, record, batch.updates[updateIx])) {
+                wellChanged[batchIx] = true;
             }
+        }
+    }
 
-            if (well2.updateHasProduced()) {
-                update_well = true;
-            }
+    for (auto batchIx = 0*batches.size(); batchIx < batches.size(); ++batchIx) {
+        if (wellChanged[batchIx]) {
+            handlerContext.state().wells.update(std::move(*batches[batchIx].well));
+        }
+    }
+}
 
-            if (update_well) {
-                handlerContext.state().events().addEvent( ScheduleEvents::PRODUCTION_UPDATE );
-                handlerContext.state().wellgroup_events().addEvent( well2.name(), ScheduleEvents::PRODUCTION_UPDATE);
-                handlerContext.state().wells.update( well2 );
-                handlerContext.affected_well(well_name);
+struct ProductionRecordUpdate
+{
+    std::shared_ptr<Well::WellProductionProperties> properties{};
+    bool switching_from_injector{false};
+    bool update_well{false};
+};
+
+double defaultProducerBHP(HandlerContext& handlerContext, const double metric_default)
+{
+    if (handlerContext.state().bhp_defaults.get().prod_target) {
+        return *handlerContext.state().bhp_defaults.get().prod_target;
+    }
+
+    return UnitSystem::newMETRIC().to_si(UnitSystem::measure::pressure, metric_default);
+}
+
+std::optional<VFPProdTable::ALQ_TYPE>
+productionALQType(const ScheduleState&  state,
+                  const std::string&    well_name,
+                  const int             table_nr,
+                  const KeywordLocation& location)
+{
+    if (table_nr == 0) {
+        return std::nullopt;
+    }
+
+    const auto& vfpprod = state.vfpprod;
+    if (! vfpprod.has(table_nr)) {
+        std::string reason = fmt::format("Problem with well:{} VFP table: {} not defined", well_name, table_nr);
+        throw OpmInputError(reason, location);
+    }
+
+    return vfpprod(table_nr).getALQType();
+}
+
+void handleWCONHIST(HandlerContext& handlerContext)
+{
+    const auto& state = handlerContext.state();
+    const auto& location = handlerContext.keyword.location();
+    const auto& unit_system = handlerContext.static_schedule().m_unit_system;
+    const auto whistctl_cmode = handlerContext.state().whistctl();
+    const auto default_bhp = defaultProducerBHP(handlerContext,
+                                                ParserKeywords::FBHPDEF::TARGET_BHP::defaultValue);
+
+    auto applyRecord = [&](Well& well2, const DeckRecord& record)
+    {
+        auto result = ProductionRecordUpdate{};
+
+        result.switching_from_injector = !well2.isProducer();
+        auto properties = std::make_shared<Well::WellProductionProperties>(well2.getProductionProperties());
+
+        auto table_nr = record.getItem("VFP_TABLE").get< int >(0);
+        if (record.getItem("VFP_TABLE").defaultApplied(0)) { // Default 1* use the privious set vfp table
+            table_nr = properties->VFPTableNumber;
+        }
+
+        const auto alq_type = productionALQType(state, well2.name(), table_nr, location);
+
+        // Injectors at a restart time will not have any WellProductionProperties with the
+        // proper whistctl_cmode, so this needs to be set before the call to handleWCONHIST
+        if (result.switching_from_injector) {
+            properties->whistctl_cmode = whistctl_cmode;
+        }
+
+        properties->handleWCONHIST(alq_type, table_nr, default_bhp, unit_system, record);
+
+        if (result.switching_from_injector) {
+            if (properties->bhp_hist_limit_defaulted) {
+                properties->setBHPLimit(default_bhp);
             }
 
-            // Add Event if well open/shut is requested
-            updateOpenShutEvents(handlerContext, well_name);
+            auto inj_props = std::make_shared<Well::WellInjectionProperties>(well2.getInjectionProperties());
+            inj_props->resetBHPLimit();
+            well2.updateInjection(inj_props);
+            result.update_well = true;
         }
-    }
+
+        if (well2.updateProduction(properties)) {
+            result.update_well = true;
+        }
+
+        if (well2.updatePrediction(false)) {
+            result.update_well = true;
+        }
+
+        result.properties = std::move(properties);
+        return result;
+    };
+
+    auto commitRecord = [&](Well& well2, const DeckRecord& record, ProductionRecordUpdate& result)
+    {
+        const Well::Status status = WellStatusFromString(record.getItem("STATUS").getTrimmedString(0));
+        bool changed = handlerContext.updateWellStatus(well2, status, location);
+
+        if (result.switching_from_injector) {
+            handlerContext.state().wellgroup_events().addEvent( well2.name(), ScheduleEvents::WELL_SWITCHED_INJECTOR_PRODUCER);
+        }
+
+        if (well2.updateHasProduced()) {
+            result.update_well = true;
+        }
+
+        if (result.update_well) {
+            handlerContext.state().events().addEvent( ScheduleEvents::PRODUCTION_UPDATE );
+            handlerContext.state().wellgroup_events().addEvent( well2.name(), ScheduleEvents::PRODUCTION_UPDATE);
+            handlerContext.affected_well(well2.name());
+            changed = true;
+        }
+
+        // Add Event if well open/shut is requested
+        updateOpenShutEvents(handlerContext, well2.name(), well2.getStatus());
+
+        return changed;
+    };
+
+    handleRecordsByWell<ProductionRecordUpdate>(handlerContext, applyRecord, commitRecord);
 }
 
 void handleWCONINJE(HandlerContext& handlerContext)
@@ -375,84 +533,82 @@ bool belongsToAutoChokeGroup(const Well& well, const ScheduleState& state) {
 
 void handleWCONPROD(HandlerContext& handlerContext)
 {
-    for (const auto& record : handlerContext.keyword) {
-        const std::string& wellNamePattern = record.getItem("WELL").getTrimmedString(0);
-        const auto well_names = handlerContext.wellNames(wellNamePattern, false);
+    const auto& state = handlerContext.state();
+    const auto& location = handlerContext.keyword.location();
+    const auto& unit_system = handlerContext.static_schedule().m_unit_system;
+    const auto& phases = handlerContext.static_schedule().m_runspec.phases();
+    const auto default_bhp_target = defaultProducerBHP(handlerContext,
+                                                       ParserKeywords::WCONPROD::BHP::defaultValue.get<double>());
+
+    auto applyRecord = [&](Well& well2, const DeckRecord& record)
+    {
+        auto result = ProductionRecordUpdate{};
 
-        const Well::Status status = WellStatusFromString(record.getItem("STATUS").getTrimmedString(0));
+        result.switching_from_injector = !well2.isProducer();
+        auto properties = std::make_shared<Well::WellProductionProperties>(well2.getProductionProperties());
+        properties->clearControls();
+        if (well2.isAvailableForGroupControl() || belongsToAutoChokeGroup(well2, state)) {
+            properties->addProductionControl(Well::ProducerCMode::GRUP);
+        }
 
-        for (const auto& well_name : well_names) {
-            bool update_well = handlerContext.updateWellStatus(well_name, status,
-                                                               handlerContext.keyword.location());
-            std::optional<VFPProdTable::ALQ_TYPE> alq_type;
-            auto well2 = handlerContext.state().wells.get( well_name );
-            const bool switching_from_injector = !well2.isProducer();
-            auto properties = std::make_shared<Well::WellProductionProperties>(well2.getProductionProperties());
-            properties->clearControls();
-            if (well2.isAvailableForGroupControl() || belongsToAutoChokeGroup(well2, handlerContext.state())) {
-                properties->addProductionControl(Well::ProducerCMode::GRUP);
-            }
+        const auto table_nr = record.getItem("VFP_TABLE").get< int >(0);
+        const auto alq_type = productionALQType(state, well2.name(), table_nr, location);
 
-            auto table_nr = record.getItem("VFP_TABLE").get< int >(0);
-            if (table_nr != 0) {
-                const auto& vfpprod = handlerContext.state().vfpprod;
-                if (vfpprod.has(table_nr)) {
-                    alq_type = handlerContext.state().vfpprod(table_nr).getALQType();
-                } else {
-                    std::string reason = fmt::format("Problem with well:{} VFP table: {} not defined", well_name, table_nr);
-                    throw OpmInputError(reason, handlerContext.keyword.location());
-                }
-            }
+        properties->handleWCONPROD(alq_type, table_nr, default_bhp_target,
+                                   unit_system, well2.name(), phases, record, location);
 
-            double default_bhp_target;
-            if (handlerContext.state().bhp_defaults.get().prod_target) {
-                default_bhp_target = *handlerContext.state().bhp_defaults.get().prod_target;
-            } else {
-                default_bhp_target = UnitSystem::newMETRIC().to_si(UnitSystem::measure::pressure,
-                                                                   ParserKeywords::WCONPROD::BHP::defaultValue.get<double>());
+        if (result.switching_from_injector) {
+            if (properties->bhp_hist_limit_defaulted) {
+                properties->setBHPLimit(default_bhp_target);
             }
+            result.update_well = true;
+        }
 
-            const auto& phases = handlerContext.static_schedule().m_runspec.phases();
-            properties->handleWCONPROD(alq_type, table_nr, default_bhp_target,
-                                       handlerContext.static_schedule().m_unit_system,
-                                       well_name, phases, record, handlerContext.keyword.location());
+        if (well2.updateProduction(properties)) {
+            result.update_well = true;
+        }
 
-            if (switching_from_injector) {
-                if (properties->bhp_hist_limit_defaulted) {
-                    properties->setBHPLimit(default_bhp_target);
-                }
-                update_well = true;
-                handlerContext.state().wellgroup_events().addEvent( well2.name(), ScheduleEvents::WELL_SWITCHED_INJECTOR_PRODUCER);
-            }
+        if (well2.updatePrediction(true)) {
+            result.update_well = true;
+        }
 
-            if (well2.updateProduction(properties)) {
-                update_well = true;
-            }
+        result.properties = std::move(properties);
+        return result;
+    };
 
-            if (well2.updatePrediction(true)) {
-                update_well = true;
-            }
+    auto commitRecord = [&](Well& well2, const DeckRecord& record, ProductionRecordUpdate& result)
+    {
+        const Well::Status status = WellStatusFromString(record.getItem("STATUS").getTrimmedString(0));
+        if (handlerContext.updateWellStatus(well2, status, location)) {
+            result.update_well = true;
+        }
 
-            if (well2.updateHasProduced()) {
-                update_well = true;
-            }
+        if (result.switching_from_injector) {
+            handlerContext.state().wellgroup_events().addEvent( well2.name(), ScheduleEvents::WELL_SWITCHED_INJECTOR_PRODUCER);
+        }
 
-            if (update_well) {
-                handlerContext.state().events().addEvent( ScheduleEvents::PRODUCTION_UPDATE );
-                handlerContext.state().wellgroup_events().addEvent( well2.name(), ScheduleEvents::PRODUCTION_UPDATE);
-                handlerContext.state().wells.update( std::move(well2) );
-                handlerContext.affected_well(well_name);
-            }
+        if (well2.updateHasProduced()) {
+            result.update_well = true;
+        }
 
-            // Add Event if well open/shut is requested
-            updateOpenShutEvents(handlerContext, well_name);
+        if (result.update_well) {
+            handlerContext.state().events().addEvent( ScheduleEvents::PRODUCTION_UPDATE );
+            handlerContext.state().wellgroup_events().addEvent( well2.name(), ScheduleEvents::PRODUCTION_UPDATE);
+            handlerContext.affected_well(well2.name());
+        }
 
-            auto udq_active = handlerContext.state().udq_active.get();
-            if (properties->updateUDQActive(handlerContext.state().udq.get(), udq_active)) {
-                handlerContext.state().udq_active.update( std::move(udq_active));
-            }
+        // Add Event if well open/shut is requested
+        updateOpenShutEvents(handlerContext, well2.name(), well2.getStatus());
+
+        auto udq_active = handlerContext.state().udq_active.get();
+        if (result.properties->updateUDQActive(handlerContext.state().udq.get(), udq_active)) {
+            handlerContext.state().udq_active.update( std::move(udq_active));
         }
-    }
+
+        return result.update_well;
+    };
+
+    handleRecordsByWell<ProductionRecordUpdate>(handlerContext, applyRecord, commitRecord);
 }
 
 void handleWCYCLE(HandlerContext& handlerContext)
@@ -25,8 +25,11 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <span>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace {
@@ -35,6 +38,61 @@ namespace {
     {
         return N;
     }
+
+    // Bulk conversion kernels.  Input and output may be the same array.
+    // Kept as separate loops, without a per-element branch on the offset,
+    // so that each is a straight multiply(-add) which the compiler can
+    // vectorise.  Large arrays are additionally split across threads.
+    constexpr auto parallelThreshold = std::int64_t{100000};
+
+    template <typename T>
+    void scaleArray(const double factor,
+                    std::span<const double> x,
+                    std::span<T> y)
+    {
+        const auto n = static_cast<std::int64_t>(x.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (n > parallelThreshold)
+#endif
+        for (std::int64_t i = 0; i < n; ++i) {
+            y[i] = static_cast<T>(x[i] * factor);
+        }
+    }
+
+    // y = (x + shift) * factor.
+    template <typename T>
+    void shiftScaleArray(const double shift,
+                         const double factor,
+                         std::span<const double> x,
+                         std::span<T> y)
+    {
+        const auto n = static_cast<std::int64_t>(x.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (n > parallelThreshold)
+#endif
+        for (std::int64_t i = 0; i < n; ++i) {
+            y[i] = static_cast<T>((x[i] + shift) * factor);
+        }
+    }
+
+    // y = x*factor + shift.
+    template <typename T>
+    void scaleShiftArray(const double factor,
+                         const double shift,
+                         std::span<const double> x,
+                         std::span<T> y)
+    {
+        const auto n = static_cast<std::int64_t>(x.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (n > parallelThreshold)
+#endif
+        for (std::int64_t i = 0; i < n; ++i) {
+            y[i] = static_cast<T>(x[i] * factor + shift);
+        }
+    }
 }
 
 namespace Opm {
@@ -1511,6 +1569,27 @@ namespace {
     }
 
 
+    Dimension UnitSystem::getNewDimension(const std::size_t id, const std::string& dimension) {
+        if (id == noDimensionID)
+            return this->getNewDimension( dimension );
+
+        if ((id < this->m_dimension_table.size()) && this->m_dimension_table[id].has_value()) {
+            this->m_use_count++;
+            return *this->m_dimension_table[id];
+        }
+
+        // Resolving the expression may add a dimension, and therefore
+        // reset the table, so look up the dimension before extending it.
+        const auto dim = Dimension { this->getNewDimension( dimension ) };
+
+        if (id >= this->m_dimension_table.size())
+            this->m_dimension_table.resize(id + 1);
+
+        this->m_dimension_table[id] = dim;
+        return dim;
+    }
+
+
     const Dimension& UnitSystem::getDimension(const std::string& dimension) const {
         auto iter = this->m_dimensions.find(dimension);
         if (iter == this->m_dimensions.end())
@@ -1586,6 +1665,7 @@ namespace {
 
     void UnitSystem::addDimension(const std::string& dimension , const Dimension& dim) {
         this->m_dimensions[ dimension ] = std::move(dim);
+        this->m_dimension_table.clear();
     }
 
     void UnitSystem::addDimension(const std::string& dimension , double SIfactor, double SIoffset) {
@@ -1645,6 +1725,15 @@ namespace {
         return Dimension( dividend.getSIScaling() / divisor.getSIScaling() );
     }
 
+    Dimension UnitSystem::parse(const std::size_t id, const std::string& dimension) const {
+        if ((id < this->m_dimension_table.size()) && this->m_dimension_table[id].has_value()) {
+            this->m_use_count++;
+            return *this->m_dimension_table[id];
+        }
+
+        return this->parse( dimension );
+    }
+
 
     bool UnitSystem::equal(const UnitSystem& other) const {
         return *this == other;
@@ -1693,18 +1782,54 @@ namespace {
     }
 
     void UnitSystem::from_si( measure m, std::vector<double>& data ) const {
-        double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return (x - offset) * factor; };
-        std::ranges::transform(data, data.begin(), scale);
+        this->from_si(m, std::span<double> { data });
     }
 
 
     void UnitSystem::to_si( measure m, std::vector<double>& data) const {
-        double factor = this->measure_table_to_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return x * factor + offset; };
-        std::ranges::transform(data, data.begin(), scale);
+        this->to_si(m, std::span<double> { data });
+    }
+
+    void UnitSystem::from_si( measure m, std::span<double> data ) const {
+        const double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
+        const double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
+
+        if (offset == 0.0)
+            scaleArray(factor, std::span<const double> { data }, data);
+        else
+            shiftScaleArray(-offset, factor, std::span<const double> { data }, data);
+    }
+
+    void UnitSystem::to_si( measure m, std::span<double> data ) const {
+        const double factor = this->measure_table_to_si[ static_cast< int >( m ) ];
+        const double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
+
+        if (offset == 0.0)
+            scaleArray(factor, std::span<const double> { data }, data);
+        else
+            scaleShiftArray(factor, offset, std::span<const double> { data }, data);
+    }
+
+    void UnitSystem::from_si( measure m, std::span<const double> si, std::span<float> out ) const {
+        if (si.size() != out.size())
+            throw std::invalid_argument {
+                "Input array of size " + std::to_string(si.size()) +
+                " does not match output array of size " + std::to_string(out.size())
+            };
+
+        const double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
+        const double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
+
+        if (offset == 0.0)
+            scaleArray(factor, si, out);
+        else
+            shiftScaleArray(-offset, factor, si, out);
+    }
+
+    std::vector<float> UnitSystem::from_si_float( measure m, std::span<const double> si ) const {
+        auto out = std::vector<float>(si.size());
+        this->from_si(m, si, out);
+        return out;
     }
 
     const char* UnitSystem::name( measure m ) const {
@@ -24,8 +24,12 @@
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 
+#include <cstddef>
+#include <limits>
 #include <map>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -98,6 +102,10 @@ namespace Opm {
         explicit UnitSystem(UnitType unit = UnitType::UNIT_TYPE_METRIC);
         explicit UnitSystem(const std::string& deck_name);
 
+        /// ID of measure expressions which have not been assigned a
+        /// compact ID by the keyword generator.
+        static constexpr auto noDimensionID = std::numeric_limits<std::size_t>::max();
+
         static UnitSystem serializationTestObject();
 
         const std::string& getName() const;
@@ -109,6 +117,13 @@ namespace Opm {
         const Dimension& getNewDimension(const std::string& dimension);
         const Dimension& getDimension(const std::string& dimension) const;
         Dimension getDimension(measure m) const;
+
+        /// Dimension of measure expression with a compact ID assigned by
+        /// the keyword generator.  The expression is resolved on first
+        /// use only, and subsequent requests for the same ID are table
+        /// lookups.  Falls back to getNewDimension(dimension) if \p id is
+        /// noDimensionID.
+        Dimension getNewDimension(std::size_t id, const std::string& dimension);
         Dimension uda_dim(UDAControl control) const;
 
         bool hasDimension(const std::string& dimension) const;
@@ -120,12 +135,29 @@ namespace Opm {
 
         Dimension parse(const std::string& dimension) const;
 
+        /// Like parse(dimension), but uses the dimension of \p id if
+        /// that has already been resolved by getNewDimension().
+        Dimension parse(std::size_t id, const std::string& dimension) const;
+
         double from_si( const std::string& dimension, double ) const;
         double to_si( const std::string& dimension, double ) const;
         double from_si( measure, double ) const;
         double to_si( measure, double ) const;
         void from_si( measure, std::vector<double>& ) const;
         void to_si( measure, std::vector<double>& ) const;
+
+        /// Bulk conversions.  Each converts a whole array in a single,
+        /// vectorisable pass, and splits large arrays across threads.
+        void from_si( measure, std::span<double> ) const;
+        void to_si( measure, std::span<double> ) const;
+
+        /// Convert \p si from SI to output units of measure \p m and
+        /// narrow to single precision in the same pass.  Sizes of \p si
+        /// and \p out must match.
+        void from_si( measure m, std::span<const double> si, std::span<float> out ) const;
+
+        /// Single precision output values of SI array \p si.
+        std::vector<float> from_si_float( measure m, std::span<const double> si ) const;
         const char* name( measure ) const;
         std::string deck_name() const;
         std::size_t use_count() const;
@@ -160,6 +192,12 @@ namespace Opm {
         std::string m_name;
         UnitType m_unittype;
         std::map< std::string , Dimension > m_dimensions;
+
+        /// Resolved measure expressions, indexed by generator assigned
+        /// ID.  Derived from m_dimensions, so neither serialised nor
+        /// compared, and reset whenever a dimension is added.
+        std::vector<std::optional<Dimension>> m_dimension_table{};
+
         const double* measure_table_to_si_offset;
         const double* measure_table_from_si;
         const double* measure_table_to_si;
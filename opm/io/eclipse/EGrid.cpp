@@ -21,6 +21,7 @@
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/numeric/calculateCellVol.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -374,33 +375,30 @@ void EGrid::mapaxes_init()
     unit_y[1] *= norm_y;
 }
 
-void EGrid::getCellCorners(const std::array<int, 3>& ijk,
-                           std::array<double, 8>& X,
-                           std::array<double, 8>& Y,
-                           std::array<double, 8>& Z)
+void EGrid::cellCorners(const std::array<int, 3>& ijk,
+                        std::array<double, 8>& X,
+                        std::array<double, 8>& Y,
+                        std::array<double, 8>& Z) const
 {
-    if (coord_array.empty())
-        load_grid_data();
+    std::array<std::size_t, 8> zind;
+    std::array<std::size_t, 4> pind;
 
-    std::vector<int> zind;
-    std::vector<int> pind;
-
-    int res_shift = res.at(ijk[2])*(nijk[0]+1)*(nijk[1]+1)*6;
+    const std::size_t res_shift = static_cast<std::size_t>(res.at(ijk[2]))*(nijk[0]+1)*(nijk[1]+1)*6;
 
    // calculate indices for grid pillars in COORD arrray
-    pind.push_back(res_shift + ijk[1]*(nijk[0]+1)*6 + ijk[0]*6);
-    pind.push_back(pind[0] + 6);
-    pind.push_back(pind[0] + (nijk[0]+1)*6);
-    pind.push_back(pind[2] + 6);
+    pind[0] = res_shift + static_cast<std::size_t>(ijk[1])*(nijk[0]+1)*6 + ijk[0]*6;
+    pind[1] = pind[0] + 6;
+    pind[2] = pind[0] + (nijk[0]+1)*6;
+    pind[3] = pind[2] + 6;
 
     // get depths from zcorn array in ZCORN array
-    zind.push_back(ijk[2]*nijk[0]*nijk[1]*8 + ijk[1]*nijk[0]*4 + ijk[0]*2);
-    zind.push_back(zind[0] + 1);
-    zind.push_back(zind[0] + nijk[0]*2);
-    zind.push_back(zind[2] + 1);
+    zind[0] = static_cast<std::size_t>(ijk[2])*nijk[0]*nijk[1]*8 + static_cast<std::size_t>(ijk[1])*nijk[0]*4 + ijk[0]*2;
+    zind[1] = zind[0] + 1;
+    zind[2] = zind[0] + nijk[0]*2;
+    zind[3] = zind[2] + 1;
 
     for (int n = 0; n < 4; n++)
-        zind.push_back(zind[n] + nijk[0]*nijk[1]*4);
+        zind[n+4] = zind[n] + static_cast<std::size_t>(nijk[0])*nijk[1]*4;
 
     for (int n = 0; n < 8; n++)
         Z[n] = zcorn_array[zind[n]];
@@ -441,6 +439,18 @@ void EGrid::getCellCorners(const std::array<int, 3>& ijk,
 }
 
 
+void EGrid::getCellCorners(const std::array<int, 3>& ijk,
+                           std::array<double, 8>& X,
+                           std::array<double, 8>& Y,
+                           std::array<double, 8>& Z)
+{
+    if (coord_array.empty())
+        load_grid_data();
+
+    this->cellCorners(ijk, X, Y, Z);
+}
+
+
 void EGrid::getCellCorners(int globindex, std::array<double, 8>& X,
                            std::array<double, 8>& Y, std::array<double, 8>& Z)
 {
@@ -448,6 +458,75 @@ void EGrid::getCellCorners(int globindex, std::array<double, 8>& X,
 }
 
 
+void EGrid::getCellCorners(std::span<const int> globalIndices,
+                           std::span<std::array<double, 8>> X,
+                           std::span<std::array<double, 8>> Y,
+                           std::span<std::array<double, 8>> Z)
+{
+    if ((X.size() != globalIndices.size()) ||
+        (Y.size() != globalIndices.size()) ||
+        (Z.size() != globalIndices.size()))
+    {
+        OPM_THROW(std::invalid_argument, "Size of corner arrays does not match number of cells");
+    }
+
+    this->prepareBulkGeometry(globalIndices);
+
+    const auto n = static_cast<std::int64_t>(globalIndices.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (std::int64_t c = 0; c < n; ++c) {
+        this->cellCorners(this->ijk(globalIndices[c]), X[c], Y[c], Z[c]);
+    }
+}
+
+
+void EGrid::cellGeometry(const CellGeometry::Output& out)
+{
+    if (coord_array.empty())
+        load_grid_data();
+
+    CellGeometry::compute(this->totalNumberOfCells(),
+                          [this](const std::size_t c, auto& X, auto& Y, auto& Z)
+                          { this->cellCorners(this->ijk(c), X, Y, Z); },
+                          [](std::size_t, const auto& X, const auto& Y, const auto& Z)
+                          { return calculateCellVol(X, Y, Z); },
+                          out);
+}
+
+
+void EGrid::cellGeometry(std::span<const int> globalIndices,
+                         const CellGeometry::Output& out)
+{
+    this->prepareBulkGeometry(globalIndices);
+
+    CellGeometry::compute(globalIndices.size(),
+                          [this, globalIndices](const std::size_t c, auto& X, auto& Y, auto& Z)
+                          { this->cellCorners(this->ijk(globalIndices[c]), X, Y, Z); },
+                          [](std::size_t, const auto& X, const auto& Y, const auto& Z)
+                          { return calculateCellVol(X, Y, Z); },
+                          out);
+}
+
+
+void EGrid::prepareBulkGeometry(std::span<const int> globalIndices)
+{
+    if (coord_array.empty())
+        load_grid_data();
+
+    const auto numCells = this->totalNumberOfCells();
+    const auto invalid = std::ranges::find_if(globalIndices, [numCells](const int globInd)
+                                              { return (globInd < 0) || (globInd >= numCells); });
+
+    if (invalid != globalIndices.end()) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Global index {} out of range", *invalid));
+    }
+}
+
+
 std::vector<std::array<float, 3>> EGrid::getXYZ_layer(int layer, const std::array<int, 4>& box, bool bottom)
 {
    // layer is layer index, zero based. The box array is i and j range (i1,i2,j1,j2), also zero based
@@ -21,11 +21,15 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 
+#include <opm/common/utility/numeric/CellGeometry.hpp>
+
 #include <array>
+#include <cstddef>
 #include <filesystem>
 #include <string>
 #include <vector>
 #include <map>
+#include <span>
 
 namespace Opm { namespace EclIO {
 
@@ -45,6 +49,18 @@ public:
     void getCellCorners(int globindex, std::array<double, 8>& X, std::array<double, 8>& Y, std::array<double, 8>& Z);
     void getCellCorners(const std::array<int, 3>& ijk, std::array<double, 8>& X, std::array<double, 8>& Y, std::array<double, 8>& Z);
 
+    // Corners of all cells in globalIndices, computed in parallel.  Output
+    // spans must have one element per cell.
+    void getCellCorners(std::span<const int> globalIndices,
+                        std::span<std::array<double, 8>> X,
+                        std::span<std::array<double, 8>> Y,
+                        std::span<std::array<double, 8>> Z);
+
+    // Bulk cell geometry of all cells, in global index order, or of the
+    // cells in globalIndices.  See CellGeometry::Output.
+    void cellGeometry(const CellGeometry::Output& out);
+    void cellGeometry(std::span<const int> globalIndices, const CellGeometry::Output& out);
+
     std::vector<std::array<float, 3>> getXYZ_layer(int layer, bool bottom=false);
     std::vector<std::array<float, 3>> getXYZ_layer(int layer, const std::array<int, 4>& box, bool bottom=false);
 
@@ -114,6 +130,22 @@ private:
 
     std::vector<float> get_zcorn_from_disk(int layer, bool bottom);
 
+    void cellCorners(const std::array<int, 3>& ijk,
+                     std::array<double, 8>& X, std::array<double, 8>& Y, std::array<double, 8>& Z) const;
+
+    // Unchecked version of ijk_from_global_index().
+    std::array<int, 3> ijk(const std::size_t globInd) const
+    {
+        const auto nxy = static_cast<std::size_t>(nijk[0]) * nijk[1];
+        const auto rest = globInd % nxy;
+
+        return { static_cast<int>(rest % nijk[0]),
+                 static_cast<int>(rest / nijk[0]),
+                 static_cast<int>(globInd / nxy) };
+    }
+
+    void prepareBulkGeometry(std::span<const int> globalIndices);
+
     void getCellCorners(const std::array<int, 3>& ijk, const std::vector<float>& zcorn_layer,
                         std::array<double, 4>& X, std::array<double, 4>& Y, std::array<double, 4>& Z);
 
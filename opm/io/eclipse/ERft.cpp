@@ -23,8 +23,10 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <functional>
 #include <iterator>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -80,6 +82,7 @@ ERft::ERft(const std::string &filename) : EclFile(filename)
         std::tuple<std::string, RftDate> wellDateTuple = std::make_tuple(wellName[i], dates[i]);
         std::tuple<std::string, RftDate, float> wellDateTimeTuple = std::make_tuple(wellName[i], dates[i], timeList[i]);
         reportIndices[wellDateTuple] = i;
+        wellReports[wellName[i]].push_back(i);
         rftReportList.push_back(wellDateTimeTuple);
     }
 }
@@ -114,6 +117,19 @@ int ERft::getReportIndex(const std::string& wellName, const RftDate& date) const
 }
 
 
+const std::vector<int>& ERft::wellReportIndices(const std::string& wellName) const
+{
+    auto pos = wellReports.find(wellName);
+
+    if (pos == wellReports.end()) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("RFT data not found for well {}", wellName));
+    }
+
+    return pos->second;
+}
+
+
 bool ERft::hasArray(const std::string& arrayName, const std::string& wellName,
                     const RftDate& date) const
 {
@@ -393,6 +409,38 @@ ERft::getRft<std::string>(const std::string& name, int reportIndex) const
 }
 
 
+template <typename T>
+std::vector<std::reference_wrapper<const std::vector<T>>>
+ERft::getRftSeries(const std::string& name, const std::string& wellName) const
+{
+    const auto& reports = wellReportIndices(wellName);
+
+    std::vector<std::reference_wrapper<const std::vector<T>>> series;
+    series.reserve(reports.size());
+
+    for (const auto& reportIndex : reports) {
+        series.push_back(std::cref(getRft<T>(name, reportIndex)));
+    }
+
+    return series;
+}
+
+template std::vector<std::reference_wrapper<const std::vector<int>>>
+ERft::getRftSeries<int>(const std::string&, const std::string&) const;
+
+template std::vector<std::reference_wrapper<const std::vector<float>>>
+ERft::getRftSeries<float>(const std::string&, const std::string&) const;
+
+template std::vector<std::reference_wrapper<const std::vector<double>>>
+ERft::getRftSeries<double>(const std::string&, const std::string&) const;
+
+template std::vector<std::reference_wrapper<const std::vector<bool>>>
+ERft::getRftSeries<bool>(const std::string&, const std::string&) const;
+
+template std::vector<std::reference_wrapper<const std::vector<std::string>>>
+ERft::getRftSeries<std::string>(const std::string&, const std::string&) const;
+
+
 std::vector<EclFile::EclEntry> ERft::listOfRftArrays(int reportIndex) const
 {
     if ((reportIndex < 0) || (reportIndex >= numReports)) {
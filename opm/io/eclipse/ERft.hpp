@@ -22,6 +22,7 @@
 #include <opm/io/eclipse/EclFile.hpp>
 
 #include <ctime>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -53,6 +54,16 @@ public:
     using RftReportList = std::vector<std::tuple<std::string, RftDate, float>>;
     const RftReportList& listOfRftReports() const { return rftReportList; }
 
+    // Report indices of a single well, in file order.  Enables fetching
+    // the well's data at all dates without searching the other wells'
+    // reports.
+    const std::vector<int>& wellReportIndices(const std::string& wellName) const;
+
+    // Named array from all reports of a single well, in file order.
+    template <typename T>
+    std::vector<std::reference_wrapper<const std::vector<T>>>
+    getRftSeries(const std::string& name, const std::string& wellName) const;
+
     bool hasRft(const std::string& wellName, const RftDate& date) const;
     bool hasRft(const std::string& wellName, int year, int month, int day) const;
 
@@ -81,6 +92,7 @@ private:
     RftReportList rftReportList;
 
     std::map<std::tuple<std::string,RftDate>,int> reportIndices;  //  mapping report index to wellName and date (tupe)
+    std::map<std::string, std::vector<int>> wellReports;   //  report indices of each well, in file order
 
     int getReportIndex(const std::string& wellName, const RftDate& date) const;
 
@@ -25,6 +25,7 @@
 #include <cstring>
 #include <exception>
 #include <iterator>
+#include <numeric>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -92,6 +93,62 @@ void ERst::loadReportStepNumber(int number)
 }
 
 
+void ERst::loadReportStepNumber(int number, const std::vector<std::string>& arrays)
+{
+    this->loadReportStepNumbers({ number }, arrays);
+}
+
+
+void ERst::loadReportStepNumbers(const std::vector<int>& numbers,
+                                 const std::vector<std::string>& arrays)
+{
+    std::vector<int> arrayIndexList;
+
+    for (const auto& number : numbers) {
+        if (!hasReportStepNumber(number)) {
+            OPM_THROW(std::invalid_argument,
+                      fmt::format("Trying to load non existing report step number {}", number));
+        }
+
+        this->appendArrayIndices(number, arrays, arrayIndexList);
+    }
+
+    loadData(arrayIndexList);
+}
+
+
+void ERst::unloadReportStepNumber(int number)
+{
+    if (!hasReportStepNumber(number)) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Trying to unload non existing report step number {}", number));
+    }
+
+    const auto& [first, last] = arrIndexRange.at(number);
+
+    std::vector<int> arrayIndexList(last - first);
+    std::iota(arrayIndexList.begin(), arrayIndexList.end(), first);
+
+    unloadData(arrayIndexList);
+
+    reportLoaded[number] = false;
+}
+
+
+void ERst::appendArrayIndices(int number,
+                              const std::vector<std::string>& arrays,
+                              std::vector<int>& arrayIndexList) const
+{
+    const auto& [first, last] = arrIndexRange.at(number);
+
+    for (int i = first; i < last; i++) {
+        if (std::ranges::find(arrays, array_name[i]) != arrays.end()) {
+            arrayIndexList.push_back(i);
+        }
+    }
+}
+
+
 std::vector<EclFile::EclEntry> ERst::listOfRstArrays(int reportStepNumber)
 {
     return this->listOfRstArrays(reportStepNumber, "global");
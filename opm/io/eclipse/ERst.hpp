@@ -48,6 +48,20 @@ public:
 
     void loadReportStepNumber(int number);
 
+    // Load only those arrays of report step 'number' whose names are in
+    // 'arrays'.  All occurrences, including in LGRs, are loaded.  Names not
+    // present in the report step are ignored.
+    void loadReportStepNumber(int number, const std::vector<std::string>& arrays);
+
+    // Load named subset of arrays for multiple report steps in a single,
+    // possibly multi-threaded, pass over the restart file.
+    void loadReportStepNumbers(const std::vector<int>& numbers,
+                               const std::vector<std::string>& arrays);
+
+    // Release all loaded arrays of report step 'number'.  Arrays are
+    // reloaded on demand if subsequently requested.
+    void unloadReportStepNumber(int number);
+
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber)
     {
@@ -92,6 +106,10 @@ private:
 
     int get_start_index_lgrname(int number, const std::string& lgr_name);
 
+    void appendArrayIndices(int number,
+                            const std::vector<std::string>& arrays,
+                            std::vector<int>& arrayIndexList) const;
+
     int getArrayIndex(const std::string& name, int seqnum, int occurrence);
     int getArrayIndex(const std::string& name, int number, const std::string& lgr_name);
 
@@ -675,8 +675,7 @@ void ESmry::read_ministeps_from_disk()
         if (formattedFiles[specInd]) {
             ministep_value = read_ministep_formatted(fileH);
         } else {
-            std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-            auto ministep_vect = readBinaryArray<int,int>(fileH, 1, Opm::EclIO::INTE, f, sizeOfInte);
+            auto ministep_vect = readBinaryInteArray(fileH, 1);
             ministep_value = ministep_vect[0];
         }
 
@@ -735,7 +734,8 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
 
         auto it = keyword_index.find(key);
 
-        if (!vectorLoaded[it->second])
+        if (!vectorLoaded[it->second] &&
+            (std::find(keywIndVect.begin(), keywIndVect.end(), it->second) == keywIndVect.end()))
             keywIndVect.push_back(it->second);
     }
 
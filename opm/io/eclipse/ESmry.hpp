@@ -78,7 +78,14 @@ public:
     const std::string& get_unit(const SummaryNode& node) const;
 
     void write_rsm(std::ostream&) const;
-    void write_rsm_file(std::optional<std::filesystem::path> = std::nullopt) const;
+
+    // Write RSM report in chunks of at most chunk_size data vectors (rounded
+    // up to whole RSM blocks).  Vectors are loaded per chunk and released
+    // after the chunk is written unless previously loaded.  Zero chunk size
+    // means all vectors in one chunk.
+    void write_rsm(std::ostream&, std::size_t chunk_size) const;
+    void write_rsm_file(std::optional<std::filesystem::path> = std::nullopt,
+                        std::size_t chunk_size = 0) const;
 
     bool all_steps_available();
     std::string rootname() { return inputFileName.stem().generic_string(); }
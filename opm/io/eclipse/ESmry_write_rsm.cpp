@@ -36,8 +36,6 @@
 #include <list>
 #include <optional>
 #include <ostream>
-#include <regex>
-#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -91,15 +89,22 @@ namespace {
     }
 
     std::string format_float_element(float element) {
-        std::stringstream ss;
-        static const std::regex integer_regex { "\\.0*$" };
         auto element_string = std::to_string(element);
         if (element_string.size() > 8) {
             element_string = element_string.substr(0, 8);
         }
-        element_string = std::regex_replace(element_string, integer_regex, "");
-        ss << std::setw(8) << std::right << element_string;
-        return ss.str();
+
+        // Strip trailing decimal point and zeros of integral values,
+        // e.g., "100.0000" -> "100".  Called for every output element, so
+        // avoid std::regex here.
+        if (const auto dot = element_string.rfind('.');
+            (dot != std::string::npos) &&
+            (element_string.find_first_not_of('0', dot + 1) == std::string::npos))
+        {
+            element_string.erase(dot);
+        }
+
+        return fmt::format("{:>8}", element_string);
     }
 
     void print_float_element(std::ostream& os, float element) {
@@ -118,6 +123,10 @@ namespace {
         os << '\n';
     }
 
+    /// Time series of single vector and its output scale factor.  Refers
+    /// to data owned by the ESmry object.
+    using ScaledSeries = std::pair<std::reference_wrapper<const std::vector<float>>, int>;
+
     std::string convert_wstat(double numeric_wstat) {
         static const std::unordered_map<int, std::string> wstat_map = {
             {Opm::WStat::numeric::UNKNOWN, Opm::WStat::symbolic::UNKNOWN},
@@ -131,12 +140,13 @@ namespace {
         return wstat_map.at(static_cast<int>(numeric_wstat));
     }
 
-    void write_data_row(std::ostream& os, const std::vector<std::string>& time_column, const std::vector<Opm::EclIO::SummaryNode>& summary_nodes, const std::vector<std::pair<std::vector<float>, int>>& data, std::size_t time_index, char prefix = ' ') {
+    void write_data_row(std::ostream& os, const std::vector<std::string>& time_column, const std::vector<Opm::EclIO::SummaryNode>& summary_nodes, const std::vector<ScaledSeries>& data, std::size_t time_index, char prefix = ' ') {
         os << prefix;
 
         print_time_element( os, time_column[time_index] );
         for (std::size_t row_index = 0; row_index < data.size(); row_index++) {
-            const auto& [time_series, scale_factor] = data[row_index];
+            const auto& time_series = data[row_index].first.get();
+            const auto scale_factor = data[row_index].second;
             const auto& summary_node = summary_nodes[row_index];
 
             if (summary_node.keyword == "WSTAT")
@@ -150,7 +160,7 @@ namespace {
     }
 
     void write_scale_columns(std::ostream& os,
-                             const std::vector<std::pair<std::vector<float>, int>>& data,
+                             const std::vector<ScaledSeries>& data,
                              char prefix = ' ')
     {
         os << prefix;
@@ -182,7 +192,7 @@ void ESmry::write_block(std::ostream& os,
     write_line(os, block_header_line(inputFileName.stem().generic_string()));
     write_line(os, divider_line);
 
-    std::vector<std::pair<std::vector<float>, int>> data;
+    std::vector<ScaledSeries> data;
 
     bool has_scale_factors { false } ;
     for (const auto& vector : vectors) {
@@ -202,11 +212,11 @@ void ESmry::write_block(std::ostream& os,
             has_scale_factors = true;
         }
 
-        data.emplace_back(vector_data, scale_factor);
+        data.emplace_back(std::cref(vector_data), scale_factor);
     }
 
     {
-        std::size_t rows { data[0].first.size() };
+        std::size_t rows { data[0].first.get().size() };
         std::string time_header = "TIME";
         std::string time_unit = "DAYS";
 
@@ -233,6 +243,11 @@ void ESmry::write_block(std::ostream& os,
 }
 
 void ESmry::write_rsm(std::ostream& os) const
+{
+    this->write_rsm(os, 0);
+}
+
+void ESmry::write_rsm(std::ostream& os, const std::size_t chunk_size) const
 {
     bool write_dates = false;
     std::vector<SummaryNode> data_vectors;
@@ -263,7 +278,16 @@ void ESmry::write_rsm(std::ostream& os) const
         data_vector_blocks.emplace_back(data_vectors.begin() + i, data_vectors.begin() + last);
     }
 
-    this->loadData();
+    // Number of blocks to format per chunk.  Zero chunk size means all
+    // blocks in a single chunk.
+    const std::size_t blocks_per_chunk = (chunk_size == 0)
+        ? std::max(data_vector_blocks.size(), std::size_t{1})
+        : std::max((chunk_size + data_column_count - 1) / data_column_count, std::size_t{1});
+
+    if (blocks_per_chunk >= data_vector_blocks.size()) {
+        this->loadData();
+    }
+
     std::vector<std::string> time_column;
     if (this->hasKey("DAY") && this->hasKey("MONTH") && this->hasKey("YEAR")) {
         write_dates = true;
@@ -278,12 +302,42 @@ void ESmry::write_rsm(std::ostream& os) const
                                { return format_float_element(t); });
     }
 
-    for (const auto& data_vector_block : data_vector_blocks) {
-        write_block(os, write_dates, time_column, {data_vector_block.begin(), data_vector_block.end() });
+    for (std::size_t chunk_begin { 0 } ; chunk_begin < data_vector_blocks.size(); chunk_begin += blocks_per_chunk) {
+        const auto chunk_end = std::min(data_vector_blocks.size(), chunk_begin + blocks_per_chunk);
+
+        // Load all vectors of this chunk in one pass over the summary data
+        // and release those which were not already loaded once the chunk
+        // has been written.  This bounds the memory use to a single chunk.
+        std::vector<std::string> chunk_keys;
+        std::vector<std::size_t> chunk_release;
+        for (std::size_t block = chunk_begin; block < chunk_end; ++block) {
+            for (const auto& node : data_vector_blocks[block]) {
+                const auto& key = chunk_keys.emplace_back(this->lookupKey(node));
+                const auto ind = static_cast<std::size_t>(this->keyword_index.at(key));
+                if (!this->vectorLoaded[ind]) {
+                    chunk_release.push_back(ind);
+                }
+            }
+        }
+
+        if (!chunk_release.empty()) {
+            this->loadData(chunk_keys);
+        }
+
+        for (std::size_t block = chunk_begin; block < chunk_end; ++block) {
+            const auto& data_vector_block = data_vector_blocks[block];
+            write_block(os, write_dates, time_column, {data_vector_block.begin(), data_vector_block.end() });
+        }
+
+        for (const auto& ind : chunk_release) {
+            this->vectorData[ind] = std::vector<float>{};
+            this->vectorLoaded[ind] = false;
+        }
     }
 }
 
-void ESmry::write_rsm_file(std::optional<std::filesystem::path> filename) const
+void ESmry::write_rsm_file(std::optional<std::filesystem::path> filename,
+                           const std::size_t                    chunk_size) const
 {
     std::filesystem::path summary_file_name { filename.value_or(inputFileName) } ;
     summary_file_name.replace_extension("RSM");
@@ -294,7 +348,7 @@ void ESmry::write_rsm_file(std::optional<std::filesystem::path> filename) const
         OPM_THROW(std::runtime_error, "Could not open file " + summary_file_name.generic_string() + " for writing");
     }
 
-    write_rsm(rsm_file);
+    write_rsm(rsm_file, chunk_size);
 
     rsm_file.close();
 }
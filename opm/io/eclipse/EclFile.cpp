@@ -24,7 +24,10 @@
 #include <algorithm>
 #include <cstring>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <fstream>
+#include <iterator>
 #include <string>
 #include <numeric>
 #include <cmath>
@@ -117,27 +120,109 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 
 
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
+{
+    createArraySlot(arrIndex);
+    fillBinaryArraySlot(fileH, arrIndex);
+
+    arrayLoaded[arrIndex] = true;
+}
+
+void EclFile::loadBinaryArrays(const std::vector<int>& arrIndex)
+{
+    // Array containers must not be restructured while other threads are
+    // reading into them, so create all destination slots up front.  The
+    // parallel section below only assigns to existing, distinct slots.
+    for (int ind : arrIndex) {
+        createArraySlot(ind);
+    }
+
+    const auto numArrays = static_cast<std::int64_t>(arrIndex.size());
+    std::exception_ptr failure{};
+
+#ifdef _OPENMP
+#pragma omp parallel if (numArrays > 1)
+#endif
+    {
+        // One stream per thread since stream positions are per-object.
+        std::fstream fileH(inputFilename, std::ios::in | std::ios::binary);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (std::int64_t i = 0; i < numArrays; ++i) {
+            try {
+                if (!fileH) {
+                    OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
+                }
+
+                fillBinaryArraySlot(fileH, arrIndex[i]);
+            }
+            catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(EclFile_loadBinaryArrays)
+#endif
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        }
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+
+    for (int ind : arrIndex) {
+        arrayLoaded[ind] = true;
+    }
+}
+
+void EclFile::createArraySlot(std::size_t arrIndex)
+{
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array[arrIndex];
+        break;
+    case REAL:
+        real_array[arrIndex];
+        break;
+    case DOUB:
+        doub_array[arrIndex];
+        break;
+    case LOGI:
+        logi_array[arrIndex];
+        break;
+    case CHAR:
+    case C0NN:
+        char_array[arrIndex];
+        break;
+    default:
+        break;
+    }
+}
+
+void EclFile::fillBinaryArraySlot(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
+        inte_array.find(arrIndex)->second = readBinaryInteArray(fileH, array_size[arrIndex]);
         break;
     case REAL:
-        real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
+        real_array.find(arrIndex)->second = readBinaryRealArray(fileH, array_size[arrIndex]);
         break;
     case DOUB:
-        doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
+        doub_array.find(arrIndex)->second = readBinaryDoubArray(fileH, array_size[arrIndex]);
         break;
     case LOGI:
-        logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
+        logi_array.find(arrIndex)->second = readBinaryLogiArray(fileH, array_size[arrIndex]);
         break;
     case CHAR:
-        char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
+        char_array.find(arrIndex)->second = readBinaryCharArray(fileH, array_size[arrIndex]);
         break;
     case C0NN:
-        char_array[arrIndex] = readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
+        char_array.find(arrIndex)->second = readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
         break;
     case MESS:
         break;
@@ -145,8 +230,6 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
         OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
         break;
     }
-
-    arrayLoaded[arrIndex] = true;
 }
 
 void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
@@ -202,7 +285,9 @@ void EclFile::loadData()
         }
 
         for (std::size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
+            if (!arrayLoaded[i]) {
+                loadBinaryArray(fileH, i);
+            }
         }
 
         fileH.close();
@@ -219,7 +304,7 @@ void EclFile::loadData(const std::string& name)
 
         for (unsigned int arrIndex = 0; arrIndex < array_name.size(); arrIndex++) {
 
-            if (array_name[arrIndex] == name) {
+            if ((array_name[arrIndex] == name) && !arrayLoaded[arrIndex]) {
 
                 inFile.seekg(ifStreamPos[arrIndex]);
 
@@ -245,7 +330,7 @@ void EclFile::loadData(const std::string& name)
         }
 
         for (std::size_t i = 0; i < array_name.size(); i++) {
-            if (array_name[i] == name) {
+            if ((array_name[i] == name) && !arrayLoaded[i]) {
                 loadBinaryArray(fileH, i);
             }
         }
@@ -255,8 +340,14 @@ void EclFile::loadData(const std::string& name)
 }
 
 
-void EclFile::loadData(const std::vector<int>& arrIndex)
+void EclFile::loadData(const std::vector<int>& arrIndices)
 {
+    // Arrays already in memory are not re-read.  Doing so would invalidate
+    // references previously handed out by get().
+    std::vector<int> arrIndex;
+    arrIndex.reserve(arrIndices.size());
+    std::ranges::copy_if(arrIndices, std::back_inserter(arrIndex),
+                         [this](const int ind) { return !arrayLoaded[ind]; });
 
     if (formatted) {
 
@@ -278,24 +369,31 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         }
 
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
-        }
+        loadBinaryArrays(arrIndex);
+    }
+}
 
-        for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
-        }
 
-        fileH.close();
+void EclFile::unloadData(const std::vector<int>& arrIndex)
+{
+    for (int ind : arrIndex) {
+        inte_array.erase(ind);
+        real_array.erase(ind);
+        doub_array.erase(ind);
+        logi_array.erase(ind);
+        char_array.erase(ind);
+
+        arrayLoaded[ind] = false;
     }
 }
 
 
 void EclFile::loadData(int arrIndex)
 {
+    if (arrayLoaded[arrIndex]) {
+        return;
+    }
+
     if (formatted) {
 
         std::ifstream inFile(inputFilename);
@@ -42,11 +42,17 @@ public:
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
     bool formattedInput() const { return formatted; }
 
+    // Arrays which are already loaded are not re-read, so references
+    // returned from get() remain valid until unloadData() or clearData().
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
     void loadData(const std::vector<int>& arrIndex);   // load data based on array indices in vector arrIndex
 
+    // Release data of arrays with indices in vector arrIndex.  Released
+    // arrays are reloaded on demand.
+    void unloadData(const std::vector<int>& arrIndex);
+
     void clearData()
     {
       inte_array.clear();
@@ -107,6 +113,9 @@ private:
     std::vector<bool> arrayLoaded;
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void loadBinaryArrays(const std::vector<int>& arrIndex);
+    void createArraySlot(std::size_t arrIndex);
+    void fillBinaryArraySlot(std::fstream& fileH, std::size_t arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
     void load(bool preload);
 
@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <ios>
 #include <iostream>
@@ -234,10 +235,7 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, std::int64_t size,
 template <typename T>
 void EclOutput::writeBinaryArray(const std::vector<T>& data)
 {
-    int num;
-    std::int64_t rest, offset;
-    int dhead;
-    std::int64_t size = data.size();
+    const auto size = static_cast<std::int64_t>(data.size());
 
     eclArrType arrType = MESS;
 
@@ -254,92 +252,75 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         arrType = LOGI;
     }
 
-    auto sizeData = block_size_data_binary(arrType);
-
-    int sizeOfElement = std::get<0>(sizeData);
-    int maxBlockSize = std::get<1>(sizeData);
-    int maxNumberOfElements = maxBlockSize / sizeOfElement;
+    const auto [sizeOfElement, maxBlockSize] = block_size_data_binary(arrType);
+    const int maxNumberOfElements = maxBlockSize / sizeOfElement;
 
     if (!ofileH.is_open()) {
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
-    int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
-
-    rest = size * static_cast<std::int64_t>(sizeOfElement);
-
-    offset = 0;
-
-    while (rest > 0) {
-        if (rest > maxBlockSize) {
-            rest -= maxBlockSize;
-            num = maxNumberOfElements;
-        } else {
-            num = static_cast<int>(rest) / sizeOfElement;
-            rest = 0;
+    if constexpr (std::is_same_v<T, char>) {
+        if (size > 0) {
+            std::cerr << "type not supported in write binaryarray\n";
+            std::exit(EXIT_FAILURE);
         }
+    }
+    else {
+        const int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
 
-        dhead = flipEndianInt(num * sizeOfElement);
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
-        if (arrType == INTE) {
-
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianInt(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
-
-        } else if (arrType == REAL) {
-
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
+        // Assemble complete records, including record markers, in the
+        // write buffer and hand them to the stream in batches of up to
+        // writeBufferSize bytes.
+        const auto markerSize = static_cast<std::int64_t>(sizeof(int));
+        const auto maxRecordSize = maxBlockSize + 2*markerSize;
+        const auto maxRecordsPerBatch = std::max(std::int64_t{1}, writeBufferSize / maxRecordSize);
 
-        } else if (arrType == DOUB) {
+        std::int64_t offset = 0;
+        while (offset < size) {
+            const auto numRecords = std::min(maxRecordsPerBatch,
+                                             (size - offset + maxNumberOfElements - 1) / maxNumberOfElements);
 
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
+            const auto numElements = std::min(size - offset, numRecords * maxNumberOfElements);
+            const auto batchSize = numElements*sizeOfElement + numRecords*2*markerSize;
 
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
+            if (static_cast<std::int64_t>(this->writeBuffer_.size()) < batchSize) {
+                this->writeBuffer_.resize(batchSize);
             }
 
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
+            char* p = this->writeBuffer_.data();
+            for (auto r = 0*numRecords; r < numRecords; ++r) {
+                const auto num = static_cast<int>(std::min(size - offset, std::int64_t{maxNumberOfElements}));
+                const auto dhead = flipEndianInt(num * sizeOfElement);
 
-            std::vector<int> logi_data;
-            logi_data.resize(num, 0);
+                std::memcpy(p, &dhead, sizeof dhead);
+                p += markerSize;
 
-            for (int m = 0; m < num; ++m) {
-                if (data[m + offset]) {
-                    logi_data[m] = logi_true_val;
+                if constexpr (std::is_same_v<T, bool>) {
+                    for (int m = 0; m < num; ++m, p += sizeof(int)) {
+                        const int value = data[m + offset] ? logi_true_val : false_value;
+                        std::memcpy(p, &value, sizeof value);
+                    }
                 }
                 else {
-                    logi_data[m] = false_value;
+                    const auto* src = reinterpret_cast<const char*>(data.data() + offset);
+                    if constexpr (sizeof(T) == 4) {
+                        flipEndian32(src, p, num);
+                    }
+                    else {
+                        flipEndian64(src, p, num);
+                    }
+
+                    p += static_cast<std::size_t>(num) * sizeof(T);
                 }
-            }
 
-            ofileH.write(reinterpret_cast<char*>(logi_data.data()), logi_data.size() * sizeof(int)) ;
+                std::memcpy(p, &dhead, sizeof dhead);
+                p += markerSize;
 
-        } else {
+                offset += num;
+            }
 
-            std::cerr << "type not supported in write binaryarray\n";
-            std::exit(EXIT_FAILURE);
+            ofileH.write(this->writeBuffer_.data(), p - this->writeBuffer_.data());
         }
-
-        offset += num;
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
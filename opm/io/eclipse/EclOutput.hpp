@@ -134,8 +134,14 @@ private:
     std::string make_doub_string_ecl(double value) const;
     std::string make_doub_string_ix(double value) const;
 
+    /// Upper limit, in bytes, of a single batch of binary records.
+    static constexpr std::int64_t writeBufferSize = std::int64_t{1} << 20;
+
     bool isFormatted, ix_standard;
     std::ofstream ofileH;
+
+    /// Staging area for binary records.  Reused across arrays.
+    std::vector<char> writeBuffer_{};
 };
 
 template<>
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
@@ -38,34 +39,111 @@
 #include <intrin.h>
 #endif
 
-int Opm::EclIO::flipEndianInt(int num)
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+std::uint32_t byteSwap32(const std::uint32_t x)
 {
 #ifdef _MSC_VER
-    unsigned int tmp = _byteswap_ulong(num);
-    return static_cast<int>(tmp);
+    return _byteswap_ulong(x);
 #else
-    unsigned int tmp = __builtin_bswap32(num);
-    return static_cast<int>(tmp);
+    return __builtin_bswap32(x);
 #endif
 }
 
-std::int64_t Opm::EclIO::flipEndianLongInt(std::int64_t num)
+std::uint64_t byteSwap64(const std::uint64_t x)
 {
 #ifdef _MSC_VER
-    std::uint64_t tmp = _byteswap_uint64(num);
-    return static_cast<std::int64_t>(tmp);
+    return _byteswap_uint64(x);
 #else
-    std::uint64_t tmp = __builtin_bswap64(num);
-    return static_cast<std::int64_t>(tmp);
+    return __builtin_bswap64(x);
+#endif
+}
+
+template <typename UInt, typename Swap>
+void flipEndianScalar(const char* src, char* dst, const std::size_t n, Swap swap)
+{
+    for (auto i = 0*n; i < n; ++i) {
+        UInt x;
+        std::memcpy(&x, src + i*sizeof x, sizeof x);
+        x = swap(x);
+        std::memcpy(dst + i*sizeof x, &x, sizeof x);
+    }
+}
+
+// Byte swap of 16-byte vectors.  Returns number of bytes processed, the
+// remainder being left to the scalar loop.
+template <std::size_t ElemSize>
+std::size_t flipEndianVector([[maybe_unused]] const char* src,
+                             [[maybe_unused]] char*       dst,
+                             [[maybe_unused]] const std::size_t nbytes)
+{
+    std::size_t i = 0;
+
+#if defined(__SSSE3__)
+    const auto mask = (ElemSize == 4)
+        ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+        : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    for (; i + 16 <= nbytes; i += 16) {
+        const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    for (; i + 16 <= nbytes; i += 16) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+        // Swap bytes within 16-bit words, then reverse the words.
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        if constexpr (ElemSize == 4) {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        else {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 16 <= nbytes; i += 16) {
+        const auto v = vld1q_u8(reinterpret_cast<const std::uint8_t*>(src + i));
+        vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + i),
+                 (ElemSize == 4) ? vrev32q_u8(v) : vrev64q_u8(v));
+    }
 #endif
+
+    return i;
+}
+
+} // Anonymous namespace
+
+int Opm::EclIO::flipEndianInt(int num)
+{
+    return static_cast<int>(byteSwap32(static_cast<std::uint32_t>(num)));
+}
+
+std::int64_t Opm::EclIO::flipEndianLongInt(std::int64_t num)
+{
+    return static_cast<std::int64_t>(byteSwap64(static_cast<std::uint64_t>(num)));
 }
 
 float Opm::EclIO::flipEndianFloat(float num)
 {
-    float value = num;
+    std::uint32_t x;
+    std::memcpy(&x, &num, sizeof x);
+    x = byteSwap32(x);
 
-    char* floatToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(floatToConvert, floatToConvert+4);
+    float value;
+    std::memcpy(&value, &x, sizeof value);
 
     return value;
 }
@@ -73,14 +151,30 @@ float Opm::EclIO::flipEndianFloat(float num)
 
 double Opm::EclIO::flipEndianDouble(double num)
 {
-    double value = num;
+    std::uint64_t x;
+    std::memcpy(&x, &num, sizeof x);
+    x = byteSwap64(x);
 
-    char* doubleToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(doubleToConvert, doubleToConvert+8);
+    double value;
+    std::memcpy(&value, &x, sizeof value);
 
     return value;
 }
 
+void Opm::EclIO::flipEndian32(const char* src, char* dst, const std::size_t n)
+{
+    const auto done = flipEndianVector<4>(src, dst, 4 * n);
+
+    flipEndianScalar<std::uint32_t>(src + done, dst + done, n - done/4, byteSwap32);
+}
+
+void Opm::EclIO::flipEndian64(const char* src, char* dst, const std::size_t n)
+{
+    const auto done = flipEndianVector<8>(src, dst, 8 * n);
+
+    flipEndianScalar<std::uint64_t>(src + done, dst + done, n - done/8, byteSwap64);
+}
+
 bool Opm::EclIO::fileExists(const std::string& filename){
 
     std::ifstream fileH(filename.c_str());
@@ -506,53 +600,129 @@ std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64
 }
 
 
+namespace {
+
+// Numeric and logical arrays.  Reads batches of complete records, of up
+// to about 1 MiB, in a single stream operation, checks the record markers
+// and copies the payload into the result with a bulk byte swap.
+template <typename T>
+std::vector<T> readBinaryNumericArray(std::fstream& fileH,
+                                      const std::int64_t size,
+                                      const Opm::EclIO::eclArrType type)
+{
+    const auto [sizeOfElement, maxBlockSize] = Opm::EclIO::block_size_data_binary(type);
+    const int maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+    const auto markerSize = static_cast<std::int64_t>(sizeof(int));
+    const auto maxRecordSize = maxBlockSize + 2*markerSize;
+    const auto maxRecordsPerBatch = std::max(std::int64_t{1}, (std::int64_t{1} << 20) / maxRecordSize);
+
+    std::vector<T> arr(std::max(size, std::int64_t{0}));
+    auto* dest = reinterpret_cast<char*>(arr.data());
+
+    std::vector<char> buffer;
+
+    std::int64_t offset = 0;
+    while (offset < size) {
+        const auto numRecords = std::min(maxRecordsPerBatch,
+                                         (size - offset + maxNumberOfElements - 1) / maxNumberOfElements);
+
+        const auto numElements = std::min(size - offset, numRecords * maxNumberOfElements);
+
+        buffer.resize(numElements*sizeOfElement + numRecords*2*markerSize);
+        fileH.read(buffer.data(), buffer.size());
+
+        if (fileH.gcount() != static_cast<std::streamsize>(buffer.size())) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file");
+        }
+
+        const char* p = buffer.data();
+        for (auto r = 0*numRecords; r < numRecords; ++r) {
+            int dhead;
+            std::memcpy(&dhead, p, sizeof dhead);
+            dhead = Opm::EclIO::flipEndianInt(dhead);
+            p += markerSize;
+
+            const int num = dhead / sizeOfElement;
+            const auto expected = std::min(size - offset, std::int64_t{maxNumberOfElements});
+
+            if ((num > maxNumberOfElements) || (num < 0)) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+            }
+
+            if (num != expected) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, incorrect number of elements");
+            }
+
+            const auto nbytes = static_cast<std::size_t>(num) * sizeOfElement;
+            if (type == Opm::EclIO::LOGI) {
+                std::memcpy(dest, p, nbytes);
+            }
+            else if constexpr (sizeof(T) == 4) {
+                Opm::EclIO::flipEndian32(p, dest, num);
+            }
+            else {
+                Opm::EclIO::flipEndian64(p, dest, num);
+            }
+
+            p += nbytes;
+            dest += nbytes;
+            offset += num;
+
+            int dtail;
+            std::memcpy(&dtail, p, sizeof dtail);
+            dtail = Opm::EclIO::flipEndianInt(dtail);
+            p += markerSize;
+
+            if (dhead != dtail) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+            }
+        }
+    }
+
+    return arr;
+}
+
+} // Anonymous namespace
+
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    return readBinaryNumericArray<int>(fileH, size, Opm::EclIO::INTE);
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    return readBinaryNumericArray<float>(fileH, size, Opm::EclIO::REAL);
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    return readBinaryNumericArray<double>(fileH, size, Opm::EclIO::DOUB);
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<bool(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              bool value = false;
-                                              if (intVal == Opm::EclIO::true_value_ecl) {
-                                                  value = true;
-                                              } else if (intVal == Opm::EclIO::false_value) {
-                                                  value = false;
-                                              } else if (intVal == Opm::EclIO::true_value_ix) {
-                                                  value = true;
-                                              } else {
-                                                  OPM_THROW(std::runtime_error, "Error reading logi value");
-                                              }
-
-                                              return value;
-                                          };
-    return readBinaryArray<bool,unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    const auto raw = readBinaryNumericArray<unsigned int>(fileH, size, Opm::EclIO::LOGI);
+
+    std::vector<bool> arr(raw.size());
+    for (auto i = 0*raw.size(); i < raw.size(); ++i) {
+        const auto intVal = raw[i];
+
+        if ((intVal == Opm::EclIO::true_value_ecl) || (intVal == Opm::EclIO::true_value_ix)) {
+            arr[i] = true;
+        } else if (intVal != Opm::EclIO::false_value) {
+            OPM_THROW(std::runtime_error, "Error reading logi value");
+        }
+    }
+
+    return arr;
 }
 
 std::vector<unsigned int> Opm::EclIO::readBinaryRawLogiArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<unsigned int(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              return intVal;
-                                          };
-    return readBinaryArray<unsigned int, unsigned int>(fileH, size, Opm::EclIO::LOGI, f, sizeOfLogi);
+    return readBinaryNumericArray<unsigned int>(fileH, size, Opm::EclIO::LOGI);
 }
 
 
@@ -708,3 +878,104 @@ std::vector<double> Opm::EclIO::readFormattedDoubArray(const std::string& file_s
 
     return readFormattedArray<double>(file_str, size, fromPos, f);
 }
+
+std::vector<int> Opm::EclIO::encodeDeltaShuffle(const std::vector<float>& values)
+{
+    const auto n = values.size();
+
+    // XOR-delta against predecessor and split into byte planes, most
+    // significant byte plane first.
+    std::vector<unsigned char> planes(4 * n);
+    std::uint32_t prev = 0;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &values[i], sizeof bits);
+
+        const auto delta = bits ^ prev;
+        prev = bits;
+
+        for (std::size_t p = 0; p < 4; ++p) {
+            planes[p*n + i] = static_cast<unsigned char>(delta >> (24 - 8*p));
+        }
+    }
+
+    // Zero-run encoding: a zero byte is followed by the run length.
+    std::vector<unsigned char> stream;
+    stream.reserve(planes.size() / 4 + 4);
+
+    for (std::size_t i = 0; i < planes.size(); ) {
+        if (planes[i] != 0) {
+            stream.push_back(planes[i++]);
+            continue;
+        }
+
+        std::size_t run = 0;
+        while ((i < planes.size()) && (planes[i] == 0) && (run < 255)) {
+            ++i;
+            ++run;
+        }
+
+        stream.push_back(0);
+        stream.push_back(static_cast<unsigned char>(run));
+    }
+
+    std::vector<std::uint32_t> packed((stream.size() + 3) / 4, 0);
+    for (std::size_t i = 0; i < stream.size(); ++i) {
+        packed[i / 4] |= static_cast<std::uint32_t>(stream[i]) << (24 - 8*(i % 4));
+    }
+
+    return { packed.begin(), packed.end() };
+}
+
+std::vector<float> Opm::EclIO::decodeDeltaShuffle(const std::vector<int>& words,
+                                                  const std::size_t       numValues)
+{
+    const auto numBytes = 4 * words.size();
+    auto byte = [&words](const std::size_t i)
+    {
+        const auto w = static_cast<std::uint32_t>(words[i / 4]);
+        return static_cast<unsigned char>(w >> (24 - 8*(i % 4)));
+    };
+
+    std::vector<unsigned char> planes(4 * numValues, 0);
+
+    std::size_t out = 0;
+    for (std::size_t i = 0; out < planes.size(); ) {
+        if (i >= numBytes) {
+            OPM_THROW(std::runtime_error, "Truncated compressed summary vector");
+        }
+
+        const auto b = byte(i++);
+        if (b != 0) {
+            planes[out++] = b;
+            continue;
+        }
+
+        if (i >= numBytes) {
+            OPM_THROW(std::runtime_error, "Truncated compressed summary vector");
+        }
+
+        const std::size_t run = byte(i++);
+        if ((run == 0) || (out + run > planes.size())) {
+            OPM_THROW(std::runtime_error, "Corrupt compressed summary vector");
+        }
+
+        out += run;             // Planes are zero initialised.
+    }
+
+    std::vector<float> values(numValues);
+    std::uint32_t prev = 0;
+
+    for (std::size_t i = 0; i < numValues; ++i) {
+        std::uint32_t delta = 0;
+        for (std::size_t p = 0; p < 4; ++p) {
+            delta |= static_cast<std::uint32_t>(planes[p*numValues + i]) << (24 - 8*p);
+        }
+
+        prev ^= delta;
+        std::memcpy(&values[i], &prev, sizeof prev);
+    }
+
+    return values;
+}
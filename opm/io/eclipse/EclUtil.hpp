@@ -22,6 +22,7 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -34,6 +35,23 @@ namespace Opm { namespace EclIO {
     std::int64_t flipEndianLongInt(std::int64_t num);
     float flipEndianFloat(float num);
     double flipEndianDouble(double num);
+
+    /// Reverse the byte order of a sequence of four-byte elements.
+    ///
+    /// Uses SIMD byte shuffles where available.
+    ///
+    /// \param[in] src Start of \p n packed input elements.
+    ///
+    /// \param[out] dst Start of \p n packed output elements.  May be
+    ///   equal to \p src, but must not otherwise overlap the input.
+    ///
+    /// \param[in] n Number of elements.
+    void flipEndian32(const char* src, char* dst, std::size_t n);
+
+    /// Reverse the byte order of a sequence of eight-byte elements.
+    ///
+    /// Eight-byte counterpart of flipEndian32().
+    void flipEndian64(const char* src, char* dst, std::size_t n);
     bool isEOF(std::fstream* fileH);
     bool fileExists(const std::string& filename);
     bool isFormatted(const std::string& filename);
@@ -94,6 +112,30 @@ namespace Opm { namespace EclIO {
     std::vector<bool> readFormattedLogiArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos);
     std::vector<double> readFormattedDoubArray(const std::string& file_str, const std::int64_t size, std::int64_t fromPos);
 
+    /// Compress a time series of summary values.
+    ///
+    /// Values are XOR-delta encoded against their predecessor, split into
+    /// byte planes (byte shuffle), and runs of zero bytes are run-length
+    /// encoded.  Slowly varying and constant series compress well.
+    ///
+    /// \param[in] values Time series values.
+    ///
+    /// \return Encoded byte stream packed into 32-bit words, most
+    ///   significant byte first, suitable for output as an INTE array.
+    std::vector<int> encodeDeltaShuffle(const std::vector<float>& values);
+
+    /// Decompress a time series of summary values.
+    ///
+    /// Inverse of encodeDeltaShuffle().
+    ///
+    /// \param[in] words Encoded byte stream packed into 32-bit words.
+    ///
+    /// \param[in] numValues Number of values in time series.
+    ///
+    /// \return Decoded time series values.
+    std::vector<float> decodeDeltaShuffle(const std::vector<int>& words,
+                                          const std::size_t       numValues);
+
 }} // namespace Opm::EclIO
 
 #endif // OPM_IO_ECLUTIL_HPP
@@ -111,13 +111,14 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
     ExtSmryHeadType ext_esmry_head;
 
     std::uint64_t rstep_offset;
+    FileLayout layout;
 
-    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset, layout);
     int n_attempts = 1;
 
     while ((!res) && (n_attempts < 10)){
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset, layout);
         n_attempts ++;
     }
 
@@ -126,6 +127,7 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
     m_startdat = std::get<0>(ext_esmry_head);
     m_rstep_offset.push_back(rstep_offset);
+    m_layout.push_back(std::move(layout));
 
     std::map<std::string, int> key_index;
 
@@ -169,10 +171,11 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
             m_esmry_files.push_back(rstESmryFile);
 
-            if (!open_esmry(rstESmryFile, ext_esmry_head, rstep_offset))
+            if (!open_esmry(rstESmryFile, ext_esmry_head, rstep_offset, layout))
                 OPM_THROW( std::runtime_error, "when opening ESMRY file" + rstESmryFile.string() );
 
             m_rstep_offset.push_back(rstep_offset);
+            m_layout.push_back(std::move(layout));
 
             m_rstep_v.push_back(std::get<4>(ext_esmry_head));
             m_tstep_v.push_back(std::get<5>(ext_esmry_head));
@@ -256,7 +259,8 @@ bool ExtESmry::all_steps_available()
     return true;
 }
 
-bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, std::uint64_t& rstep_offset)
+bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head,
+                          std::uint64_t& rstep_offset, FileLayout& layout)
 {
     std::fstream fileH;
 
@@ -362,11 +366,37 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
         return false;
     }
 
+    std::vector<int> rstep;
+    std::vector<int> tstep;
+
+    layout = FileLayout{};
+
+    if ((arrName == "CHUNKED ") && (arrType == Opm::EclIO::INTE)) {
+
+        try {
+            Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+        } catch (const std::runtime_error& error)
+        {
+            return false;
+        }
+
+        layout.chunked = true;
+
+        // Only complete blocks are considered.  Data beyond the last
+        // complete block may still be in the process of being written.
+        const auto fileSize = static_cast<std::uint64_t>(std::filesystem::file_size(inputFileName));
+
+        while (read_chunk_index(fileH, fileSize, keywords.size(), rstep, tstep, layout))
+            ;
+
+        ext_smry_head = std::make_tuple(startdat, rst_entry, keywords, units, rstep, tstep);
+
+        return true;
+    }
+
     if ((arrName != "RSTEP   ") or (arrType != Opm::EclIO::INTE))
         OPM_THROW(std::invalid_argument, "Reading RSTEP, invalid esmry file " + inputFileName.string() );
 
-    std::vector<int> rstep;
-
     try {
         rstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
     } catch (const std::runtime_error& error)
@@ -384,8 +414,6 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
     if ((arrName != "TSTEP   ") or (arrType != Opm::EclIO::INTE))
         OPM_THROW(std::invalid_argument, "reading TSTEP, invalid esmry file " + inputFileName.string() );
 
-    std::vector<int> tstep;
-
     try {
         tstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
     } catch (const std::runtime_error& error)
@@ -413,88 +441,245 @@ void ExtESmry::updatePathAndRootName(std::filesystem::path& dir, std::filesystem
 }
 
 
-bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
-                               const std::vector<int>& loadKeyIndex, int ind, int to_ind )
+bool ExtESmry::read_chunk_index(std::fstream& fileH, const std::uint64_t fileSize, const std::size_t numKeys,
+                                std::vector<int>& rstep, std::vector<int>& tstep, FileLayout& layout)
 {
-    std::fstream fileH;
-
-    fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
-
-    if (!fileH)
-        return false;
-
     std::string arrName;
+    std::int64_t arr_size;
     Opm::EclIO::eclArrType arrType;
-    std::int64_t num_tstep;
     int sizeOfElement;
 
-    // Read actual number of time steps on disk from RSTEP array before loading
-    // data. Notice that number of time steps can be different than what it was when
-    // the ESMRY file was opened. The simulation may have progressed if this is an
-    // ESMRY file from an active run
+    if (static_cast<std::uint64_t>(fileH.tellg()) + 24 > fileSize)
+        return false;
 
-    fileH.seekg (m_rstep_offset[ind], fileH.beg);
+    ChunkIndex chunk;
+    std::vector<int> block_rstep;
+    std::vector<int> block_tstep;
 
     try {
-        Opm::EclIO::readBinaryHeader(fileH, arrName, num_tstep, arrType, sizeOfElement);
+        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if ((arrName != "BLKINDEX") || (arrType != Opm::EclIO::INTE))
+            return false;
+
+        const auto index = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+
+        if (index.size() != numKeys + 2)
+            return false;
+
+        chunk.numSteps = index[0];
+        chunk.compression = index[1];
+
+        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if (arrName != "RSTEP   ")
+            return false;
+
+        block_rstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+
+        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if (arrName != "TSTEP   ")
+            return false;
+
+        block_tstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+
+        const auto type = (chunk.compression == 0) ? Opm::EclIO::REAL : Opm::EclIO::INTE;
+        auto pos = static_cast<std::uint64_t>(fileH.tellg());
+
+        chunk.columnPos.reserve(numKeys);
+        chunk.columnSize.reserve(numKeys);
+
+        for (std::size_t k = 0; k < numKeys; ++k) {
+            chunk.columnPos.push_back(pos);
+            chunk.columnSize.push_back(index[k + 2]);
+
+            pos += 24 + sizeOnDiskBinary(index[k + 2], type, 4);
+        }
+
+        if (pos > fileSize)
+            return false;
+
+        fileH.seekg(static_cast<std::streamoff>(pos), std::ios_base::beg);
     } catch (const std::runtime_error& error)
     {
         return false;
     }
 
+    if ((block_rstep.size() != static_cast<std::size_t>(chunk.numSteps)) ||
+        (block_tstep.size() != static_cast<std::size_t>(chunk.numSteps)))
+        return false;
+
+    rstep.insert(rstep.end(), block_rstep.begin(), block_rstep.end());
+    tstep.insert(tstep.end(), block_tstep.begin(), block_tstep.end());
+
+    layout.chunks.push_back(std::move(chunk));
+
+    return true;
+}
+
+bool ExtESmry::read_contiguous_vector(std::fstream& fileH, const std::uint64_t rstep_offset, const std::int64_t num_tstep,
+                                      const int key_ind, std::vector<float>& data)
+{
     auto smry_arr_size = sizeOnDiskBinary(num_tstep, Opm::EclIO::REAL, sizeOfReal);
 
-    std::vector<std::vector<float>> smry_data;
-    smry_data.resize(loadKeyIndex.size(), {});
+    std::uint64_t pos = rstep_offset + smry_arr_size*static_cast<std::uint64_t>(key_ind);
 
-    for (std::size_t n = 0 ; n < loadKeyIndex.size(); n++) {
+    // adding size of TSTEP and RSTEP INTE data
+    pos = pos + 2 * sizeOnDiskBinary(num_tstep, Opm::EclIO::INTE, sizeOfInte);
 
-        const auto& key = stringVect[loadKeyIndex[n]];
+    pos = pos + static_cast<std::uint64_t>(2 * 24);  // adding size of binary headers (TSTEP and RSTEP)
+    pos = pos + static_cast<std::uint64_t>(key_ind * 24);  // adding size of binary headers
 
-        if ( m_keyword_index[ind].find(key) == m_keyword_index[ind].end() ) {
+    fileH.seekg (pos, fileH.beg);
 
-            smry_data[n].resize(to_ind + 1, 0.0 );
+    std::string arrName;
+    Opm::EclIO::eclArrType arrType;
+    std::int64_t size;
+    int sizeOfElement;
 
-        } else {
+    try {
+        readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
+
+        if (Opm::EclIO::trimr(arrName) != "V" + std::to_string(key_ind))
+            return false;
+
+        data = readBinaryRealArray(fileH, size);
+    } catch (const std::runtime_error& error)
+    {
+        return false;
+    }
 
-            int key_ind = m_keyword_index[ind].at(key);
+    return true;
+}
 
-            std::uint64_t pos = m_rstep_offset[ind] + smry_arr_size*static_cast<std::uint64_t>(key_ind);
+bool ExtESmry::read_chunked_vector(std::fstream& fileH, const FileLayout& layout, const int key_ind,
+                                   const std::size_t numValues, std::vector<float>& data)
+{
+    std::string arrName;
+    Opm::EclIO::eclArrType arrType;
+    std::int64_t size;
+    int sizeOfElement;
 
-            // adding size of TSTEP and RSTEP INTE data
-            pos = pos + 2 * sizeOnDiskBinary(num_tstep, Opm::EclIO::INTE, sizeOfInte);
+    data.clear();
+    data.reserve(numValues);
 
-            pos = pos + static_cast<std::uint64_t>(2 * 24);  // adding size of binary headers (TSTEP and RSTEP)
-            pos = pos + static_cast<std::uint64_t>(key_ind * 24);  // adding size of binary headers
+    for (const auto& chunk : layout.chunks) {
+        if (data.size() >= numValues)
+            break;
 
-            fileH.seekg (pos, fileH.beg);
+        fileH.seekg(static_cast<std::streamoff>(chunk.columnPos[key_ind]), std::ios_base::beg);
 
-            std::int64_t size;
+        try {
+            readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
 
-            try {
-                readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
-            } catch (const std::runtime_error& error)
-            {
+            if (size != chunk.columnSize[key_ind])
                 return false;
+
+            if (chunk.compression == 0) {
+                if (Opm::EclIO::trimr(arrName) != "V" + std::to_string(key_ind))
+                    return false;
+
+                const auto values = readBinaryRealArray(fileH, size);
+                data.insert(data.end(), values.begin(), values.end());
             }
+            else {
+                if (Opm::EclIO::trimr(arrName) != "C" + std::to_string(key_ind))
+                    return false;
 
-            arrName = Opm::EclIO::trimr(arrName);
+                const auto values = decodeDeltaShuffle(readBinaryInteArray(fileH, size), chunk.numSteps);
+                data.insert(data.end(), values.begin(), values.end());
+            }
+        } catch (const std::runtime_error& error)
+        {
+            return false;
+        }
+    }
 
-            std::string checkName = "V" + std::to_string(key_ind);
+    return data.size() >= numValues;
+}
 
-            if (arrName != checkName)
-                return false;
+bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
+                               const std::vector<int>& loadKeyIndex, int ind, int to_ind )
+{
+    const auto& layout = m_layout[ind];
 
-            try {
-                smry_data[n] = readBinaryRealArray(fileH, size);
-            } catch (const std::runtime_error& error)
-            {
-                return false;
+    std::int64_t num_tstep = 0;
+
+    if (! layout.chunked) {
+        std::fstream fileH;
+
+        fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
+
+        if (!fileH)
+            return false;
+
+        std::string arrName;
+        Opm::EclIO::eclArrType arrType;
+        int sizeOfElement;
+
+        // Read actual number of time steps on disk from RSTEP array before loading
+        // data. Notice that number of time steps can be different than what it was when
+        // the ESMRY file was opened. The simulation may have progressed if this is an
+        // ESMRY file from an active run
+
+        fileH.seekg (m_rstep_offset[ind], fileH.beg);
+
+        try {
+            Opm::EclIO::readBinaryHeader(fileH, arrName, num_tstep, arrType, sizeOfElement);
+        } catch (const std::runtime_error& error)
+        {
+            return false;
+        }
+    }
+
+    std::vector<std::vector<float>> smry_data;
+    smry_data.resize(loadKeyIndex.size(), {});
+
+    const auto numLoad = static_cast<std::int64_t>(loadKeyIndex.size());
+    bool success = true;
+
+    // Vectors are independent of each other, so read (and decode) them
+    // concurrently using one file handle per thread.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::fstream fileH(m_esmry_files[ind], std::ios::in |  std::ios::binary);
+        bool local_success = static_cast<bool>(fileH);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (std::int64_t n = 0 ; n < numLoad; n++) {
+            if (!local_success)
+                continue;
+
+            const auto& key = stringVect[loadKeyIndex[n]];
+            const auto key_pos = m_keyword_index[ind].find(key);
+
+            if (key_pos == m_keyword_index[ind].end()) {
+                smry_data[n].resize(to_ind + 1, 0.0 );
+            }
+            else if (layout.chunked) {
+                local_success = read_chunked_vector(fileH, layout, key_pos->second, to_ind + 1, smry_data[n]);
+            }
+            else {
+                local_success = read_contiguous_vector(fileH, m_rstep_offset[ind], num_tstep,
+                                                       key_pos->second, smry_data[n]);
             }
         }
+
+        if (!local_success) {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+            success = false;
+        }
     }
 
-    fileH.close();
+    if (!success)
+        return false;
 
     for (std::size_t n = 0 ; n < loadKeyIndex.size(); n++)
         m_vectorData[keyIndexVect[n]].insert(m_vectorData[keyIndexVect[n]].end(), smry_data[n].begin(), smry_data[n].begin() + to_ind + 1);
@@ -25,6 +25,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -96,13 +97,41 @@ private:
 
     std::vector<std::uint64_t> m_rstep_offset;
 
+    // On-disk location of all vectors in one block of a chunked ESMRY file.
+    struct ChunkIndex
+    {
+        std::int64_t numSteps;
+        int compression;
+        std::vector<std::uint64_t> columnPos;
+        std::vector<std::int64_t> columnSize;
+    };
+
+    struct FileLayout
+    {
+        bool chunked{false};
+        std::vector<ChunkIndex> chunks{};
+    };
+
+    // One entry for each file in m_esmry_files
+    std::vector<FileLayout> m_layout;
+
     time_point m_startdat;
     std::vector<int> m_start_vect;
 
     double m_io_opening;
     double m_io_loading;
 
-    bool open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, std::uint64_t& rstep_offset);
+    bool open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head,
+                    std::uint64_t& rstep_offset, FileLayout& layout);
+
+    static bool read_chunk_index(std::fstream& fileH, std::uint64_t fileSize, std::size_t numKeys,
+                                 std::vector<int>& rstep, std::vector<int>& tstep, FileLayout& layout);
+
+    static bool read_contiguous_vector(std::fstream& fileH, std::uint64_t rstep_offset, std::int64_t num_tstep,
+                                       int key_ind, std::vector<float>& data);
+
+    static bool read_chunked_vector(std::fstream& fileH, const FileLayout& layout, int key_ind,
+                                    std::size_t numValues, std::vector<float>& data);
 
     bool load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind );
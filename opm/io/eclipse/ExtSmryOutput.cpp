@@ -26,7 +26,9 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <stdexcept>
 #include <string>
@@ -35,6 +37,12 @@ namespace Opm { namespace EclIO {
 
 ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const std::vector<std::string>& valueUnits,
                  const EclipseState& es, const time_t start_time)
+    : ExtSmryOutput(valueKeys, valueUnits, es, start_time, Options{})
+{}
+
+ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const std::vector<std::string>& valueUnits,
+                 const EclipseState& es, const time_t start_time, const Options& options)
+    : m_options { options }
 {
     m_nVect = valueKeys.size();
     m_nTimeSteps = 0;
@@ -61,15 +69,41 @@ ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const st
     m_smry_keys = this->make_modified_keys(valueKeys, dims);
     m_smryUnits = valueUnits;
 
+    this->set_start_date(start_time);
+
+    for (std::size_t n = 0; n < static_cast<std::size_t>(m_nVect); n++)
+        m_smrydata.push_back({});
+}
+
+ExtSmryOutput::ExtSmryOutput(const std::string& outputFileName,
+                             const std::vector<std::string>& smryKeys,
+                             const std::vector<std::string>& smryUnits,
+                             const time_t start_time,
+                             const Options& options)
+    : m_options { options }
+    , m_outputFileName { outputFileName }
+    , m_nTimeSteps { 0 }
+    , m_nVect { static_cast<int>(smryKeys.size()) }
+    , m_fmt { false }
+    , m_restart_rootn {}
+    , m_restart_step { -1 }
+    , m_smry_keys { smryKeys }
+    , m_smryUnits { smryUnits }
+    , m_smrydata ( smryKeys.size() )
+{
+    m_last_write = std::chrono::system_clock::now();
+
+    this->set_start_date(start_time);
+}
+
+void ExtSmryOutput::set_start_date(const time_t start_time)
+{
     Opm::time_point startdat = Opm::TimeService::from_time_t(start_time);
 
     Opm::TimeStampUTC ts( std::chrono::system_clock::to_time_t( startdat ));
 
     m_start_date_vect = {ts.day(), ts.month(), ts.year(),
         ts.hour(), ts.minutes(), ts.seconds(), 0 };
-
-    for (std::size_t n = 0; n < static_cast<std::size_t>(m_nVect); n++)
-        m_smrydata.push_back({});
 }
 
 void ExtSmryOutput::write(const std::vector<float>& ts_data, int report_step, bool is_final_summary)
@@ -97,48 +131,144 @@ void ExtSmryOutput::write(const std::vector<float>& ts_data, int report_step, bo
     for (std::size_t n = 0; n < static_cast<std::size_t>(m_nVect); n++)
         m_smrydata[n].push_back(ts_data[n]);
 
-    if ((is_final_summary) || (elapsed_seconds.count() > m_min_write_interval))
+    if ((is_final_summary) || (elapsed_seconds.count() > m_options.min_write_interval))
     {
-        const auto tp = std::chrono::system_clock::now();
-        auto sec_since_epoch = std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+        if (m_options.chunked) {
+            // The most recent time step's RSTEP entry may still be reset by
+            // the next call, so hold it back unless this is the final step.
+            const auto numSteps = m_rstep.size() - m_nFlushed - (is_final_summary ? 0 : 1);
 
-        std::filesystem::path esmry_file(m_outputFileName);
-        std::filesystem::path rootName = esmry_file.parent_path() / esmry_file.stem();
+            if (numSteps > 0) {
+                this->write_chunk(numSteps);
+            }
 
-        std::string tmp_file_name = rootName.string() + "_TMP_" + std::to_string(sec_since_epoch) + ".ESMRY";
+            m_last_write = std::chrono::system_clock::now();
+        }
+        else {
+            this->write_complete_file();
+        }
+    }
 
-        {
-            Opm::EclIO::EclOutput outFile(tmp_file_name, m_fmt, std::ios::out);
+    m_nTimeSteps++;
+}
 
-            outFile.write<int>("START", m_start_date_vect);
+void ExtSmryOutput::write_header(EclOutput& outFile) const
+{
+    outFile.write<int>("START", m_start_date_vect);
 
-            if (m_restart_rootn.size() > 0) {
-                outFile.write<std::string>("RESTART", {m_restart_rootn});
-                outFile.write<int>("RSTNUM", {m_restart_step});
-            }
+    if (m_restart_rootn.size() > 0) {
+        outFile.write<std::string>("RESTART", {m_restart_rootn});
+        outFile.write<int>("RSTNUM", {m_restart_step});
+    }
 
-            outFile.write("KEYCHECK", m_smry_keys);
-            outFile.write("UNITS", m_smryUnits);
+    outFile.write("KEYCHECK", m_smry_keys);
+    outFile.write("UNITS", m_smryUnits);
+}
 
-            outFile.write<int>("RSTEP", m_rstep);
-            outFile.write<int>("TSTEP", m_tstep);
+void ExtSmryOutput::write_complete_file()
+{
+    const auto tp = std::chrono::system_clock::now();
+    auto sec_since_epoch = std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
 
-            for (std::size_t n = 0; n < static_cast<std::size_t>(m_nVect); n++ ) {
-                std::string vect_name="V" + std::to_string(n);
-                outFile.write<float>(vect_name, m_smrydata[n]);
-            }
+    std::filesystem::path esmry_file(m_outputFileName);
+    std::filesystem::path rootName = esmry_file.parent_path() / esmry_file.stem();
+
+    std::string tmp_file_name = rootName.string() + "_TMP_" + std::to_string(sec_since_epoch) + ".ESMRY";
+
+    {
+        Opm::EclIO::EclOutput outFile(tmp_file_name, m_fmt, std::ios::out);
+
+        this->write_header(outFile);
+
+        outFile.write<int>("RSTEP", m_rstep);
+        outFile.write<int>("TSTEP", m_tstep);
+
+        for (std::size_t n = 0; n < static_cast<std::size_t>(m_nVect); n++ ) {
+            std::string vect_name="V" + std::to_string(n);
+            outFile.write<float>(vect_name, m_smrydata[n]);
         }
+    }
 
-        if (rename_tmpfile(tmp_file_name)){
-            m_last_write = std::chrono::system_clock::now();
-        } else {
-            Opm::OpmLog::warning("Not able to rename temporary ESMRY file " + tmp_file_name);
-            std::filesystem::path tmp_file(tmp_file_name);
-            std::filesystem::remove(tmp_file);
+    if (rename_tmpfile(tmp_file_name)){
+        m_last_write = std::chrono::system_clock::now();
+    } else {
+        Opm::OpmLog::warning("Not able to rename temporary ESMRY file " + tmp_file_name);
+        std::filesystem::path tmp_file(tmp_file_name);
+        std::filesystem::remove(tmp_file);
+    }
+}
+
+void ExtSmryOutput::write_chunk(const std::size_t numSteps)
+{
+    // Chunked layout:
+    //
+    //   START, [RESTART, RSTNUM], KEYCHECK, UNITS
+    //   CHUNKED  = [ layout version, compression ]
+    //   repeated blocks of
+    //     BLKINDEX = [ #steps, compression, #elements in V/C array for each vector ]
+    //     RSTEP, TSTEP
+    //     V<n> (REAL, uncompressed) or C<n> (INTE, compressed) for each vector
+    //
+    // Blocks are only ever appended, so readers see a consistent prefix.
+
+    const int compression = m_options.compress ? 1 : 0;
+
+    if (m_nFlushed == 0) {
+        Opm::EclIO::EclOutput outFile(m_outputFileName, m_fmt, std::ios::out);
+
+        this->write_header(outFile);
+        outFile.write<int>("CHUNKED", {1, compression});
+    }
+
+    const auto nVect = static_cast<std::int64_t>(m_nVect);
+    std::vector<std::vector<int>> encoded(m_options.compress ? m_nVect : 0);
+
+    if (m_options.compress) {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (std::int64_t n = 0; n < nVect; ++n) {
+            const auto& values = m_smrydata[n];
+            encoded[n] = encodeDeltaShuffle({values.begin(), values.begin() + numSteps});
         }
     }
 
-    m_nTimeSteps++;
+    std::vector<int> index { static_cast<int>(numSteps), compression };
+    index.reserve(2 + m_nVect);
+    for (std::int64_t n = 0; n < nVect; ++n) {
+        index.push_back(m_options.compress
+                        ? static_cast<int>(encoded[n].size())
+                        : static_cast<int>(numSteps));
+    }
+
+    {
+        Opm::EclIO::EclOutput outFile(m_outputFileName, m_fmt, std::ios::app);
+
+        const auto first = m_rstep.begin() + m_nFlushed;
+        const auto firstT = m_tstep.begin() + m_nFlushed;
+
+        outFile.write<int>("BLKINDEX", index);
+        outFile.write<int>("RSTEP", {first, first + numSteps});
+        outFile.write<int>("TSTEP", {firstT, firstT + numSteps});
+
+        for (std::int64_t n = 0; n < nVect; ++n) {
+            if (m_options.compress) {
+                outFile.write<int>("C" + std::to_string(n), encoded[n]);
+            }
+            else {
+                outFile.write<float>("V" + std::to_string(n),
+                                     {m_smrydata[n].begin(), m_smrydata[n].begin() + numSteps});
+            }
+        }
+    }
+
+    // Keep only pending time steps in memory.
+    for (auto& vector : m_smrydata) {
+        const auto pending = std::min(vector.size(), numSteps);
+        vector.erase(vector.begin(), vector.begin() + pending);
+    }
+
+    m_nFlushed += numSteps;
 }
 
 bool ExtSmryOutput::rename_tmpfile(const std::string& tmp_fname)
@@ -21,6 +21,8 @@
 
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <ctime>
 #include <string>
 #include <vector>
 
@@ -31,20 +33,56 @@ class GridDims;
 
 namespace EclIO {
 
+class EclOutput;
+
 class ExtSmryOutput
 {
 public:
+    /// Output file layout options.
+    struct Options
+    {
+        /// Whether or not to use the chunked, append-only layout.  Each
+        /// write to disk appends a block of new time steps for all
+        /// vectors instead of rewriting the complete file.  Readers which
+        /// do not know the layout reject such files, so only enable it
+        /// when all consumers use a recent ExtESmry.  Selected in
+        /// simulation runs through the Summary constructor taking
+        /// Options.
+        bool chunked{false};
+
+        /// Whether or not to compress the vectors in each block (delta
+        /// plus byte-shuffle encoding).  Chunked layout only.
+        bool compress{false};
+
+        /// Minimum number of seconds between writes to disk.
+        int min_write_interval{15};
+    };
+
     ExtSmryOutput(const std::vector<std::string>& valueKeys,
                   const std::vector<std::string>& valueUnits,
                   const EclipseState& es,
                   const time_t start_time);
 
+    ExtSmryOutput(const std::vector<std::string>& valueKeys,
+                  const std::vector<std::string>& valueUnits,
+                  const EclipseState& es,
+                  const time_t start_time,
+                  const Options& options);
+
+    /// Constructor for output without a simulation model.  Summary keys
+    /// are written as-is.
+    ExtSmryOutput(const std::string& outputFileName,
+                  const std::vector<std::string>& smryKeys,
+                  const std::vector<std::string>& smryUnits,
+                  const time_t start_time,
+                  const Options& options);
+
     void write(const std::vector<float>& ts_data,
                int report_step,
                bool is_final_summary);
 
 private:
-    static constexpr int m_min_write_interval = 15;  // at least 15 seconds between each write
+    Options m_options;
     std::chrono::time_point<std::chrono::system_clock> m_last_write;
 
     std::string m_outputFileName;
@@ -61,6 +99,15 @@ private:
     std::vector<int> m_tstep;
     std::vector<std::vector<float>> m_smrydata;
 
+    // Chunked layout: number of time steps already on disk.  Only the
+    // pending time steps are kept in m_smrydata.
+    std::size_t m_nFlushed{0};
+
+    void set_start_date(const time_t start_time);
+    void write_header(EclOutput& outFile) const;
+    void write_complete_file();
+    void write_chunk(const std::size_t numSteps);
+
     std::array<int, 3> ijk_from_global_index(const GridDims& dims,
                                              int globInd) const;
     std::vector<std::string> make_modified_keys(const std::vector<std::string>& valueKeys,
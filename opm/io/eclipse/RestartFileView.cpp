@@ -78,7 +78,11 @@ public:
     explicit Implementation(std::shared_ptr<ERst> restart_file,
                             const int             report_step);
 
-    ~Implementation() = default;
+    Implementation(std::shared_ptr<ERst>           restart_file,
+                   const int                       report_step,
+                   const std::vector<std::string>& preload);
+
+    ~Implementation();
 
     Implementation(const Implementation& rhs) = delete;
     Implementation(Implementation&& rhs);
@@ -193,6 +197,9 @@ private:
     int         report_step_;
     std::size_t sim_step_;
     TypedColl   vectors_;
+    bool        release_on_drop_{false};
+
+    void releaseData();
 
     bool collectionContains(const VectorColl&  coll,
                             const std::string& vector) const
@@ -228,30 +235,66 @@ Implementation(std::shared_ptr<ERst> restart_file,
     }
 }
 
+Opm::EclIO::RestartFileView::Implementation::
+Implementation(std::shared_ptr<ERst>           restart_file,
+               const int                       report_step,
+               const std::vector<std::string>& preload)
+    : Implementation { std::move(restart_file), report_step }
+{
+    if (this->rst_file_ == nullptr) {
+        return;
+    }
+
+    this->release_on_drop_ = true;
+    this->rst_file_->loadReportStepNumber(this->report_step_, preload);
+}
+
+Opm::EclIO::RestartFileView::Implementation::~Implementation()
+{
+    this->releaseData();
+}
+
 Opm::EclIO::RestartFileView::Implementation::
 Implementation(Implementation&& rhs)
-    : rst_file_   (std::move(rhs.rst_file_))
-    , report_step_(rhs.report_step_)
-    , sim_step_   (rhs.sim_step_)            // Scalar (size_t)
-    , vectors_    (std::move(rhs.vectors_))
+    : rst_file_       (std::move(rhs.rst_file_))
+    , report_step_    (rhs.report_step_)
+    , sim_step_       (rhs.sim_step_)            // Scalar (size_t)
+    , vectors_        (std::move(rhs.vectors_))
+    , release_on_drop_(rhs.release_on_drop_)     // Scalar (bool)
 {}
 
 Opm::EclIO::RestartFileView::Implementation&
 Opm::EclIO::RestartFileView::Implementation::operator=(Implementation&& rhs)
 {
-    this->rst_file_    = std::move(rhs.rst_file_);
-    this->report_step_ = rhs.report_step_;         // Scalar (int)
-    this->sim_step_    = rhs.sim_step_;            // Scalar (size_t)
-    this->vectors_     = std::move(rhs.vectors_);
+    this->releaseData();
+
+    this->rst_file_        = std::move(rhs.rst_file_);
+    this->report_step_     = rhs.report_step_;         // Scalar (int)
+    this->sim_step_        = rhs.sim_step_;            // Scalar (size_t)
+    this->vectors_         = std::move(rhs.vectors_);
+    this->release_on_drop_ = rhs.release_on_drop_;     // Scalar (bool)
 
     return *this;
 }
 
+void Opm::EclIO::RestartFileView::Implementation::releaseData()
+{
+    if (this->release_on_drop_ && (this->rst_file_ != nullptr)) {
+        this->rst_file_->unloadReportStepNumber(this->report_step_);
+    }
+}
+
 Opm::EclIO::RestartFileView::RestartFileView(std::shared_ptr<ERst> restart_file,
                                              const int             report_step)
     : pImpl_{ new Implementation{ std::move(restart_file), report_step } }
 {}
 
+Opm::EclIO::RestartFileView::RestartFileView(std::shared_ptr<ERst>           restart_file,
+                                             const int                       report_step,
+                                             const std::vector<std::string>& preload)
+    : pImpl_{ new Implementation{ std::move(restart_file), report_step, preload } }
+{}
+
 Opm::EclIO::RestartFileView::~RestartFileView()
 {}
 
@@ -37,6 +37,15 @@ public:
     explicit RestartFileView(std::shared_ptr<ERst> restart_file,
                              const int             report_step);
 
+    // Selective view.  Loads the named arrays of 'report_step' up front,
+    // in a single batch, and releases all loaded arrays of that report
+    // step when the view is destroyed.  Other arrays are still loaded on
+    // demand.  References returned from getKeyword() and the header
+    // accessors are invalidated when the view is destroyed.
+    RestartFileView(std::shared_ptr<ERst>           restart_file,
+                    const int                       report_step,
+                    const std::vector<std::string>& preload);
+
     ~RestartFileView();
 
     RestartFileView(const RestartFileView& rhs) = delete;
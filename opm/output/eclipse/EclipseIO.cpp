@@ -948,7 +948,11 @@ void Opm::EclipseIO::Impl::writeRunSummary() const
 
     const auto smspec = EclIO::OutputStream::outputFileName(rset, ext);
 
-    EclIO::ESmry { smspec }.write_rsm_file();
+    // Format the report a few RSM blocks at a time to bound the memory
+    // needed for runs with many summary vectors.
+    const auto chunk_size = std::size_t{90};
+
+    EclIO::ESmry { smspec }.write_rsm_file(std::nullopt, chunk_size);
 }
 
 void Opm::EclipseIO::Impl::writeRftFile(const double       secs_elapsed,
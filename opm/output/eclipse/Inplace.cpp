@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -34,25 +35,9 @@ namespace {
 static const std::string FIELD_NAME = std::string{"FIELD"};
 static const std::size_t FIELD_ID   = 0;
 
-std::size_t region_max(const std::unordered_map<std::size_t, double>& region_map)
+std::size_t phase_index(const Opm::Inplace::Phase phase)
 {
-    return std::accumulate(region_map.begin(), region_map.end(), std::size_t{0},
-                           [](const std::size_t max, const auto& elm)
-                           {
-                               return std::max(max, elm.first);
-                           });
-}
-
-std::size_t
-phase_region_max(const std::unordered_map<Opm::Inplace::Phase, std::unordered_map<std::size_t, double>>& phase_map)
-{
-    return std::accumulate(phase_map.begin(),
-                           phase_map.end(),
-                           std::size_t{0},
-        [](const std::size_t max, const auto& region_map)
-    {
-        return std::max(max, region_max(region_map.second));
-    });
+    return static_cast<std::size_t>(phase);
 }
 
 template <typename Vector>
@@ -135,7 +120,11 @@ void Inplace::add(const std::string&   region,
                   const std::size_t    region_id,
                   const double         value)
 {
-    this->phase_values[region][phase][region_id] = value;
+    auto& values = this->values(region, phase);
+
+    values.reserve(region_id);
+    values.value[region_id] = value;
+    values.assigned[region_id] = true;
 }
 
 void Inplace::add(Inplace::Phase phase, double value)
@@ -143,34 +132,76 @@ void Inplace::add(Inplace::Phase phase, double value)
     this->add(FIELD_NAME, phase, FIELD_ID, value);
 }
 
+void Inplace::add(const std::string&         region,
+                  const Inplace::Phase       phase,
+                  const std::vector<double>& values)
+{
+    this->assign(region, phase, values);
+}
+
+void Inplace::add(const out::RegionReduction::Result& result,
+                  const std::vector<Phase>&           phases)
+{
+    if (phases.size() != result.numQuantities()) {
+        throw std::invalid_argument {
+            fmt::format("Region reduction has {} quantities, "
+                        "but {} in-place phases were given",
+                        result.numQuantities(), phases.size())
+        };
+    }
+
+    for (auto q = 0*phases.size(); q < phases.size(); ++q) {
+        for (auto regSet = 0*result.numRegionSets(); regSet < result.numRegionSets(); ++regSet) {
+            this->assign(result.regionSetName(regSet), phases[q], result.sum(regSet, q));
+        }
+
+        this->add(phases[q], result.total(q));
+    }
+}
+
+void Inplace::assign(const std::string&            region,
+                     const Inplace::Phase          phase,
+                     const std::span<const double> values)
+{
+    if (values.empty()) {
+        return;
+    }
+
+    auto& regValues = this->values(region, phase);
+
+    regValues.reserve(values.size());
+    std::ranges::copy(values, regValues.value.begin() + 1);
+    std::fill(regValues.assigned.begin() + 1,
+              regValues.assigned.begin() + 1 + values.size(), true);
+}
+
 double Inplace::get(const std::string&   region,
                     const Inplace::Phase phase,
                     const std::size_t    region_id) const
 {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
+    auto region_iter = this->region_values.find(region);
+    if (region_iter == this->region_values.end()) {
         throw std::logic_error {
             fmt::format("No such region: {}", region)
         };
     }
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
+    const auto* values = this->find(region, phase);
+    if (values == nullptr) {
         throw std::logic_error {
             fmt::format("No such phase: {}:{}",
                         region, static_cast<int>(phase))
         };
     }
 
-    auto value_iter = phase_iter->second.find(region_id);
-    if (value_iter == phase_iter->second.end()) {
+    if ((region_id >= values->assigned.size()) || !values->assigned[region_id]) {
         throw std::logic_error {
             fmt::format("No such region id: {}:{}:{}",
                         region, static_cast<int>(phase), region_id)
         };
     }
 
-    return value_iter->second;
+    return values->value[region_id];
 }
 
 double Inplace::get(Inplace::Phase phase) const
@@ -182,18 +213,11 @@ bool Inplace::has(const std::string& region,
                   const Phase        phase,
                   const std::size_t  region_id) const
 {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
-        return false;
-    }
-
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
-        return false;
-    }
+    const auto* values = this->find(region, phase);
 
-    return phase_iter->second.find(region_id)
-        != phase_iter->second.end();
+    return (values != nullptr)
+        && (region_id < values->assigned.size())
+        && values->assigned[region_id];
 }
 
 bool Inplace::has(Phase phase) const
@@ -203,25 +227,25 @@ bool Inplace::has(Phase phase) const
 
 std::size_t Inplace::max_region() const
 {
-    return std::accumulate(this->phase_values.begin(),
-                           this->phase_values.end(),
+    return std::accumulate(this->region_values.begin(),
+                           this->region_values.end(),
                            std::size_t{0},
-        [](const std::size_t max, const auto& phase_map)
+        [](const std::size_t max, const auto& phase_values)
     {
-        return std::max(max, phase_region_max(phase_map.second));
+        return std::max(max, max_region(phase_values.second));
     });
 }
 
 std::size_t Inplace::max_region(const std::string& region_name) const
 {
-    auto region_iter = this->phase_values.find(region_name);
-    if (region_iter == this->phase_values.end()) {
+    auto region_iter = this->region_values.find(region_name);
+    if (region_iter == this->region_values.end()) {
         throw std::logic_error {
             fmt::format("No such region: {}", region_name)
         };
     }
 
-    return phase_region_max(region_iter->second);
+    return max_region(region_iter->second);
 }
 
 std::vector<double>
@@ -230,24 +254,17 @@ Inplace::get_vector(const std::string& region,
 {
     std::vector<double> v(this->max_region(region), 0.0);
 
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
-        throw std::logic_error {
-            fmt::format("No such region: {}", region)
-        };
-    }
-
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
+    const auto* values = this->find(region, phase);
+    if (values == nullptr) {
         throw std::logic_error {
             fmt::format("Phase {} does not exist in region {}",
                         static_cast<int>(phase), region)
         };
     }
 
-    for (const auto& [region_id, value] : phase_iter->second) {
-        v[region_id - 1] = value;
-    }
+    // Unassigned regions hold zero in the dense storage.  Region ID zero is
+    // reserved for field-level values and not part of the per-region view.
+    std::copy(values->value.begin() + 1, values->value.end(), v.begin());
 
     return v;
 }
@@ -307,7 +324,48 @@ const std::vector<Inplace::Phase>& Inplace::mixingPhases()
 
 bool Inplace::operator==(const Inplace& rhs) const
 {
-    return this->phase_values == rhs.phase_values;
+    return this->region_values == rhs.region_values;
+}
+
+Inplace::RegionValues&
+Inplace::values(const std::string& region, const Phase phase)
+{
+    auto& phase_values = this->region_values[region];
+
+    const auto ix = phase_index(phase);
+    if (ix >= phase_values.size()) {
+        phase_values.resize(ix + 1);
+    }
+
+    return phase_values[ix];
+}
+
+const Inplace::RegionValues*
+Inplace::find(const std::string& region, const Phase phase) const
+{
+    auto region_iter = this->region_values.find(region);
+    if (region_iter == this->region_values.end()) {
+        return nullptr;
+    }
+
+    const auto ix = phase_index(phase);
+    if ((ix >= region_iter->second.size()) ||
+        region_iter->second[ix].empty())
+    {
+        return nullptr;
+    }
+
+    return &region_iter->second[ix];
+}
+
+std::size_t Inplace::max_region(const PhaseValues& phase_values)
+{
+    return std::accumulate(phase_values.begin(), phase_values.end(),
+                           std::size_t{0},
+        [](const std::size_t max, const RegionValues& values)
+    {
+        return values.empty() ? max : std::max(max, values.max_region());
+    });
 }
 
 } // namespace Opm
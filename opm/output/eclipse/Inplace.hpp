@@ -20,7 +20,10 @@
 #ifndef ORIGINAL_OIP
 #define ORIGINAL_OIP
 
+#include <opm/output/eclipse/RegionReduction.hpp>
+
 #include <cstddef>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -114,6 +117,36 @@ public:
     /// \param[in] value Numerical value of field-level \p phase quantity.
     void add(Phase phase, double value);
 
+    /// Assign values of particular quantity in all regions of named
+    /// region set.
+    ///
+    /// Bulk version of add() for a single region set and quantity.
+    ///
+    /// \param[in] region Region set name such as FIPNUM or FIPABC.
+    ///
+    /// \param[in] phase In-place quantity.
+    ///
+    /// \param[in] values Numerical values of \p phase quantity in all
+    ///   regions of \p region region set.  Element \c i is the value in
+    ///   region ID \code i + 1 \endcode, i.e., the same layout as the
+    ///   return value from get_vector().
+    void add(const std::string&         region,
+             Phase                      phase,
+             const std::vector<double>& values);
+
+    /// Assign region and field level values of several quantities in all
+    /// region sets of a region reduction.
+    ///
+    /// Assigns the regional sums of each reduced quantity in each region
+    /// set, and the field level totals.
+    ///
+    /// \param[in] result Region reduction result.
+    ///
+    /// \param[in] phases In-place quantity of each reduced cell array, in
+    ///   the order of the cell arrays passed to RegionReduction::reduce().
+    void add(const out::RegionReduction::Result& result,
+             const std::vector<Phase>&           phases);
+
     /// Retrieve numerical value of particular quantity in specific region
     /// of named region set.
     ///
@@ -211,7 +244,7 @@ public:
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
-        serializer(phase_values);
+        serializer(region_values);
     }
 
     /// Equality predicate.
@@ -223,13 +256,73 @@ public:
     bool operator==(const Inplace& rhs) const;
 
 private:
-    using ValueMap = std::unordered_map<std::size_t, double>;
-    using PhaseMap = std::unordered_map<Phase, ValueMap>;
-    using RegionMap = std::unordered_map<std::string, PhaseMap>;
+    /// Numerical values of a single quantity in all regions of a single
+    /// region set.
+    ///
+    /// Dense storage indexed directly by region ID.  Region ID zero is
+    /// used for field-level values.
+    struct RegionValues
+    {
+        /// Quantity value in each region.  Zero in unassigned regions.
+        std::vector<double> value{};
+
+        /// Whether or not the value of a region has been assigned.
+        std::vector<bool> assigned{};
+
+        /// Whether or not any value of this quantity has been assigned.
+        bool empty() const { return this->assigned.empty(); }
+
+        /// Maximum assigned region ID.  Only meaningful if non-empty.
+        std::size_t max_region() const { return this->assigned.size() - 1; }
+
+        /// Grow storage to accommodate region IDs up to and including
+        /// \p region_id.
+        void reserve(const std::size_t region_id)
+        {
+            if (region_id >= this->assigned.size()) {
+                this->value.resize(region_id + 1, 0.0);
+                this->assigned.resize(region_id + 1, false);
+            }
+        }
+
+        /// Equality predicate.
+        bool operator==(const RegionValues& rhs) const = default;
+
+        /// Serialisation interface.
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(value);
+            serializer(assigned);
+        }
+    };
+
+    /// Values of all quantities in a single region set.  Indexed by the
+    /// numerical value of the Phase enumerator.
+    using PhaseValues = std::vector<RegionValues>;
 
     /// Numerical values of all registered quantities in all registered
     /// region sets.
-    RegionMap phase_values{};
+    std::unordered_map<std::string, PhaseValues> region_values{};
+
+    /// Assign values of single quantity in all regions of single region
+    /// set.  Element \c i of \p values is the value of region ID \code i +
+    /// 1 \endcode.
+    void assign(const std::string& region, Phase phase, std::span<const double> values);
+
+    /// Get read/write access to values of single quantity in single region
+    /// set.  Creates storage if needed.
+    RegionValues& values(const std::string& region, Phase phase);
+
+    /// Get read-only access to values of single quantity in single region
+    /// set.
+    ///
+    /// \return Nullptr if no value of \p phase has been assigned in \p
+    ///   region.
+    const RegionValues* find(const std::string& region, Phase phase) const;
+
+    /// Maximum region ID across all quantities of single region set.
+    static std::size_t max_region(const PhaseValues& phase_values);
 };
 
 } // namespace Opm
@@ -1616,6 +1616,29 @@ namespace {
             }
         }
     }
+
+    // Names of restart arrays to load in a single batch when creating the
+    // restart file view.  Arrays not in this list are still loaded on
+    // demand.
+    std::vector<std::string>
+    preloadArrays(const std::vector<Opm::RestartKey>& solution_keys,
+                  const std::vector<Opm::RestartKey>& extra_keys,
+                  std::initializer_list<const char*>  dynamic_arrays)
+    {
+        auto arrays = std::vector<std::string> {
+            "INTEHEAD", "LOGIHEAD", "DOUBHEAD",
+        };
+
+        arrays.insert(arrays.end(), dynamic_arrays.begin(), dynamic_arrays.end());
+
+        for (const auto* keys : { &solution_keys, &extra_keys }) {
+            std::ranges::transform(*keys, std::back_inserter(arrays),
+                                   [](const Opm::RestartKey& rst_key)
+                                   { return rst_key.key; });
+        }
+
+        return arrays;
+    }
 } // Anonymous namespace
 
 namespace Opm::RestartIO  {
@@ -1632,7 +1655,11 @@ namespace Opm::RestartIO  {
          const std::vector<RestartKey>& extra_keys)
     {
         auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
-            (std::make_shared<Opm::EclIO::ERst>(filename), report_step);
+            (std::make_shared<Opm::EclIO::ERst>(filename), report_step,
+             preloadArrays(solution_keys, extra_keys, {
+                 "IWEL", "XWEL", "ICON", "XCON", "IGRP", "XGRP",
+                 "ISEG", "RSEG", "IAAQ", "SAAQ", "XAAQ", "IAQN", "RAQN",
+             }));
 
         // Check for missing headers first
         if (!rst_view->hasHeaderArrays()) {
@@ -1686,7 +1713,8 @@ namespace Opm::RestartIO  {
                        const EclipseGrid&             grid)
     {
         auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
-            (std::make_shared<Opm::EclIO::ERst>(filename), report_step);
+            (std::make_shared<Opm::EclIO::ERst>(filename), report_step,
+             preloadArrays(solution_keys, {}, {}));
 
         if (!rst_view->valid()) {
             return {};
@@ -30,12 +30,25 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <functional>
-#include <map>
+#include <numeric>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
+namespace {
+
+    /// Convert per-region counts into CSR start pointers in place.
+    ///
+    /// On input, element 'r + 1' holds the number of entries in region 'r'.
+    /// On output, element 'r' is the start of region 'r'.
+    void countsToStart(std::vector<std::size_t>& start)
+    {
+        std::partial_sum(start.begin(), start.end(), start.begin());
+    }
+
+} // Anonymous namespace
+
 Opm::out::RegionCache::RegionCache(const std::set<std::string>& fip_regions,
                                    const FieldPropsManager&     fp,
                                    const EclipseGrid&           grid,
@@ -53,63 +66,120 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
         return;
     }
 
-    auto regions = std::vector<std::reference_wrapper<const std::vector<int>>>{};
-    std::ranges::transform(fip_regions, std::back_inserter(regions),
-                           [&fp](const auto& fipReg)
-                           { return std::cref(fp.get_int(fipReg)); });
+    // Active cell index of each active connection, in well order then
+    // connection order.  Shared by all region sets.
+    auto connWell = std::vector<std::size_t>{};
+    auto connCell = std::vector<std::size_t>{};
+    auto connActive = std::vector<std::size_t>{};
+
+    const auto& wellNames = schedule.back().well_order();
+    for (auto wellIx = 0*wellNames.size(); wellIx < wellNames.size(); ++wellIx) {
+        for (const auto& conn : schedule.back().wells(wellNames[wellIx]).getConnections()) {
+            if (! grid.cellActive(conn.global_index())) {
+                continue;
+            }
+
+            connWell.push_back(wellIx);
+            connCell.push_back(conn.global_index());
+            connActive.push_back(grid.activeIndex(conn.global_index()));
+        }
+    }
+
+    for (const auto& fipReg : fip_regions) {
+        const auto& regID = fp.get_int(fipReg);
+
+        auto& rset = this->region_sets[fipReg];
+        rset = RegionSet{};
+
+        auto connRegion = std::vector<int>(connActive.size());
+        std::ranges::transform(connActive, connRegion.begin(),
+                               [&regID](const std::size_t activeIx)
+                               { return regID[activeIx]; });
 
-    for (const auto& wname : schedule.back().well_order()) {
-        const auto& conns = schedule.back().wells(wname).getConnections();
-        if (conns.empty()) { continue; }
+        const auto maxReg = connRegion.empty()
+            ? 0 : std::max(0, *std::ranges::max_element(connRegion));
+
+        auto connCount = std::vector<std::size_t>(maxReg + 1, 0);
+        rset.wellStart.assign(maxReg + 2, 0);
+
+        // Count entries per region.  A well is registered in the region
+        // of its first active connection.
+        auto isFirstConn = std::vector<bool>(connRegion.size(), false);
+        for (auto i = 0*connRegion.size(); i < connRegion.size(); ++i) {
+            if (connRegion[i] < 0) {
+                continue;
+            }
 
-        auto regID = regions.begin();
-        for (const auto& fipReg : fip_regions) {
-            auto first = true;
+            ++connCount[connRegion[i]];
 
-            for (const auto& conn : conns) {
-                if (! grid.cellActive(conn.global_index())) {
-                    continue;
-                }
+            isFirstConn[i] = (i == 0) || (connWell[i] != connWell[i - 1]);
+            if (isFirstConn[i]) {
+                ++rset.wellStart[connRegion[i] + 1];
+            }
+        }
 
-                const auto region = regID->get()[grid.activeIndex(conn.global_index())];
-                const auto reg_pair = std::make_pair(fipReg, region);
+        countsToStart(rset.wellStart);
 
-                this->connection_map[reg_pair]
-                    .emplace_back(wname, conn.global_index());
+        // Stable placement into region buckets.
+        rset.conns.resize(connCount.size());
+        for (auto r = 0*connCount.size(); r < connCount.size(); ++r) {
+            rset.conns[r].reserve(connCount[r]);
+        }
 
-                if (first) {
-                    this->well_map[reg_pair].push_back(wname);
+        rset.wells.resize(rset.wellStart.back());
 
-                    first = false;
-                }
+        auto wellPos = rset.wellStart;
+        for (auto i = 0*connRegion.size(); i < connRegion.size(); ++i) {
+            if (connRegion[i] < 0) {
+                continue;
             }
 
-            ++regID;
+            const auto& wname = wellNames[connWell[i]];
+
+            rset.conns[connRegion[i]].emplace_back(wname, connCell[i]);
+
+            if (isFirstConn[i]) {
+                rset.wells[wellPos[connRegion[i]]++] = wname;
+            }
         }
     }
 }
 
-
 const std::vector<std::pair<std::string, std::size_t>>&
 Opm::out::RegionCache::connections(const std::string& region_name,
                                    const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->connection_map.find(key);
+    const auto* rset = this->findRegionSet(region_name, region_id);
+    if (rset == nullptr) {
+        return this->connections_empty;
+    }
 
-    return (iter == this->connection_map.end())
-        ? this->connections_empty
-        : iter->second;
+    return rset->conns[region_id];
 }
 
 std::vector<std::string>
 Opm::out::RegionCache::wells(const std::string& region_name,
                              const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->well_map.find(key);
+    const auto* rset = this->findRegionSet(region_name, region_id);
+    if (rset == nullptr) {
+        return {};
+    }
+
+    return { rset->wells.begin() + rset->wellStart[region_id],
+             rset->wells.begin() + rset->wellStart[region_id + 1] };
+}
+
+const Opm::out::RegionCache::RegionSet*
+Opm::out::RegionCache::findRegionSet(const std::string& region_name,
+                                     const int          region_id) const
+{
+    auto rsetPos = this->region_sets.find(region_name);
+    if ((rsetPos == this->region_sets.end()) || (region_id < 0) ||
+        (static_cast<std::size_t>(region_id) >= rsetPos->second.conns.size()))
+    {
+        return nullptr;
+    }
 
-    return (iter == this->well_map.end())
-        ? std::vector<std::string> {}
-        : iter->second;
+    return &rsetPos->second;
 }
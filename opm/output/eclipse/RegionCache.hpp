@@ -21,9 +21,10 @@
 #define OPM_REGION_CACHE_HPP
 
 #include <cstddef>
-#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -53,12 +54,30 @@ namespace Opm { namespace out {
         std::vector<std::string> wells(const std::string& region_name, int region_id) const;
 
     private:
-        using RegID = std::pair<std::string, int>;            // { Region set, region ID }
         using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
 
+        // Connections and wells of all regions in a single region set,
+        // indexed directly by region ID.  The connections of region 'r'
+        // are conns[r].  The wells use compressed sparse row layout, i.e.,
+        // the wells of region 'r' are
+        //
+        //   wells[wellStart[r] .. wellStart[r + 1])
+        //
+        // Within a region, entries are in well order, then connection
+        // order.
+        struct RegionSet
+        {
+            std::vector<std::vector<WellConn>> conns{};
+
+            std::vector<std::size_t> wellStart{};
+            std::vector<std::string> wells{};
+        };
+
         std::vector<WellConn> connections_empty{};
-        std::map<RegID, std::vector<WellConn>> connection_map{};
-        std::map<RegID, std::vector<std::string>> well_map{};
+        std::unordered_map<std::string, RegionSet> region_sets{};
+
+        const RegionSet* findRegionSet(const std::string& region_name,
+                                       int                region_id) const;
     };
 }} // namespace Opm::out
 
@@ -0,0 +1,356 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/eclipse/RegionReduction.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+    /// Number of cells in a single block of the reduction sweep.
+    constexpr auto blockSize = std::int64_t{4096};
+
+    /// Minimum number of cells for which to run the sweep in parallel.
+    constexpr auto parallelThreshold = std::size_t{100000};
+
+    int maxThreads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    int threadID()
+    {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+
+    /// Partial results of all regions, accumulated by a single thread.
+    ///
+    /// Region major layout.  Each region holds its pore volume, its cell
+    /// count, and then the sum, pore volume weighted sum, minimum and
+    /// maximum of each quantity.
+    class Accumulator
+    {
+    public:
+        explicit Accumulator(const std::size_t numRegions,
+                             const std::size_t numQuantities)
+            : stride_ { 2 + 4*numQuantities }
+            , numQuantities_ { numQuantities }
+            , values_(numRegions * stride_, 0.0)
+        {
+            for (auto region = 0*numRegions; region < numRegions; ++region) {
+                auto* acc = this->region(region);
+                for (auto q = 0*numQuantities; q < numQuantities; ++q) {
+                    acc[2 + 4*q + 2] = std::numeric_limits<double>::max();
+                    acc[2 + 4*q + 3] = std::numeric_limits<double>::lowest();
+                }
+            }
+        }
+
+        double* region(const std::size_t region)
+        {
+            return this->values_.data() + region*this->stride_;
+        }
+
+        const double* region(const std::size_t region) const
+        {
+            return this->values_.data() + region*this->stride_;
+        }
+
+        void addCell(double*                                     acc,
+                     const std::size_t                           cell,
+                     const double                                pv,
+                     const std::vector<std::span<const double>>& quantities)
+        {
+            acc[0] += pv;
+            acc[1] += 1.0;
+
+            for (auto q = 0*this->numQuantities_; q < this->numQuantities_; ++q) {
+                const auto x = quantities[q][cell];
+                auto* stat = acc + 2 + 4*q;
+
+                stat[0] += x;
+                stat[1] += pv * x;
+                stat[2] = std::min(stat[2], x);
+                stat[3] = std::max(stat[3], x);
+            }
+        }
+
+        void combine(const Accumulator& other)
+        {
+            const auto numRegions = this->values_.size() / this->stride_;
+
+            for (auto region = 0*numRegions; region < numRegions; ++region) {
+                auto* acc = this->region(region);
+                const auto* src = other.region(region);
+
+                acc[0] += src[0];
+                acc[1] += src[1];
+
+                for (auto q = 0*this->numQuantities_; q < this->numQuantities_; ++q) {
+                    auto* stat = acc + 2 + 4*q;
+                    const auto* srcStat = src + 2 + 4*q;
+
+                    stat[0] += srcStat[0];
+                    stat[1] += srcStat[1];
+                    stat[2] = std::min(stat[2], srcStat[2]);
+                    stat[3] = std::max(stat[3], srcStat[3]);
+                }
+            }
+        }
+
+    private:
+        std::size_t stride_{};
+        std::size_t numQuantities_{};
+        std::vector<double> values_{};
+    };
+
+    void checkSize(const std::size_t actual,
+                   const std::size_t expected,
+                   const std::string& what)
+    {
+        if (actual != expected) {
+            throw std::invalid_argument {
+                fmt::format("{} has {} elements, but region reduction "
+                            "is defined for {} cells", what, actual, expected)
+            };
+        }
+    }
+
+} // Anonymous namespace
+
+// ---------------------------------------------------------------------------
+
+std::span<const double>
+Opm::out::RegionReduction::Result::sum(const std::size_t regSet,
+                                       const std::size_t q) const
+{
+    return this->regionValues(this->sum_, regSet, q);
+}
+
+std::span<const double>
+Opm::out::RegionReduction::Result::min(const std::size_t regSet,
+                                       const std::size_t q) const
+{
+    return this->regionValues(this->min_, regSet, q);
+}
+
+std::span<const double>
+Opm::out::RegionReduction::Result::max(const std::size_t regSet,
+                                       const std::size_t q) const
+{
+    return this->regionValues(this->max_, regSet, q);
+}
+
+std::span<const double>
+Opm::out::RegionReduction::Result::average(const std::size_t regSet,
+                                           const std::size_t q) const
+{
+    return this->regionValues(this->average_, regSet, q);
+}
+
+std::span<const double>
+Opm::out::RegionReduction::Result::poreVolume(const std::size_t regSet) const
+{
+    return this->regionValues(this->poreVolume_, regSet, 0);
+}
+
+std::span<const std::size_t>
+Opm::out::RegionReduction::Result::numCells(const std::size_t regSet) const
+{
+    return { this->numCells_.data() + this->start_[regSet],
+             this->start_[regSet + 1] - this->start_[regSet] };
+}
+
+std::span<const double>
+Opm::out::RegionReduction::Result::regionValues(const std::vector<double>& values,
+                                                const std::size_t          regSet,
+                                                const std::size_t          q) const
+{
+    return { values.data() + q*this->start_.back() + this->start_[regSet],
+             this->start_[regSet + 1] - this->start_[regSet] };
+}
+
+// ---------------------------------------------------------------------------
+
+Opm::out::RegionReduction::RegionReduction(const std::size_t numCells)
+    : numCells_ { numCells }
+{}
+
+std::size_t
+Opm::out::RegionReduction::addRegionSet(const std::string& name,
+                                        std::vector<int>   regionID)
+{
+    if (this->regionSetIndex(name).has_value()) {
+        throw std::invalid_argument {
+            fmt::format("Region set {} is already registered", name)
+        };
+    }
+
+    checkSize(regionID.size(), this->numCells_, fmt::format("Region set {}", name));
+
+    const auto maxID = regionID.empty()
+        ? 0 : std::max(0, *std::ranges::max_element(regionID));
+
+    this->name_.push_back(name);
+    this->regionID_.push_back(std::move(regionID));
+    this->maxID_.push_back(maxID);
+
+    return this->name_.size() - 1;
+}
+
+std::optional<std::size_t>
+Opm::out::RegionReduction::regionSetIndex(const std::string& name) const
+{
+    const auto pos = std::ranges::find(this->name_, name);
+    if (pos == this->name_.end()) {
+        return {};
+    }
+
+    return std::distance(this->name_.begin(), pos);
+}
+
+Opm::out::RegionReduction::Result
+Opm::out::RegionReduction::reduce(const std::vector<std::span<const double>>& quantities,
+                                  std::span<const double>                     poreVolume) const
+{
+    for (auto q = 0*quantities.size(); q < quantities.size(); ++q) {
+        checkSize(quantities[q].size(), this->numCells_, fmt::format("Quantity {}", q));
+    }
+
+    if (! poreVolume.empty()) {
+        checkSize(poreVolume.size(), this->numCells_, "Pore volume");
+    }
+
+    const auto numQuantities = quantities.size();
+
+    auto result = Result{};
+    result.numQuantities_ = numQuantities;
+    result.name_ = this->name_;
+
+    // Linearised regions of all region sets, followed by a single
+    // region holding all cells for the field totals.
+    result.start_.assign(1, 0);
+    for (const auto& maxID : this->maxID_) {
+        result.start_.push_back(result.start_.back() + maxID);
+    }
+
+    const auto numRegions = result.start_.back();
+    const auto fieldRegion = numRegions;
+
+    auto partial = std::vector<Accumulator>(maxThreads(),
+                                            Accumulator { numRegions + 1, numQuantities });
+
+    const auto numCells = this->numCells_;
+    const auto numBlocks = static_cast<std::int64_t>((numCells + blockSize - 1) / blockSize);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (numCells > parallelThreshold)
+#endif
+    for (std::int64_t block = 0; block < numBlocks; ++block) {
+        auto& acc = partial[threadID()];
+
+        const auto begin = static_cast<std::size_t>(block * blockSize);
+        const auto end = std::min(begin + blockSize, numCells);
+
+        for (auto cell = begin; cell < end; ++cell) {
+            const auto pv = poreVolume.empty() ? 1.0 : poreVolume[cell];
+            acc.addCell(acc.region(fieldRegion), cell, pv, quantities);
+        }
+
+        for (auto regSet = 0*this->regionID_.size(); regSet < this->regionID_.size(); ++regSet) {
+            const auto& regionID = this->regionID_[regSet];
+            const auto start = result.start_[regSet];
+
+            for (auto cell = begin; cell < end; ++cell) {
+                if (regionID[cell] <= 0) {
+                    continue;
+                }
+
+                const auto pv = poreVolume.empty() ? 1.0 : poreVolume[cell];
+                acc.addCell(acc.region(start + regionID[cell] - 1), cell, pv, quantities);
+            }
+        }
+    }
+
+    for (auto thread = 1 + 0*partial.size(); thread < partial.size(); ++thread) {
+        partial.front().combine(partial[thread]);
+    }
+
+    const auto& acc = partial.front();
+
+    result.sum_.assign(numQuantities * numRegions, 0.0);
+    result.min_.assign(numQuantities * numRegions, 0.0);
+    result.max_.assign(numQuantities * numRegions, 0.0);
+    result.average_.assign(numQuantities * numRegions, 0.0);
+    result.poreVolume_.assign(numRegions, 0.0);
+    result.numCells_.assign(numRegions, 0);
+    result.total_.assign(numQuantities, 0.0);
+
+    for (auto region = 0*numRegions; region < numRegions; ++region) {
+        const auto* src = acc.region(region);
+
+        result.poreVolume_[region] = src[0];
+        result.numCells_[region] = static_cast<std::size_t>(src[1]);
+
+        if (result.numCells_[region] == 0) {
+            continue;
+        }
+
+        for (auto q = 0*numQuantities; q < numQuantities; ++q) {
+            const auto* stat = src + 2 + 4*q;
+            const auto ix = q*numRegions + region;
+
+            result.sum_[ix] = stat[0];
+            result.min_[ix] = stat[2];
+            result.max_[ix] = stat[3];
+            result.average_[ix] = (src[0] != 0.0)
+                ? stat[1] / src[0]
+                : stat[0] / src[1];
+        }
+    }
+
+    for (auto q = 0*numQuantities; q < numQuantities; ++q) {
+        result.total_[q] = acc.region(fieldRegion)[2 + 4*q];
+    }
+
+    return result;
+}
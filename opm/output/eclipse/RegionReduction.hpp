@@ -0,0 +1,209 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_REGION_REDUCTION_HPP
+#define OPM_REGION_REDUCTION_HPP
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace out {
+
+/// Region level reductions of cell level quantities.
+///
+/// Computes the sum, minimum, maximum and pore volume weighted average of
+/// any number of cell level quantities in every region of any number of
+/// region sets, e.g., FIPNUM and user defined FIP* region sets, in a
+/// single sweep over the cells.  Cells are visited in blocks so that a
+/// block's region IDs and quantity values stay in cache while all region
+/// sets are processed.  Blocks are distributed across threads, each of
+/// which accumulates into its own partial results.  The partial results
+/// are combined in thread order, so the results do not depend on thread
+/// scheduling.
+class RegionReduction
+{
+public:
+    /// Results of a single reduction.
+    ///
+    /// Per-region values are linearised with element \c i holding the
+    /// value of region ID \code i + 1 \endcode, i.e., the same layout as
+    /// Inplace::get_vector().  Regions without any cells have zero sum,
+    /// minimum, maximum and average.
+    class Result
+    {
+    public:
+        /// Number of reduced quantities.
+        std::size_t numQuantities() const { return this->numQuantities_; }
+
+        /// Number of region sets.
+        std::size_t numRegionSets() const { return this->name_.size(); }
+
+        /// Name of particular region set.
+        const std::string& regionSetName(const std::size_t regSet) const
+        {
+            return this->name_[regSet];
+        }
+
+        /// Sum of quantity in all regions of region set.
+        ///
+        /// \param[in] regSet Region set index.
+        ///
+        /// \param[in] q Quantity index.
+        std::span<const double> sum(std::size_t regSet, std::size_t q) const;
+
+        /// Minimum cell value of quantity in all regions of region set.
+        ///
+        /// \param[in] regSet Region set index.
+        ///
+        /// \param[in] q Quantity index.
+        std::span<const double> min(std::size_t regSet, std::size_t q) const;
+
+        /// Maximum cell value of quantity in all regions of region set.
+        ///
+        /// \param[in] regSet Region set index.
+        ///
+        /// \param[in] q Quantity index.
+        std::span<const double> max(std::size_t regSet, std::size_t q) const;
+
+        /// Pore volume weighted average of quantity in all regions of
+        /// region set.  Arithmetic average if no pore volumes were
+        /// provided to the reduction, or if all pore volumes of a region
+        /// are zero.
+        ///
+        /// \param[in] regSet Region set index.
+        ///
+        /// \param[in] q Quantity index.
+        std::span<const double> average(std::size_t regSet, std::size_t q) const;
+
+        /// Total pore volume in all regions of region set.  Number of cells
+        /// if no pore volumes were provided to the reduction.
+        ///
+        /// \param[in] regSet Region set index.
+        std::span<const double> poreVolume(std::size_t regSet) const;
+
+        /// Number of cells in all regions of region set.
+        ///
+        /// \param[in] regSet Region set index.
+        std::span<const std::size_t> numCells(std::size_t regSet) const;
+
+        /// Sum of quantity across all cells, including cells which are
+        /// not part of any region.
+        ///
+        /// \param[in] q Quantity index.
+        double total(const std::size_t q) const { return this->total_[q]; }
+
+    private:
+        friend class RegionReduction;
+
+        /// Number of reduced quantities.
+        std::size_t numQuantities_{};
+
+        /// Region set names.
+        std::vector<std::string> name_{};
+
+        /// Start of each region set in the linearised region values.
+        std::vector<std::size_t> start_{};
+
+        /// Per-region sums.  Quantity major.
+        std::vector<double> sum_{};
+
+        /// Per-region minima.  Quantity major.
+        std::vector<double> min_{};
+
+        /// Per-region maxima.  Quantity major.
+        std::vector<double> max_{};
+
+        /// Per-region averages.  Quantity major.
+        std::vector<double> average_{};
+
+        /// Per-region pore volumes.
+        std::vector<double> poreVolume_{};
+
+        /// Per-region cell counts.
+        std::vector<std::size_t> numCells_{};
+
+        /// Sum of each quantity across all cells.
+        std::vector<double> total_{};
+
+        /// Linearised values of single quantity in single region set.
+        std::span<const double> regionValues(const std::vector<double>& values,
+                                             std::size_t regSet,
+                                             std::size_t q) const;
+    };
+
+    /// Constructor.
+    ///
+    /// \param[in] numCells Number of cells in all cell level arrays.
+    explicit RegionReduction(std::size_t numCells);
+
+    /// Register region set.
+    ///
+    /// \param[in] name Region set name, e.g., FIPNUM or FIPABC.
+    ///
+    /// \param[in] regionID Region ID of each cell.  Cells with non-positive
+    ///   region IDs are not part of any region.  Size must match the
+    ///   number of cells.
+    ///
+    /// \return Region set index.
+    std::size_t addRegionSet(const std::string& name, std::vector<int> regionID);
+
+    /// Number of registered region sets.
+    std::size_t numRegionSets() const { return this->name_.size(); }
+
+    /// Index of named region set.  Nullopt if no such region set has been
+    /// registered.
+    std::optional<std::size_t> regionSetIndex(const std::string& name) const;
+
+    /// Maximum region ID of particular region set.
+    int maxRegionID(const std::size_t regSet) const { return this->maxID_[regSet]; }
+
+    /// Reduce cell level quantities over all regions of all region sets.
+    ///
+    /// \param[in] quantities Cell level values of each quantity.  Sizes
+    ///   must match the number of cells.
+    ///
+    /// \param[in] poreVolume Cell pore volumes.  Weights of the regional
+    ///   averages.  Empty for arithmetic averages, otherwise the size must
+    ///   match the number of cells.
+    ///
+    /// \return Reduction results of all quantities in all regions of all
+    ///   region sets.
+    Result reduce(const std::vector<std::span<const double>>& quantities,
+                  std::span<const double> poreVolume = {}) const;
+
+private:
+    /// Number of cells.
+    std::size_t numCells_{};
+
+    /// Region set names.
+    std::vector<std::string> name_{};
+
+    /// Region IDs of each region set.
+    std::vector<std::vector<int>> regionID_{};
+
+    /// Maximum region ID of each region set.
+    std::vector<int> maxID_{};
+};
+
+}} // namespace Opm::out
+
+#endif // OPM_REGION_REDUCTION_HPP
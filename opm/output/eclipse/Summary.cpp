@@ -5941,7 +5941,7 @@ public:
                                    const EclipseGrid&  grid,
                                    const Schedule&     sched,
                                    const std::string&  basename,
-                                   const bool          writeEsmry);
+                                   const std::optional<Opm::EclIO::ExtSmryOutput::Options>& esmryOptions);
 
     SummaryImplementation(const SummaryImplementation& rhs) = delete;
     SummaryImplementation(SummaryImplementation&& rhs) = default;
@@ -6071,7 +6071,7 @@ SummaryImplementation(SummaryConfig&      sumcfg,
                       const EclipseGrid&  grid,
                       const Schedule&     sched,
                       const std::string&  basename,
-                      const bool          writeEsmry)
+                      const std::optional<Opm::EclIO::ExtSmryOutput::Options>& esmryOptions)
     : grid_          (std::cref(grid))
     , es_            (std::cref(es))
     , sched_         (std::cref(sched))
@@ -6089,6 +6089,8 @@ SummaryImplementation(SummaryConfig&      sumcfg,
         es, grid, sched, st, sched.getUDQConfig(sched.size() - 1)
     };
 
+    const auto writeEsmry = esmryOptions.has_value();
+
     const auto isGeomechWithFracturingRun =
         es.runspec().mech() && es.runspec().frac() &&
         !sumcfg.extraFracturingVectors().empty();
@@ -6123,7 +6125,8 @@ SummaryImplementation(SummaryConfig&      sumcfg,
             // an ESMRY file writing object for this run.  Constructor takes
             // a snapshot of the configured nodes.
             this->esmry_ = std::make_unique<Opm::EclIO::ExtSmryOutput>
-                (this->valueKeys_, this->valueUnits_, es, sched.posixStartTime());
+                (this->valueKeys_, this->valueUnits_, es, sched.posixStartTime(),
+                 *esmryOptions);
         }
         else {
             // We don't support formatted ESMRY files.
@@ -6741,7 +6744,20 @@ Summary::Summary(SummaryConfig&       sumcfg,
                  const Schedule&      sched,
                  const std::string&   basename,
                  const bool           writeEsmry)
-    : pImpl_ { std::make_unique<SummaryImplementation>(sumcfg, es, grid, sched, basename, writeEsmry) }
+    : pImpl_ { std::make_unique<SummaryImplementation>
+               (sumcfg, es, grid, sched, basename,
+                writeEsmry ? std::optional { EclIO::ExtSmryOutput::Options{} }
+                           : std::nullopt) }
+{}
+
+Summary::Summary(SummaryConfig&                       sumcfg,
+                 const EclipseState&                  es,
+                 const EclipseGrid&                   grid,
+                 const Schedule&                      sched,
+                 const std::string&                   basename,
+                 const EclIO::ExtSmryOutput::Options& esmryOptions)
+    : pImpl_ { std::make_unique<SummaryImplementation>
+               (sumcfg, es, grid, sched, basename, esmryOptions) }
 {}
 
 void Summary::recordNewDynamicWellConns(const DynamicConns& newConns)
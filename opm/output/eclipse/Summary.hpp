@@ -20,6 +20,8 @@
 #ifndef OPM_OUTPUT_SUMMARY_HPP
 #define OPM_OUTPUT_SUMMARY_HPP
 
+#include <opm/io/eclipse/ExtSmryOutput.hpp>
+
 #include <opm/output/data/Aquifer.hpp>
 #include <opm/output/data/Groups.hpp>
 #include <opm/output/data/InterRegFlowMap.hpp>
@@ -220,6 +222,22 @@ public:
             const std::string&  basename = "",
             const bool          writeEsmry = false);
 
+    /// Constructor creating an ESMRY file with a specific layout.
+    ///
+    /// Otherwise identical to the constructor above with writeEsmry set.
+    ///
+    /// \param[in] esmryOptions Layout of the ESMRY file.  Files written in
+    /// the chunked layout (esmryOptions.chunked) can only be read by
+    /// ExtESmry versions which recognise the CHUNKED header array.  Older
+    /// readers reject such files as invalid.  The default options produce
+    /// the traditional layout, readable by all versions.
+    Summary(SummaryConfig&                       sumcfg,
+            const EclipseState&                  es,
+            const EclipseGrid&                   grid,
+            const Schedule&                      sched,
+            const std::string&                   basename,
+            const EclIO::ExtSmryOutput::Options& esmryOptions);
+
     /// Destructor.
     ///
     /// Needed for PIMPL idiom.
@@ -45,13 +45,159 @@
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <initializer_list>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 
 namespace {
 
+    /// Writes INIT file arrays from a background thread.
+    ///
+    /// Arrays are written in the order in which they are submitted, so the
+    /// output is identical to writing them directly.  Meanwhile, the
+    /// calling thread extracts and converts the next arrays.  At most a
+    /// few arrays are pending at any time to bound memory use.
+    class InitWriter
+    {
+    public:
+        explicit InitWriter(::Opm::EclIO::OutputStream::Init& initFile)
+            : initFile_ { initFile }
+            , thread_   { [this]() { this->run(); } }
+        {}
+
+        ~InitWriter()
+        {
+            this->stop();
+        }
+
+        InitWriter(const InitWriter&) = delete;
+        InitWriter& operator=(const InitWriter&) = delete;
+
+        template <typename T>
+        void write(const std::string& kw, std::vector<T> data)
+        {
+            this->push([kw, data = std::move(data)]
+                       (::Opm::EclIO::OutputStream::Init& initFile)
+            {
+                initFile.write(kw, data);
+            });
+        }
+
+        void message(const std::string& msg)
+        {
+            this->push([msg](::Opm::EclIO::OutputStream::Init& initFile)
+            {
+                initFile.message(msg);
+            });
+        }
+
+        /// Wait for all pending arrays to be written.  Rethrows any
+        /// exception raised while writing.
+        void finish()
+        {
+            this->stop();
+
+            if (this->failure_) {
+                std::rethrow_exception(std::exchange(this->failure_, nullptr));
+            }
+        }
+
+    private:
+        using Task = std::function<void(::Opm::EclIO::OutputStream::Init&)>;
+
+        static constexpr std::size_t maxPending_ = 2;
+
+        ::Opm::EclIO::OutputStream::Init& initFile_;
+
+        std::mutex mutex_{};
+        std::condition_variable cond_{};
+        std::deque<Task> pending_{};
+        std::exception_ptr failure_{};
+        bool done_{false};
+
+        std::thread thread_;
+
+        void push(Task task)
+        {
+            std::unique_lock<std::mutex> lock { this->mutex_ };
+
+            this->cond_.wait(lock, [this]()
+            {
+                return (this->pending_.size() < maxPending_) || this->failure_;
+            });
+
+            if (this->failure_) {
+                std::rethrow_exception(std::exchange(this->failure_, nullptr));
+            }
+
+            this->pending_.push_back(std::move(task));
+            this->cond_.notify_all();
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock { this->mutex_ };
+                this->done_ = true;
+            }
+
+            this->cond_.notify_all();
+
+            if (this->thread_.joinable()) {
+                this->thread_.join();
+            }
+        }
+
+        void run()
+        {
+            while (true) {
+                Task task;
+                bool failed = false;
+
+                {
+                    std::unique_lock<std::mutex> lock { this->mutex_ };
+                    this->cond_.wait(lock, [this]()
+                    {
+                        return !this->pending_.empty() || this->done_;
+                    });
+
+                    if (this->pending_.empty()) {
+                        return;
+                    }
+
+                    task = std::move(this->pending_.front());
+                    failed = static_cast<bool>(this->failure_);
+                }
+
+                try {
+                    // Skip remaining arrays once writing has failed.
+                    if (! failed) {
+                        task(this->initFile_);
+                    }
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock { this->mutex_ };
+                    this->failure_ = std::current_exception();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock { this->mutex_ };
+                    this->pending_.pop_front();
+                }
+
+                this->cond_.notify_all();
+            }
+        }
+    };
+
     struct CellProperty
     {
         std::string                name;
@@ -242,7 +388,45 @@ namespace {
 
     std::vector<float> singlePrecision(const std::vector<double>& x)
     {
-        return { x.begin(), x.end() };
+        auto y = std::vector<float>(x.size());
+        const auto n = static_cast<std::int64_t>(x.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (n > 100000)
+#endif
+        for (std::int64_t i = 0; i < n; ++i) {
+            y[i] = static_cast<float>(x[i]);
+        }
+
+        return y;
+    }
+
+    /// Convert cell property from SI units to output units and single
+    /// precision.  Defaulted elements, if given, are replaced by the
+    /// sentinel value -1.0e+20.
+    std::vector<float> outputValues(const ::Opm::UnitSystem&         units,
+                                    const ::Opm::UnitSystem::measure unit,
+                                    const std::vector<double>&       value,
+                                    const std::vector<bool>*         dflt = nullptr)
+    {
+        auto y = units.from_si_float(unit, value);
+
+        if (dflt == nullptr) {
+            return y;
+        }
+
+        const auto n = static_cast<std::int64_t>(value.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (n > 100000)
+#endif
+        for (std::int64_t i = 0; i < n; ++i) {
+            if ((*dflt)[i]) {
+                y[i] = -1.0e+20f;
+            }
+        }
+
+        return y;
     }
 
     ::Opm::RestartIO::LogiHEAD::PVTModel
@@ -300,7 +484,7 @@ namespace {
     void writeInitFileHeader(const ::Opm::EclipseState&      es,
                              const ::Opm::EclipseGrid&       grid,
                              const ::Opm::Schedule&          sched,
-                             Opm::EclIO::OutputStream::Init& initFile)
+                             InitWriter&                     initFile)
     {
         {
             const auto ih = ::Opm::RestartIO::Helpers::
@@ -325,7 +509,7 @@ namespace {
     void writeInitFileHeaderLGRCell(const ::Opm::EclipseState&      es,
                                     const ::Opm::EclipseGridLGR&    local_grid,
                                     const ::Opm::Schedule&          sched,
-                                    Opm::EclIO::OutputStream::Init& initFile,
+                                    InitWriter&                     initFile,
                                                  int                index,
                                                  bool fullHeader =  true)
     {
@@ -384,7 +568,7 @@ namespace {
 
 
     void writePoreVolume(const   std::vector<double>&      porv,
-                         ::Opm::EclIO::OutputStream::Init& initFile)
+                         InitWriter&                       initFile)
     {
         initFile.write("PORV", singlePrecision(porv));
     }
@@ -392,7 +576,7 @@ namespace {
     void writePoreVolumeLGRCell(const   std::vector<double>&            porv,
                                 const   std::vector<int>&               global_fathers,
                                 const               int                 volume_prop,
-                                      ::Opm::EclIO::OutputStream::Init& initFile)
+                                      InitWriter&                       initFile)
 
     {
         auto local_porv = VectorUtil::filterArray(porv, global_fathers);
@@ -401,7 +585,7 @@ namespace {
     }
 
     void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
-                                    ::Opm::EclIO::OutputStream::Init& initFile)
+                                    InitWriter&                       initFile)
     {
         // The INIT file should always contain PVT, saturation function,
         // equilibration, and fluid-in-place region vectors.
@@ -423,7 +607,7 @@ namespace {
 
     void writeIntegerCellPropertiesLGRCell(const ::Opm::EclipseState&        es,
                                                    std::vector<int>&         global_fathers,
-                            ::Opm::EclIO::OutputStream::Init&                initFile)
+                            InitWriter&                                      initFile)
     {
         // The INIT file should always contain PVT, saturation function,
         // equilibration, and fluid-in-place region vectors.
@@ -442,51 +626,49 @@ namespace {
 
     void writeGridGeometry(const ::Opm::EclipseGrid&         grid,
                            const ::Opm::UnitSystem&          units,
-                           ::Opm::EclIO::OutputStream::Init& initFile)
+                           InitWriter&                       initFile)
     {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
+        auto dx    = std::vector<float>(nAct);
+        auto dy    = std::vector<float>(nAct);
+        auto dz    = std::vector<float>(nAct);
+        auto depth = std::vector<float>(nAct);
 
-        for (auto cell = 0*nAct; cell < nAct; ++cell) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (std::int64_t cell = 0; cell < static_cast<std::int64_t>(nAct); ++cell) {
             const auto  globCell = grid.getGlobalIndex(cell);
             const auto& dims     = grid.getCellDims(globCell);
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
+            dx   [cell] = units.from_si(length, dims[0]);
+            dy   [cell] = units.from_si(length, dims[1]);
+            dz   [cell] = units.from_si(length, dims[2]);
+            depth[cell] = units.from_si(length, grid.getCellDepth(globCell));
         }
 
-        initFile.write("DEPTH", depth);
-        initFile.write("DX"   , dx);
-        initFile.write("DY"   , dy);
-        initFile.write("DZ"   , dz);
+        initFile.write("DEPTH", std::move(depth));
+        initFile.write("DX"   , std::move(dx));
+        initFile.write("DY"   , std::move(dy));
+        initFile.write("DZ"   , std::move(dz));
     }
 
     void writeGridGeometryLGRCell(const ::Opm::EclipseGrid&         grid,
                                   const ::Opm::EclipseGridLGR&      lgr_grid,
                                   const ::Opm::UnitSystem&          units,
-                                        ::Opm::EclIO::OutputStream::Init& initFile,
+                                        InitWriter&                       initFile,
                                   const                  int        nx,
                                   const                  int        ny,
                                   const                  int        nz)
     {
         const auto length = ::Opm::UnitSystem::measure::length;
-        auto convert_length = [&units](std::vector<float>& depth)
-        {
-            std::ranges::transform(depth, depth.begin(),
-                                   [&units](const auto d) { return units.from_si(length, d);});
-        };
         const auto nAct   = lgr_grid.getNumActive();
         auto dx    = std::vector<float>{};  dx   .reserve(nAct);
         auto dy    = std::vector<float>{};  dy   .reserve(nAct);
         auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = singlePrecision(lgr_grid.getLGRCell_all_depth(grid));
+        auto depth = units.from_si_float(length, lgr_grid.getLGRCell_all_depth(grid));
 
         for (auto cell = 0*nAct; cell < nAct; ++cell) {
             const auto local_global_cell = lgr_grid.getGlobalIndex(cell);
@@ -498,11 +680,10 @@ namespace {
             dz   .push_back(units.from_si(length, dims[2])/nz);
         }
 
-        convert_length(depth);
-        initFile.write("DEPTH", depth);
-        initFile.write("DX"   , dx);
-        initFile.write("DY"   , dy);
-        initFile.write("DZ"   , dz);
+        initFile.write("DEPTH", std::move(depth));
+        initFile.write("DX"   , std::move(dx));
+        initFile.write("DY"   , std::move(dy));
+        initFile.write("DZ"   , std::move(dz));
     }
 
 
@@ -576,7 +757,7 @@ namespace {
                                    const ::Opm::FieldPropsManager&      fp,
                                    const ::Opm::UnitSystem&             units,
                                    const bool                           needDflt,
-                                   ::Opm::EclIO::OutputStream::Init&    initFile)
+                                   InitWriter&                          initFile)
     {
         if (needDflt) {
             writeCellDoublePropertiesWithDefaultFlag(propList, fp,
@@ -584,20 +765,9 @@ namespace {
                                     std::vector<bool>&&   dflt,
                                     std::vector<double>&& value)
             {
-                units.from_si(prop.unit, value);
-
-                for (auto n = dflt.size(), i = 0*n; i < n; ++i) {
-                    if (dflt[i]) {
-                        // Element defaulted.  Output sentinel value
-                        // (-1.0e+20) to signify defaulted element.
-                        //
-                        // Note: Start as float for roundtripping through
-                        // function singlePrecision().
-                        value[i] = static_cast<double>(-1.0e+20f);
-                    }
-                }
-
-                initFile.write(prop.name, singlePrecision(value));
+                // Defaulted elements are output as the sentinel value
+                // -1.0e+20.
+                initFile.write(prop.name, outputValues(units, prop.unit, value, &dflt));
             });
         }
         else {
@@ -605,8 +775,7 @@ namespace {
                 [&units, &initFile](const CellProperty&   prop,
                                     std::vector<double>&& value)
             {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
+                initFile.write(prop.name, outputValues(units, prop.unit, value));
             });
         }
     }
@@ -615,7 +784,7 @@ namespace {
                                           const ::Opm::FieldPropsManager&      fp,
                                           const ::Opm::UnitSystem&             units,
                                           const bool                           needDflt,
-                                          ::Opm::EclIO::OutputStream::Init&    initFile,
+                                          InitWriter&                          initFile,
                                           const std::vector<int>&              global_fathers)
     {
         if (needDflt) {
@@ -624,20 +793,9 @@ namespace {
                                     std::vector<bool>&&   dflt,
                                     std::vector<double>&& value)
             {
-                units.from_si(prop.unit, value);
-
-                for (auto n = dflt.size(), i = 0*n; i < n; ++i) {
-                    if (dflt[i]) {
-                        // Element defaulted.  Output sentinel value
-                        // (-1.0e+20) to signify defaulted element.
-                        //
-                        // Note: Start as float for roundtripping through
-                        // function singlePrecision().
-                        value[i] = static_cast<double>(-1.0e+20f);
-                    }
-                }
-
-                initFile.write(prop.name, singlePrecision(value));
+                // Defaulted elements are output as the sentinel value
+                // -1.0e+20.
+                initFile.write(prop.name, outputValues(units, prop.unit, value, &dflt));
             });
         }
         else {
@@ -645,15 +803,14 @@ namespace {
                 [&units, &initFile](const CellProperty&   prop,
                                     std::vector<double>&& value)
             {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
+                initFile.write(prop.name, outputValues(units, prop.unit, value));
             });
         }
     }
 
     void writeDoubleCellProperties(const ::Opm::EclipseState&        es,
                                    const ::Opm::UnitSystem&          units,
-                                   ::Opm::EclIO::OutputStream::Init& initFile,
+                                   InitWriter&                       initFile,
                                    std::optional<std::reference_wrapper<const std::vector<int>>> global_fathers = std::nullopt)
     {
         const auto doubleKeywords = Properties {
@@ -695,7 +852,7 @@ namespace {
 
     void writeSimulatorProperties(const ::Opm::EclipseGrid&         grid,
                                   const ::Opm::data::Solution&      simProps,
-                                  ::Opm::EclIO::OutputStream::Init& initFile)
+                                  InitWriter&                       initFile)
     {
         for (const auto& prop : simProps) {
             const auto& value = grid.compressedVector(prop.second.data<double>());
@@ -706,7 +863,7 @@ namespace {
 
     void writeSimulatorPropertiesLGRCell(const ::Opm::EclipseGrid&         grid,
                                          const ::Opm::data::Solution&      simProps,
-                                         ::Opm::EclIO::OutputStream::Init& initFile,
+                                         InitWriter&                       initFile,
                                          const std::vector<int>&           global_fathers,
                                          bool fullProperties = false)
     {
@@ -725,7 +882,7 @@ namespace {
 
     void writeTableData(const ::Opm::EclipseState&        es,
                         const ::Opm::UnitSystem&          units,
-                        ::Opm::EclIO::OutputStream::Init& initFile)
+                        InitWriter&                       initFile)
     {
         ::Opm::Tables tables(units);
 
@@ -738,7 +895,7 @@ namespace {
     }
 
     void writeIntegerMaps(const std::map<std::string, std::vector<int>>& mapData,
-                          ::Opm::EclIO::OutputStream::Init&       initFile)
+                          InitWriter&                             initFile)
     {
         for (const auto& pair : mapData) {
             const auto& key = pair.first;
@@ -756,7 +913,7 @@ namespace {
     void writeFilledSatFuncScaling(const Properties&                 propList,
                                    ::Opm::FieldPropsManager&&        fp,
                                    const ::Opm::UnitSystem&          units,
-                                   ::Opm::EclIO::OutputStream::Init& initFile)
+                                   InitWriter&                       initFile)
     {
         for (const auto& prop : propList) {
             if (prop.supports_auto_create) {
@@ -770,7 +927,7 @@ namespace {
 
     void writeSatFuncScaling(const ::Opm::EclipseState&        es,
                              const ::Opm::UnitSystem&          units,
-                             ::Opm::EclIO::OutputStream::Init& initFile)
+                             InitWriter&                       initFile)
     {
         const auto epsVectors = ScalingVectors{}
             .withHysteresis(es.runspec().hysterPar().active())
@@ -803,7 +960,7 @@ namespace {
 
     void writeNonNeighbourConnections(const std::vector<::Opm::NNCdata>& nnc,
                                       const ::Opm::UnitSystem&           units,
-                                      ::Opm::EclIO::OutputStream::Init&  initFile)
+                                      InitWriter&                        initFile)
     {
         auto tran = std::vector<double>{};
         tran.reserve(nnc.size());
@@ -811,15 +968,14 @@ namespace {
         std::ranges::transform(nnc, std::back_inserter(tran),
                                [](const auto& nd) { return nd.trans; });
 
-        units.from_si(::Opm::UnitSystem::measure::transmissibility, tran);
-
-        initFile.write("TRANNNC", singlePrecision(tran));
+        initFile.write("TRANNNC",
+                       units.from_si_float(::Opm::UnitSystem::measure::transmissibility, tran));
     }
 
     // output aquifer cell and aquifer connection information for numerical aquifers
     void writeNumericalAquifers(const Opm::NumericalAquifers& num_aquifers,
                                 const ::Opm::EclipseGrid&          grid,
-                                ::Opm::EclIO::OutputStream::Init&  initFile)
+                                InitWriter&                        initFile)
     {
         std::vector<int> aquifern(grid.getNumActive(), 0);
         // aquifer cells
@@ -839,12 +995,12 @@ namespace {
             }
         }
 
-        initFile.write("AQUIFERN", aquifern);
+        initFile.write("AQUIFERN", std::move(aquifern));
     }
 
     void writeAnalyticalAquiferConnections(const Opm::AquiferConfig&          aquifer,
                                            const ::Opm::EclipseGrid&          grid,
-                                           ::Opm::EclIO::OutputStream::Init&  initFile)
+                                           InitWriter&                        initFile)
     {
         std::vector<int> aquifera(grid.getNumActive(), 0);
 
@@ -857,12 +1013,12 @@ namespace {
             }
         }
 
-        initFile.write("AQUIFERA", aquifera);
+        initFile.write("AQUIFERA", std::move(aquifera));
     }
 
     void writeAquifers(const Opm::AquiferConfig&          aquifer,
                        const ::Opm::EclipseGrid&          grid,
-                       ::Opm::EclIO::OutputStream::Init&  initFile)
+                       InitWriter&                        initFile)
     {
         if (aquifer.hasNumericalAquifer()) {
             writeNumericalAquifers(aquifer.numericalAquifers(), grid, initFile);
@@ -879,7 +1035,7 @@ namespace {
                                  const std::vector<std::reference_wrapper<const ::Opm::data::Solution>> simProps,
                                  const std::vector<double>& porv,
                                  const ::Opm::UnitSystem& units,
-                                       ::Opm::EclIO::OutputStream::Init& initFile)
+                                       InitWriter&                       initFile)
     {
         bool fullProperties = simProps.size() > 1;
         if (grid.is_lgr()) {
@@ -925,15 +1081,14 @@ namespace {
         tran.reserve(nncs.size());
         std::ranges::transform(nncs, std::back_inserter(tran),
                                [](const auto& nd) { return nd.trans; });
-        units.from_si(::Opm::UnitSystem::measure::transmissibility, tran);
-        return singlePrecision(tran);
+        return units.from_si_float(::Opm::UnitSystem::measure::transmissibility, tran);
     }
 
     // Write TRANNNC for one LGR: same-grid NNCs within the LGR, or empty if none.
     void writeLGRTranNNC(std::size_t                              lgr_grid_index,
                          const ::Opm::NNCCollection&              nnc_col,
                          const ::Opm::UnitSystem&                 units,
-                         ::Opm::EclIO::OutputStream::Init&        initFile)
+                         InitWriter&                              initFile)
     {
         if (nnc_col.hasSameGridNNC(lgr_grid_index)) {
             writeNonNeighbourConnections(nnc_col.getNNC(lgr_grid_index).input(), units, initFile);
@@ -946,7 +1101,7 @@ namespace {
     void writeLGRTranGL(std::size_t                              lgr_grid_index,
                         const ::Opm::NNCCollection&              nnc_col,
                         const ::Opm::UnitSystem&                 units,
-                        ::Opm::EclIO::OutputStream::Init&        initFile)
+                        InitWriter&                              initFile)
     {
         if (!nnc_col.hasCrossGridNNC(0, lgr_grid_index))
             return;
@@ -962,7 +1117,7 @@ namespace {
                         const ::Opm::NNCCollection&              nnc_col,
                         const std::vector<std::string>&          all_lgr_tag,
                         const ::Opm::UnitSystem&                 units,
-                        ::Opm::EclIO::OutputStream::Init&        initFile)
+                        InitWriter&                              initFile)
     {
         using PaddedString = Opm::EclIO::PaddedOutputString<8>;
         for (const auto& [key, nnc_diff] : nnc_col.diff_grid_nnc()) {
@@ -979,7 +1134,7 @@ namespace {
     void writeLGRnnc(const ::Opm::EclipseState&              es,
                      const ::Opm::EclipseGrid&               grid,
                      const ::Opm::Schedule&                  schedule,
-                           ::Opm::EclIO::OutputStream::Init& initFile,
+                           InitWriter&                       initFile,
                      const ::Opm::NNCCollection&             nnc_col)
     {
         if (!grid.is_lgr())
@@ -1060,10 +1215,14 @@ void Opm::InitIO::write(const ::Opm::EclipseState&                  es,
                         const std::vector<std::reference_wrapper<const ::Opm::data::Solution>>   simProps,
                         std::map<std::string, std::vector<int>>     int_data,
                         const NNCCollection&                        nnc_col,
-                        ::Opm::EclIO::OutputStream::Init&           initFile)
+                        ::Opm::EclIO::OutputStream::Init&           initStream)
 {
     const auto& units = es.getUnits();
 
+    // Arrays are extracted and converted here, and written to initStream
+    // in submission order by the writer's background thread.
+    InitWriter initFile { initStream };
+
     // GLOBAL HEADER (INTEHEAD, LOGIHEAD, DOUBHEAD)
     writeInitFileHeader(es, grid, schedule, initFile);
 
@@ -1122,4 +1281,5 @@ void Opm::InitIO::write(const ::Opm::EclipseState&                  es,
         writeAquifers(es.aquifer(), grid, initFile);
     }
 
+    initFile.finish();
 }
@@ -46,6 +46,8 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <initializer_list>
 #include <memory>
@@ -1917,8 +1919,21 @@ void Opm::RftIO::write(const int                        reportStep,
     const auto timePoint = ::Opm::RestartIO::
         getSimulationTimePoint(schedule.getStartTime(), elapsed);
 
+    // Wells for which RFT file output is requested at this time and for
+    // which dynamic data is available, in output order.
+    struct WellRequest
+    {
+        std::vector<WellRFTOutputData::DataTypes> rftTypes{};
+        const ::Opm::Well* well{nullptr};
+        const ::Opm::data::Well* wellSol{nullptr};
+
+        std::unique_ptr<WellRFTOutputData> output{};
+        std::exception_ptr error{};
+    };
+
+    auto requests = std::vector<WellRequest>{};
     for (const auto& wname : schedule.wellNames(reportStep)) {
-        const auto rftTypes = rftDataTypes(rftCfg, wname);
+        auto rftTypes = rftDataTypes(rftCfg, wname);
 
         if (rftTypes.empty()) {
             // RFT file output not requested for 'wname' at this time.
@@ -1931,18 +1946,42 @@ void Opm::RftIO::write(const int                        reportStep,
             continue;
         }
 
-        // RFT file output requested for 'wname' at this time and dynamic
-        // data is available.  Collect requisite information.
-        auto rftOutput = WellRFTOutputData {
-            rftTypes, elapsed, timePoint, usys, grid,
-            schedule[reportStep].wells(wname)
-        };
+        requests.push_back({ std::move(rftTypes),
+                             &schedule[reportStep].wells(wname),
+                             &xwPos->second });
+    }
+
+    // Collect the requisite information for each well.  The wells are
+    // independent, and each request owns its output buffers, so this is
+    // done in parallel.  WellRFTOutputData refers to itself through its
+    // handlers, hence must not be moved once created.
+    const auto numRequests = static_cast<std::int64_t>(requests.size());
 
-        rftOutput.addDynamicData(xwPos->second);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::int64_t reqIx = 0; reqIx < numRequests; ++reqIx) {
+        auto& request = requests[reqIx];
+
+        try {
+            request.output = std::make_unique<WellRFTOutputData>
+                (request.rftTypes, elapsed, timePoint, usys, grid, *request.well);
+
+            request.output->addDynamicData(*request.wellSol);
+        }
+        catch (...) {
+            request.error = std::current_exception();
+        }
+    }
+
+    // Emit RFT file output records in well order.  This transparently
+    // handles wells without connections--e.g., if the well is only
+    // connected in inactive/deactivated cells.
+    for (const auto& request : requests) {
+        if (request.error) {
+            std::rethrow_exception(request.error);
+        }
 
-        // Emit RFT file output record for 'wname'.  This transparently
-        // handles wells without connections--e.g., if the well is only
-        // connected in inactive/deactivated cells.
-        rftOutput.write(rftFile);
+        request.output->write(rftFile);
     }
 }
@@ -0,0 +1,285 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_COPY_ON_WRITE_VECTOR_HPP
+#define OPM_COPY_ON_WRITE_VECTOR_HPP
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+namespace Utility {
+
+/// Sequence container with chunked, copy-on-write storage.
+///
+/// Elements are stored in chunks of \c ChunkSize elements, and copies of
+/// the container share those chunks.  Any non-const access to an element
+/// first gives the container its own copy of the chunk holding that
+/// element.  A copy in which only a few elements are subsequently changed
+/// therefore shares all other chunks with the container it was copied
+/// from.  This is intended for objects that are copied on every update,
+/// such as the per report step snapshots of a Schedule.
+///
+/// The interface is a subset of that of std::vector.  Note that reading
+/// through non-const accessors or iterators also unshares chunks, so code
+/// which only inspects the elements of a non-const container should use
+/// std::as_const() or cbegin()/cend().
+///
+/// Serialises as a std::vector<T>.
+template <class T, std::size_t ChunkSize = 64>
+class CopyOnWriteVector
+{
+    static_assert(ChunkSize > 0, "Chunk size must be positive");
+
+    using Chunk = std::vector<T>;
+
+    template <bool IsConst>
+    class Iterator
+    {
+        using Container = std::conditional_t<IsConst, const CopyOnWriteVector, CopyOnWriteVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+
+        Iterator() = default;
+
+        Iterator(Container* container, const std::size_t index)
+            : container_ { container }
+            , index_     { static_cast<difference_type>(index) }
+        {}
+
+        operator Iterator<true>() const
+            requires (!IsConst)
+        {
+            return { this->container_, static_cast<std::size_t>(this->index_) };
+        }
+
+        reference operator*() const { return (*this->container_)[this->index_]; }
+        pointer operator->() const { return &**this; }
+        reference operator[](const difference_type n) const { return (*this->container_)[this->index_ + n]; }
+
+        Iterator& operator++() { ++this->index_; return *this; }
+        Iterator& operator--() { --this->index_; return *this; }
+        Iterator operator++(int) { auto tmp = *this; ++this->index_; return tmp; }
+        Iterator operator--(int) { auto tmp = *this; --this->index_; return tmp; }
+        Iterator& operator+=(const difference_type n) { this->index_ += n; return *this; }
+        Iterator& operator-=(const difference_type n) { this->index_ -= n; return *this; }
+
+        friend Iterator operator+(Iterator it, const difference_type n) { return it += n; }
+        friend Iterator operator+(const difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator-(Iterator it, const difference_type n) { return it -= n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b) { return a.index_ - b.index_; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.index_ == b.index_; }
+        friend auto operator<=>(const Iterator& a, const Iterator& b) { return a.index_ <=> b.index_; }
+
+    private:
+        Container* container_{nullptr};
+        difference_type index_{0};
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    CopyOnWriteVector() = default;
+
+    CopyOnWriteVector(std::initializer_list<T> values)
+    {
+        this->assign(values.begin(), values.end());
+    }
+
+    explicit CopyOnWriteVector(const std::vector<T>& values)
+    {
+        this->assign(values.begin(), values.end());
+    }
+
+    template <class InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        this->clear();
+        for (; first != last; ++first) {
+            this->push_back(*first);
+        }
+    }
+
+    size_type size() const { return this->size_; }
+    bool empty() const { return this->size_ == 0; }
+
+    void clear()
+    {
+        this->chunks_.clear();
+        this->size_ = 0;
+    }
+
+    void reserve(const size_type n)
+    {
+        this->chunks_.reserve((n + ChunkSize - 1) / ChunkSize);
+    }
+
+    const T& operator[](const size_type i) const
+    {
+        return (*this->chunks_[i / ChunkSize])[i % ChunkSize];
+    }
+
+    T& operator[](const size_type i)
+    {
+        return this->ownChunk(i / ChunkSize)[i % ChunkSize];
+    }
+
+    const T& at(const size_type i) const
+    {
+        this->checkIndex(i);
+        return (*this)[i];
+    }
+
+    T& at(const size_type i)
+    {
+        this->checkIndex(i);
+        return (*this)[i];
+    }
+
+    const T& front() const { return (*this)[0]; }
+    const T& back() const { return (*this)[this->size_ - 1]; }
+    T& front() { return (*this)[0]; }
+    T& back() { return (*this)[this->size_ - 1]; }
+
+    template <class... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (this->size_ % ChunkSize == 0) {
+            auto chunk = std::make_shared<Chunk>();
+            chunk->reserve(ChunkSize);
+            this->chunks_.push_back(std::move(chunk));
+        }
+
+        auto& elm = this->ownChunk(this->chunks_.size() - 1)
+            .emplace_back(std::forward<Args>(args)...);
+
+        ++this->size_;
+        return elm;
+    }
+
+    void push_back(const T& value) { this->emplace_back(value); }
+    void push_back(T&& value) { this->emplace_back(std::move(value)); }
+
+    const_iterator begin() const { return { this, 0 }; }
+    const_iterator end() const { return { this, this->size_ }; }
+    const_iterator cbegin() const { return this->begin(); }
+    const_iterator cend() const { return this->end(); }
+    iterator begin() { return { this, 0 }; }
+    iterator end() { return { this, this->size_ }; }
+
+    /// Number of chunks shared with at least one other container.
+    /// Mainly for diagnostics and testing.
+    size_type sharedChunks() const
+    {
+        return static_cast<size_type>
+            (std::ranges::count_if(this->chunks_, [](const auto& chunk)
+                                   { return chunk.use_count() > 1; }));
+    }
+
+    bool operator==(const CopyOnWriteVector& that) const
+    {
+        if (this->size_ != that.size_) {
+            return false;
+        }
+
+        // Shared chunks are equal by construction.
+        for (auto c = 0*this->chunks_.size(); c < this->chunks_.size(); ++c) {
+            if ((this->chunks_[c] != that.chunks_[c]) &&
+                !(*this->chunks_[c] == *that.chunks_[c]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool operator!=(const CopyOnWriteVector& that) const
+    {
+        return ! (*this == that);
+    }
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        if (serializer.isSerializing()) {
+            auto values = std::vector<T>(this->cbegin(), this->cend());
+            serializer(values);
+        }
+        else {
+            auto values = std::vector<T>{};
+            serializer(values);
+            this->assign(values.begin(), values.end());
+        }
+    }
+
+private:
+    std::vector<std::shared_ptr<Chunk>> chunks_{};
+    size_type size_{0};
+
+    Chunk& ownChunk(const size_type c)
+    {
+        auto& chunk = this->chunks_[c];
+        if (chunk.use_count() > 1) {
+            auto copy = std::make_shared<Chunk>();
+            copy->reserve(ChunkSize);
+            copy->assign(chunk->begin(), chunk->end());
+            chunk = std::move(copy);
+        }
+
+        return *chunk;
+    }
+
+    void checkIndex(const size_type i) const
+    {
+        if (i >= this->size_) {
+            throw std::out_of_range {
+                "Index " + std::to_string(i) + " outside container of size "
+                + std::to_string(this->size_)
+            };
+        }
+    }
+};
+
+} // namespace Utility
+} // namespace Opm
+
+#endif // OPM_COPY_ON_WRITE_VECTOR_HPP
@@ -2,6 +2,10 @@
 #define SUNBEAM_CONVERTERS_HPP
 
 #include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
@@ -27,25 +31,57 @@ py::array numpy_string_array(const std::vector<std::string>& input);
 
 template <class T>
 std::vector<T> vector(py::array_t<T>& input) {
-    T * input_ptr    = (T *) input.request().ptr;
-    std::vector<T> output(input.size());
+    const T * input_ptr = static_cast<const T*>(input.request().ptr);
+    return std::vector<T>(input_ptr, input_ptr + input.size());
+}
+
+
+template <class T>
+py::array_t<T> numpy_array(const std::vector<T>& input) {
+    if constexpr (std::is_same_v<T, bool>) {
+        auto output =  py::array_t<T>(input.size());
+        T * py_array_ptr = (T*)output.request().ptr;
 
-    for (int i = 0; i < input.size(); i++)
-        output[i] = input_ptr[i];
+        for (size_t i = 0; i < input.size(); i++)
+            py_array_ptr[i] = input[i];
 
-    return output;
+        return output;
+    }
+    else {
+        return py::array_t<T>(input.size(), input.data());
+    }
 }
 
 
+/*
+  Takes ownership of the vector's buffer, avoiding a copy of temporaries.
+*/
 template <class T>
-py::array_t<T> numpy_array(const std::vector<T>& input) {
-    auto output =  py::array_t<T>(input.size());
-    T * py_array_ptr = (T*)output.request().ptr;
+    requires (!std::is_same_v<T, bool>)
+py::array_t<T> numpy_array(std::vector<T>&& input) {
+    auto* data = new std::vector<T>(std::move(input));
+    py::capsule owner(data, [](void* p) { delete static_cast<std::vector<T>*>(p); });
+
+    return py::array_t<T>(data->size(), data->data(), owner);
+}
 
-    for (size_t i = 0; i < input.size(); i++)
-        py_array_ptr[i] = input[i];
 
-    return output;
+/*
+  Read-only view of data owned by a bound C++ object. No data is copied; the
+  view keeps 'owner', the Python object holding the data, alive. The data
+  must not be reallocated for as long as the owner exists.
+*/
+template <class T>
+py::array_t<T> numpy_view(const std::vector<T>& input, py::handle owner) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return numpy_array(input);
+    }
+    else {
+        auto output = py::array_t<T>(input.size(), input.data(), owner);
+        output.attr("setflags")(py::arg("write") = false);
+
+        return output;
+    }
 }
 
 }
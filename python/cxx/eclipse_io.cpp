@@ -2,6 +2,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 #include <pybind11/chrono.h>
+#include <algorithm>
 #include <filesystem>
 #include <stdexcept>
 
@@ -15,7 +16,6 @@
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
-#include <opm/common/utility/numeric/calculateCellVol.hpp>
 
 #include "export.hpp"
 #include "converters.hpp"
@@ -30,6 +30,14 @@ namespace {
 using npArray = std::tuple<py::array, Opm::EclIO::eclArrType>;
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, int64_t>;
 
+// Python object wrapping 'obj', used as the owner of NumPy views into data
+// held by 'obj'.
+template <class T>
+py::object owner(T* obj)
+{
+    return py::cast(obj, py::return_value_policy::reference);
+}
+
 class ESmryBind {
 
 public:
@@ -73,9 +81,9 @@ public:
     py::array get_smry_vector(const std::string& key)
     {
         if (m_esmry != nullptr)
-            return convert::numpy_array( m_esmry->get(key) );
+            return convert::numpy_view( m_esmry->get(key), owner(this) );
         else
-            return convert::numpy_array( m_ext_esmry->get(key) );
+            return convert::numpy_view( m_ext_esmry->get(key), owner(this) );
     }
 
     py::array get_smry_vector_at_rsteps(const std::string& key)
@@ -86,6 +94,72 @@ public:
             return convert::numpy_array( m_ext_esmry->get_at_rstep(key) );
     }
 
+    // All requested vectors as rows of a single (keys x time) array.  Keys
+    // may be repeated.  Vectors are loaded with the GIL held, since loading
+    // modifies the ESmry object, and only the copy into the result runs
+    // with the GIL released.
+    py::array get_smry_vectors(const std::vector<std::string>& keys, bool at_rsteps)
+    {
+        for (const auto& key : keys) {
+            if (! this->hasKey(key))
+                throw std::invalid_argument("Summary vector " + key + " not found");
+        }
+
+        std::vector<std::vector<float>> rstep_data;
+        std::vector<const std::vector<float>*> rows(keys.size(), nullptr);
+
+        if (at_rsteps) {
+            rstep_data.reserve(keys.size());
+
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                if (m_esmry != nullptr)
+                    rstep_data.push_back(m_esmry->get_at_rstep(keys[i]));
+                else
+                    rstep_data.push_back(m_ext_esmry->get_at_rstep(keys[i]));
+
+                rows[i] = &rstep_data.back();
+            }
+        }
+        else {
+            std::vector<std::string> unique_keys;
+            unique_keys.reserve(keys.size());
+
+            for (const auto& key : keys) {
+                if (std::find(unique_keys.begin(), unique_keys.end(), key) == unique_keys.end())
+                    unique_keys.push_back(key);
+            }
+
+            if (m_esmry != nullptr)
+                m_esmry->loadData(unique_keys);
+            else
+                m_ext_esmry->loadData(unique_keys);
+
+            for (std::size_t i = 0; i < keys.size(); ++i)
+                rows[i] = (m_esmry != nullptr) ? &m_esmry->get(keys[i]) : &m_ext_esmry->get(keys[i]);
+        }
+
+        const std::size_t ncols = rows.empty() ? 0 : rows.front()->size();
+
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            if (rows[i]->size() != ncols)
+                throw std::runtime_error("Summary vector " + keys[i] + " has " +
+                                         std::to_string(rows[i]->size()) + " values, expected " +
+                                         std::to_string(ncols));
+        }
+
+        py::array_t<float> result({keys.size(), ncols});
+        float* dest = result.mutable_data();
+
+        {
+            py::gil_scoped_release release;
+
+            for (std::size_t i = 0; i < rows.size(); ++i)
+                std::copy_n(rows[i]->begin(), ncols, dest + i*ncols);
+        }
+
+        return result;
+    }
+
     std::tuple<int, int, int,int, int, int, bool> smry_start_date()
     {
         time_point utc_chrono;
@@ -208,13 +282,13 @@ npArray get_vector_index(Opm::EclIO::EclFile * file_ptr, std::size_t array_index
     auto array_type = std::get<1>(file_ptr->getList()[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<int>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<int>(array_index), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<float>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<float>(array_index), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<double>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<double>(array_index), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
         return std::make_tuple (convert::numpy_array( file_ptr->get<bool>(array_index)), array_type);
@@ -281,13 +355,13 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
     auto array_type = std::get<1>(arrList[index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<int>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<int>(index, rstep), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<float>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<float>(index, rstep), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<double>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<double>(index, rstep), owner(file_ptr)), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
         return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<bool>(index, rstep)), array_type);
@@ -366,26 +440,27 @@ py::array get_cellvolumes_mask(Opm::EclIO::EGrid * file_ptr, std::vector<int> ma
     if (totCells != mask.size())
         throw std::logic_error("size of input mask doesn't match size of grid");
 
-    std::array<double,8> X = {0.0};
-    std::array<double,8> Y = {0.0};
-    std::array<double,8> Z = {0.0};
-
+    std::vector<int> cells;
     for (size_t globInd = 0; globInd < totCells; globInd++){
-        if (mask[globInd] > 0){
-            file_ptr->getCellCorners(globInd, X, Y, Z);
-            celvol[globInd] = calculateCellVol(X, Y, Z);
-        }
+        if (mask[globInd] > 0)
+            cells.push_back(globInd);
     }
 
-    return convert::numpy_array( celvol );
+    std::vector<double> volume(cells.size());
+    file_ptr->cellGeometry(cells, { .volume = volume });
+
+    for (size_t n = 0; n < cells.size(); n++)
+        celvol[cells[n]] = volume[n];
+
+    return convert::numpy_array( std::move(celvol) );
 }
 
 py::array get_cellvolumes(Opm::EclIO::EGrid * file_ptr)
 {
-    int totCells = file_ptr->totalNumberOfCells();
-    std::vector<int> mask(totCells, 1);
+    std::vector<double> celvol(file_ptr->totalNumberOfCells());
+    file_ptr->cellGeometry({ .volume = celvol });
 
-    return get_cellvolumes_mask(file_ptr, mask);
+    return convert::numpy_array( std::move(celvol) );
 }
 
 npArray get_rft_vector_WellDate(Opm::EclIO::ERft * file_ptr,const std::string& name,
@@ -396,13 +471,13 @@ npArray get_rft_vector_WellDate(Opm::EclIO::ERft * file_ptr,const std::string& n
     Opm::EclIO::eclArrType array_type = std::get<1>(arrList[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<int>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<int>(name, well, y, m, d), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<float>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<float>(name, well, y, m, d), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<double>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<double>(name, well, y, m, d), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRft<std::string>(name, well, y, m, d) ), array_type);
@@ -420,13 +495,13 @@ npArray get_rft_vector_Index(Opm::EclIO::ERft * file_ptr,const std::string& name
     Opm::EclIO::eclArrType array_type = std::get<1>(arrList[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<int>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<int>(name, reportIndex), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<float>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<float>(name, reportIndex), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<double>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<double>(name, reportIndex), owner(file_ptr) ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRft<std::string>(name, reportIndex) ), array_type);
@@ -501,6 +576,7 @@ void python::common::export_IO(py::module& m) {
         .def("__len__", &ESmryBind::numberOfTimeSteps, ESmry_len_docstring)
         .def("__get_all", &ESmryBind::get_smry_vector, py::arg("key"), ESmry_get_all_docstring)
         .def("__get_at_rstep", &ESmryBind::get_smry_vector_at_rsteps, py::arg("key"), ESmry_get_at_rstep_docstring)
+        .def("__get_vectors", &ESmryBind::get_smry_vectors, py::arg("keys"), py::arg("at_rsteps") = false, ESmry_get_vectors_docstring)
         .def("__start_date", &ESmryBind::smry_start_date, ESmry_start_date_docstring)
         .def("keys", (const std::vector<std::string>& (ESmryBind::*) (void) const)
             &ESmryBind::keywordList, ESmry_keys1_docstring)
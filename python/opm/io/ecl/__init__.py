@@ -87,13 +87,21 @@ def esmry_start_date(self):
         return startd
 
 
+# Arrays returned for a single key are read-only views of the data held by
+# the ESmry object. A list of keys gives a two-dimensional array with one row
+# per key.
+
 def getitem_esmry(self, arg):
 
     if isinstance(arg, tuple):
-        if arg[1] == True:
+        if isinstance(arg[0], list):
+            return self.__get_vectors(arg[0], arg[1] == True)
+        elif arg[1] == True:
             return self.__get_at_rstep(arg[0])
         else:
             return self.__get_all(arg[0])
+    elif isinstance(arg, list):
+        return self.__get_vectors(arg)
     else:
         return self.__get_all(arg)
 
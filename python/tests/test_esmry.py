@@ -228,6 +228,46 @@ class TestEclFile(unittest.TestCase):
             self.assertEqual(key, ref)
 
 
+    def test_get_vectors(self):
+
+        smry1 = ESmry(test_path("data/SPE1CASE1.SMSPEC"))
+        keys = ["TIME", "FOPR", "WGOR:PROD"]
+
+        data = smry1[keys]
+        self.assertEqual(data.shape, (3, len(smry1)))
+
+        for row, key in zip(data, keys):
+            self.assertTrue(np.array_equal(row, smry1[key]))
+
+        data_rstep = smry1[keys, True]
+        self.assertEqual(data_rstep.shape, (3, 64))
+        self.assertTrue(np.array_equal(data_rstep[1], smry1["FOPR", True]))
+
+        with self.assertRaises(ValueError):
+            smry1[["TIME", "XXX"]]
+
+        # Repeated keys give repeated rows, also for vectors not yet loaded.
+        smry2 = ESmry(test_path("data/SPE1CASE1.SMSPEC"))
+        fgpr = smry2["FGPR"]
+
+        data = smry2[["FGPR", "FOPR", "FOPR"]]
+        self.assertEqual(data.shape, (3, len(smry2)))
+        self.assertTrue(np.array_equal(data[0], fgpr))
+        self.assertTrue(np.array_equal(data[1], data[2]))
+        self.assertEqual(len(smry2["FOPR"]), len(smry2))
+
+        data = smry2[["WGOR:PROD", "WGOR:PROD", "TIME"]]
+        self.assertEqual(data.shape, (3, len(smry2)))
+        self.assertTrue(np.array_equal(data[0], smry2["WGOR:PROD"]))
+        self.assertTrue(np.array_equal(data[1], data[0]))
+
+        # Single vectors are read-only views kept alive by the array.
+        time = smry1["TIME"]
+        self.assertFalse(time.flags.writeable)
+
+        del smry1
+        self.assertEqual(time[0], 1.0)
+
 
 if __name__ == "__main__":
 
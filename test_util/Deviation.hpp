@@ -20,6 +20,11 @@
 #ifndef DEVIATION_HPP
 #define DEVIATION_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
 /*! \brief Deviation struct.
     \details The member variables are default initialized to -1,
              which is an invalid deviation value.
@@ -29,4 +34,51 @@ struct Deviation {
     double rel = -1; //!< Relative deviation
 };
 
+/*! \brief Number of element pairs whose deviation exceeds the tolerances.
+    \details Same criterion as the element-by-element comparison in
+             ECLRegressionTest: a pair fails if its absolute deviation exceeds
+             absTol and its relative deviation either exceeds relTol or is
+             undefined because one of the values is zero.  Written as a
+             branch-free reduction so that the compiler can vectorise it.
+ */
+template <typename T>
+std::size_t countToleranceViolations(const T* v1, const T* v2, const std::size_t n,
+                                     const double absTol, const double relTol)
+{
+    std::size_t count = 0;
+
+#pragma omp simd reduction(+:count)
+    for (std::size_t i = 0; i < n; ++i) {
+        const double a = static_cast<double>(v1[i]);
+        const double b = static_cast<double>(v2[i]);
+
+        const bool bothZero = (a == 0) && (b == 0);
+        const bool anyZero = (a == 0) || (b == 0);
+
+        const double devAbs = bothZero ? -1.0 : std::abs(a - b);
+        const double scale = anyZero ? 1.0 : std::max(std::abs(a), std::abs(b));
+        const double devRel = devAbs / scale;
+
+        count += static_cast<std::size_t>((devAbs > absTol) && (anyZero || (devRel > relTol)));
+    }
+
+    return count;
+}
+
+/*! \brief Largest absolute and relative deviation in a collection.
+ */
+inline Deviation maxDeviation(const std::vector<Deviation>& deviations)
+{
+    double maxAbs = -1;
+    double maxRel = -1;
+
+#pragma omp simd reduction(max:maxAbs, maxRel)
+    for (std::size_t i = 0; i < deviations.size(); ++i) {
+        maxAbs = std::max(maxAbs, deviations[i].abs);
+        maxRel = std::max(maxRel, deviations[i].rel);
+    }
+
+    return { maxAbs, maxRel };
+}
+
 #endif
@@ -34,14 +34,21 @@
 #include <opm/common/utility/numeric/cmp.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstddef>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <set>
+#include <type_traits>
 #include <typeinfo>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 // helper macro to handle error throws or not
@@ -76,6 +83,84 @@ std::vector<T> sorted(std::vector<T> v) {
     return v;
 }
 
+std::size_t elementBytes(const Opm::EclIO::eclArrType type)
+{
+    return ((type == Opm::EclIO::DOUB) || (type == Opm::EclIO::CHAR)) ? 8 : 4;
+}
+
+std::size_t dataBytes(const std::vector<Opm::EclIO::EclFile::EclEntry>& arrays)
+{
+    std::size_t bytes = 0;
+    for (const auto& [name, type, size] : arrays) {
+        bytes += size * elementBytes(type);
+    }
+
+    return bytes;
+}
+
+// Sizes in bytes of the named arrays.
+std::vector<std::size_t>
+dataBytes(const std::vector<std::string>& keywords,
+          const std::vector<Opm::EclIO::EclFile::EclEntry>& arrays)
+{
+    std::map<std::string, std::size_t> arrayBytes;
+    for (const auto& [name, type, size] : arrays) {
+        arrayBytes[name] = std::max(arrayBytes[name], size * elementBytes(type));
+    }
+
+    std::vector<std::size_t> bytes;
+    for (const auto& keyword : keywords) {
+        const auto it = arrayBytes.find(keyword);
+        bytes.push_back((it == arrayBytes.end()) ? std::size_t{0} : it->second);
+    }
+
+    return bytes;
+}
+
+// Splits items into consecutive batches [begin, end) whose combined size
+// does not exceed maxBytes.  A batch holds at least one item.
+std::vector<std::pair<std::size_t, std::size_t>>
+makeBatches(const std::vector<std::size_t>& itemBytes, const std::size_t maxBytes)
+{
+    std::vector<std::pair<std::size_t, std::size_t>> batches;
+    std::size_t begin = 0;
+    std::size_t bytes = 0;
+
+    for (std::size_t i = 0; i < itemBytes.size(); ++i) {
+        if ((i > begin) && (bytes + itemBytes[i] > maxBytes)) {
+            batches.emplace_back(begin, i);
+            begin = i;
+            bytes = 0;
+        }
+
+        bytes += itemBytes[i];
+    }
+
+    if (begin < itemBytes.size()) {
+        batches.emplace_back(begin, itemBytes.size());
+    }
+
+    return batches;
+}
+
+// Indices of the arrays returned by EclFile::get<T>(name), i.e., the
+// last array of each name.
+std::vector<int> arrayIndices(const Opm::EclIO::EclFile& file,
+                              const std::vector<std::string>& names)
+{
+    const auto& allNames = file.arrayNames();
+
+    std::vector<int> indices;
+    for (const auto& name : names) {
+        const auto it = std::find(allNames.rbegin(), allNames.rend(), name);
+        if (it != allNames.rend()) {
+            indices.push_back(static_cast<int>(std::distance(it, allNames.rend())) - 1);
+        }
+    }
+
+    return indices;
+}
+
 }
 
 using namespace Opm::EclIO;
@@ -137,6 +222,17 @@ void ECLRegressionTest::compareFloatingPointVectors(const std::vector<T>& t1, co
     it = std::ranges::find(keywordsStrictTol, keyword);
     bool strictTol = it != keywordsStrictTol.end() ? true : false;
 
+    if (allowNegatives) {
+        const double absToleranceLoc = strictTol ? strictAbsTol : getAbsTolerance();
+        const double relToleranceLoc = strictTol ? strictAbsTol : getRelTolerance();
+
+        if (countToleranceViolations(t1.data(), t2.data(), t1.size(),
+                                     absToleranceLoc, relToleranceLoc) == 0)
+        {
+            return;
+        }
+    }
+
     for (size_t i = 0; i < t1.size(); i++) {
         deviationsForCell(static_cast<double>(t1[i]),
                           static_cast<double>(t2[i]),
@@ -175,6 +271,102 @@ void ECLRegressionTest::compareVectors(const std::vector<T>& t1, const std::vect
 }
 
 
+template <typename T>
+ECLRegressionTest::Screening
+ECLRegressionTest::screenVectors(const std::vector<T>& t1, const std::vector<T>& t2,
+                                 const std::string& keyword) const
+{
+    if (t1.size() != t2.size()) {
+        return Screening::Fail;
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::ranges::find(keywordDisallowNegatives, keyword) != keywordDisallowNegatives.end()) {
+            return Screening::Unknown;
+        }
+
+        const bool strictTol = std::ranges::find(keywordsStrictTol, keyword) != keywordsStrictTol.end();
+        const double absToleranceLoc = strictTol ? strictAbsTol : getAbsTolerance();
+        const double relToleranceLoc = strictTol ? strictAbsTol : getRelTolerance();
+
+        return (countToleranceViolations(t1.data(), t2.data(), t1.size(),
+                                         absToleranceLoc, relToleranceLoc) == 0)
+            ? Screening::Pass : Screening::Fail;
+    }
+    else {
+        return std::ranges::equal(t1, t2) ? Screening::Pass : Screening::Fail;
+    }
+}
+
+
+template <typename Get1, typename Get2>
+ECLRegressionTest::Screening
+ECLRegressionTest::screenArrays(const eclArrType type, const std::string& keyword,
+                                Get1&& get1, Get2&& get2) const
+{
+    switch (type) {
+    case INTE: return screenVectors(get1(int{}), get2(int{}), keyword);
+    case REAL: return screenVectors(get1(float{}), get2(float{}), keyword);
+    case DOUB: return screenVectors(get1(double{}), get2(double{}), keyword);
+    case LOGI: return screenVectors(get1(bool{}), get2(bool{}), keyword);
+    case CHAR: return screenVectors(get1(std::string{}), get2(std::string{}), keyword);
+    default:   return Screening::Unknown;
+    }
+}
+
+
+std::vector<ECLRegressionTest::Screening>
+ECLRegressionTest::runScreening(const std::vector<std::function<Screening()>>& jobs) const
+{
+    std::vector<Screening> result(jobs.size(), Screening::Unknown);
+    std::atomic<bool> failed{false};
+
+    const bool stopOnFailure = earlyExit && !analysis;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int job = 0; job < static_cast<int>(jobs.size()); ++job) {
+        if (stopOnFailure && failed.load(std::memory_order_relaxed)) {
+            continue;
+        }
+
+        try {
+            result[job] = jobs[job]();
+        }
+        catch (...) {
+            // Left to the detailed comparison to report.
+            result[job] = Screening::Unknown;
+        }
+
+        if (result[job] == Screening::Fail) {
+            failed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    return result;
+}
+
+
+bool ECLRegressionTest::passedScreening(const ScreeningResults& screened,
+                                        const std::string& keyword,
+                                        const std::string& reference) const
+{
+    const auto it = screened.find(keyword);
+    if (it == screened.end()) {
+        return false;
+    }
+
+    if ((it->second == Screening::Fail) && earlyExit && !analysis) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("\nDeviations exceed tolerances for {} - {}",
+                              keyword, reference));
+    }
+
+    return it->second == Screening::Pass;
+}
+
+
 template <typename T>
 void ECLRegressionTest::deviationsForNonFloatingPoints(T val1, T val2, const std::string& keyword, const std::string& reference, size_t kw_size, size_t cell)
 {
@@ -234,14 +426,6 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
                                      dev.rel, relToleranceLoc));
         }
     }
-
-    if (dev.abs != -1) {
-        absDeviation.push_back(dev.abs);
-    }
-
-    if (dev.rel != -1) {
-        relDeviation.push_back(dev.rel);
-    }
 }
 
 
@@ -254,14 +438,9 @@ void ECLRegressionTest::printDeviationReport()
             std::cout << "\t" << iter.first << std::endl;
             std::cout << "\t\tFails for " << iter.second.size() << " entries" << std::endl;
             std::cout.precision(7);
-            const double absErr =
-                std::ranges::max_element(iter.second,
-                                         [](const Deviation& a, const Deviation& b)
-                                        { return a.abs < b.abs;})->abs;
-            const double relErr =
-                std::ranges::max_element(iter.second,
-                                         [](const Deviation& a, const Deviation& b)
-                                         { return a.rel < b.rel; })->rel;
+            const Deviation maxErr = maxDeviation(iter.second);
+            const double absErr = maxErr.abs;
+            const double relErr = maxErr.rel;
             std::cout << "\t\tLargest absolute error: "
                       <<  std::scientific << absErr << std::endl;
             std::cout << "\t\tLargest relative error: "
@@ -481,18 +660,69 @@ void ECLRegressionTest::gridCompare()
 
         std::cout << "X, Y and Z coordinates " << " ... ";
 
-        std::array<double,8> X1 = {0.0};
-        std::array<double,8> Y1 = {0.0};
-        std::array<double,8> Z1 = {0.0};
+        // Layers are compared concurrently.  Each layer records its first
+        // failing cell and, in analysis mode, all of its deviations.  The
+        // results are then reported in the same order as a serial sweep.
+        struct LayerResult
+        {
+            std::array<int, 3> firstFailure{};
+            char failedAxis = '\0';
+            std::vector<Deviation> devX{}, devY{}, devZ{};
+        };
+
+        const int nx = dim1[0];
+        const int ny = dim1[1];
+        const int nz = dim1[2];
+
+        std::vector<LayerResult> layers(std::max(nz, 0));
+        std::atomic<int> firstFailedLayer{nz};
+        std::exception_ptr exception;
+
+        {
+            // Load grid data before concurrent access.
+            std::array<double,8> X = {0.0};
+            std::array<double,8> Y = {0.0};
+            std::array<double,8> Z = {0.0};
+
+            if (nx > 0 && ny > 0 && nz > 0) {
+                grid1->getCellCorners({0,0,0}, X, Y, Z);
+                grid2->getCellCorners({0,0,0}, X, Y, Z);
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int k = 0; k < nz; k++) {
+            if (!analysis && (k > firstFailedLayer.load(std::memory_order_relaxed))) {
+                continue;
+            }
 
-        std::array<double,8> X2 = {0.0};
-        std::array<double,8> Y2 = {0.0};
-        std::array<double,8> Z2 = {0.0};
+            auto& layer = layers[k];
+
+            std::array<double,8> X1 = {0.0};
+            std::array<double,8> Y1 = {0.0};
+            std::array<double,8> Z1 = {0.0};
+
+            std::array<double,8> X2 = {0.0};
+            std::array<double,8> Y2 = {0.0};
+            std::array<double,8> Z2 = {0.0};
+
+            auto recordFailure = [&layer](const char axis, const int i, const int j, const int kk)
+            {
+                if (layer.failedAxis == '\0') {
+                    layer.failedAxis = axis;
+                    layer.firstFailure = {i, j, kk};
+                }
+            };
+
+            try {
+                for (int j = 0; (j < ny) && (analysis || (layer.failedAxis == '\0')); j++) {
+                    for (int i = 0; (i < nx) && (analysis || (layer.failedAxis == '\0')); i++) {
+                        if (grid1->active_index(i,j,k) < 0) {
+                            continue;
+                        }
 
-        for (int k = 0; k < dim1[2]; k++) {
-            for (int j = 0; j < dim1[1]; j++) {
-                for (int i = 0; i < dim1[0]; i++) {
-                    if (grid1->active_index(i,j,k) > -1) {
                         grid1->getCellCorners({i,j,k}, X1, Y1, Z1);
                         grid2->getCellCorners({i,j,k}, X2, Y2, Z2);
 
@@ -503,40 +733,66 @@ void ECLRegressionTest::gridCompare()
 
                             if (devX.abs > strictAbsTol) {
                                 if (analysis) {
-                                    deviations["xcoordinate"].push_back(devX);
+                                    layer.devX.push_back(devX);
                                 } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different X coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
+                                    recordFailure('X', i, j, k);
                                 }
                             }
 
                             if (devY.abs > strictAbsTol) {
                                 if (analysis) {
-                                    deviations["ycoordinate"].push_back(devY);
+                                    layer.devY.push_back(devY);
                                 } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different Y coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
+                                    recordFailure('Y', i, j, k);
                                 }
                             }
 
                             if (devZ.abs > strictAbsTol) {
                                 if (analysis) {
-                                    deviations["zcoordinate"].push_back(devZ);
+                                    layer.devZ.push_back(devZ);
                                 } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different Z coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
+                                    recordFailure('Z', i, j, k);
                                 }
                             }
                         }
                     }
                 }
             }
+            catch (...) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                exception = std::current_exception();
+            }
+
+            if (layer.failedAxis != '\0') {
+                int current = firstFailedLayer.load();
+                while ((k < current) && !firstFailedLayer.compare_exchange_weak(current, k)) {}
+            }
+        }
+
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+
+        for (const auto& layer : layers) {
+            if (analysis) {
+                for (const auto& [key, devs] : { std::pair{"xcoordinate", &layer.devX},
+                                                 std::pair{"ycoordinate", &layer.devY},
+                                                 std::pair{"zcoordinate", &layer.devZ} })
+                {
+                    if (!devs->empty()) {
+                        auto& all = deviations[key];
+                        all.insert(all.end(), devs->begin(), devs->end());
+                    }
+                }
+            } else if (layer.failedAxis != '\0') {
+                const auto& [i, j, k] = layer.firstFailure;
+                OPM_THROW(std::runtime_error,
+                          fmt::format("\nGrid1 and grid2 have different {} coordinates. "
+                                      "First difference found for cell i={} j={} k={}",
+                                      layer.failedAxis, i+1, j+1, k+1));
+            }
         }
 
         std::cout << " done." << std::endl;
@@ -618,9 +874,6 @@ void ECLRegressionTest::results_init()
 
         deviations.clear();
 
-        init1.loadData();
-        init2.loadData();
-
         auto arrayList1 = init1.getList();
         auto arrayList2 = init2.getList();
 
@@ -672,57 +925,104 @@ void ECLRegressionTest::results_init()
                 checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
             }
 
-            for (size_t i = 0; i < keywords1.size(); i++) {
-                const auto it1 = std::ranges::find(keywords2, keywords1[i]);
-                if (it1 == keywords2.end() && acceptExtraKeywordsBoth) {
-                    continue;
+            // Arrays are streamed in batches of bounded size.  Each batch is
+            // screened concurrently, and only the arrays which do not pass
+            // are compared element by element, in file order.
+            for (const auto& [begin, end] : makeBatches(dataBytes(keywords1, arrayList1), streamBatchSize)) {
+                const std::vector<std::string> batch(keywords1.begin() + begin, keywords1.begin() + end);
+
+                const auto arrIndex1 = arrayIndices(init1, batch);
+                const auto arrIndex2 = arrayIndices(init2, batch);
+
+                init1.loadData(arrIndex1);
+                init2.loadData(arrIndex2);
+
+                std::vector<std::string> screenedKeywords;
+                std::vector<std::function<Screening()>> jobs;
+
+                for (size_t i = begin; i < end; i++) {
+                    const auto it2 = std::ranges::find(keywords2, keywords1[i]);
+                    if ((it2 == keywords2.end()) ||
+                        (arrayType1[i] != arrayType2[std::distance(keywords2.begin(), it2)]) ||
+                        (std::ranges::find(keywordsBlackList, keywords1[i]) != keywordsBlackList.end()))
+                    {
+                        continue;
+                    }
+
+                    screenedKeywords.push_back(keywords1[i]);
+                    jobs.emplace_back([this, &init1, &init2, kw = keywords1[i], type = arrayType1[i]]()
+                    {
+                        return screenArrays(type, kw,
+                                            [&init1, &kw](auto tag) -> decltype(auto)
+                                            { return init1.get<decltype(tag)>(kw); },
+                                            [&init2, &kw](auto tag) -> decltype(auto)
+                                            { return init2.get<decltype(tag)>(kw); });
+                    });
                 }
-                int ind2 = std::distance(keywords2.begin(),it1);
 
-                if (arrayType1[i] != arrayType2[ind2]) {
-                    printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
-                    OPM_THROW(std::runtime_error,
-                              fmt::format("\nArray with same name '{}', "
-                                          "but of different type. Init file",
-                                          keywords1[i]));
+                ScreeningResults screened;
+                const auto results = runScreening(jobs);
+                for (size_t job = 0; job < jobs.size(); job++) {
+                    screened.emplace(screenedKeywords[job], results[job]);
                 }
 
-                const auto it = std::ranges::find(keywordsBlackList, keywords1[i]);
+                for (size_t i = begin; i < end; i++) {
+                    const auto it1 = std::ranges::find(keywords2, keywords1[i]);
+                    if (it1 == keywords2.end() && acceptExtraKeywordsBoth) {
+                        continue;
+                    }
+                    int ind2 = std::distance(keywords2.begin(),it1);
+
+                    if (arrayType1[i] != arrayType2[ind2]) {
+                        printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
+                        OPM_THROW(std::runtime_error,
+                                  fmt::format("\nArray with same name '{}', "
+                                              "but of different type. Init file",
+                                              keywords1[i]));
+                    }
 
-                if (it != keywordsBlackList.end()){
-                    std::cout << "Skipping  " << keywords1[i] << std::endl;
-                } else {
-                    std::cout << "Comparing " << keywords1[i] << " ... ";
-
-                    if (arrayType1[i] == INTE) {
-                        auto vect1 = init1.get<int>(keywords1[i]);
-                        auto vect2 = init2.get<int>(keywords2[ind2]);
-                        compareVectors(vect1, vect2, keywords1[i],reference);
-                    } else if (arrayType1[i] == REAL) {
-                        auto vect1 = init1.get<float>(keywords1[i]);
-                        auto vect2 = init2.get<float>(keywords2[ind2]);
-                        compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                    } else if (arrayType1[i] == DOUB) {
-                        auto vect1 = init1.get<double>(keywords1[i]);
-                        auto vect2 = init2.get<double>(keywords2[ind2]);
-                        compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                    } else if (arrayType1[i] == LOGI) {
-                        auto vect1 = init1.get<bool>(keywords1[i]);
-                        auto vect2 = init2.get<bool>(keywords2[ind2]);
-                        compareVectors(vect1, vect2, keywords1[i], reference);
-                    } else if (arrayType1[i] == CHAR) {
-                        auto vect1 = init1.get<std::string>(keywords1[i]);
-                        auto vect2 = init2.get<std::string>(keywords2[ind2]);
-                        compareVectors(vect1, vect2, keywords1[i], reference);
-                    } else if (arrayType1[i] == MESS) {
-                        // shold not be any associated data
+                    const auto it = std::ranges::find(keywordsBlackList, keywords1[i]);
+
+                    if (it != keywordsBlackList.end()){
+                        std::cout << "Skipping  " << keywords1[i] << std::endl;
                     } else {
-                        std::cout << "unknown array type " << std::endl;
-                        exit(1);
-                    }
+                        std::cout << "Comparing " << keywords1[i] << " ... ";
 
-                    std::cout << " done." << std::endl;
+                        if (passedScreening(screened, keywords1[i], reference)) {
+                            // Equal within tolerances
+                        } else if (arrayType1[i] == INTE) {
+                            const auto& vect1 = init1.get<int>(keywords1[i]);
+                            const auto& vect2 = init2.get<int>(keywords2[ind2]);
+                            compareVectors(vect1, vect2, keywords1[i],reference);
+                        } else if (arrayType1[i] == REAL) {
+                            const auto& vect1 = init1.get<float>(keywords1[i]);
+                            const auto& vect2 = init2.get<float>(keywords2[ind2]);
+                            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+                        } else if (arrayType1[i] == DOUB) {
+                            const auto& vect1 = init1.get<double>(keywords1[i]);
+                            const auto& vect2 = init2.get<double>(keywords2[ind2]);
+                            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+                        } else if (arrayType1[i] == LOGI) {
+                            const auto& vect1 = init1.get<bool>(keywords1[i]);
+                            const auto& vect2 = init2.get<bool>(keywords2[ind2]);
+                            compareVectors(vect1, vect2, keywords1[i], reference);
+                        } else if (arrayType1[i] == CHAR) {
+                            const auto& vect1 = init1.get<std::string>(keywords1[i]);
+                            const auto& vect2 = init2.get<std::string>(keywords2[ind2]);
+                            compareVectors(vect1, vect2, keywords1[i], reference);
+                        } else if (arrayType1[i] == MESS) {
+                            // shold not be any associated data
+                        } else {
+                            std::cout << "unknown array type " << std::endl;
+                            exit(1);
+                        }
+
+                        std::cout << " done." << std::endl;
+                    }
                 }
+
+                init1.unloadData(arrIndex1);
+                init2.unloadData(arrIndex2);
             }
 
             if (!deviations.empty()) {
@@ -812,129 +1112,188 @@ void ECLRegressionTest::results_rst()
             OPM_THROW(std::runtime_error, "\nRestart files not having the same report steps: ");
         }
 
-        for (int& seqn : seqnums1) {
-            std::cout << "\nUnified restart files, sequence  " << std::to_string(seqn) << "\n" << std::endl;
-
-            std::string reference = "Restart, sequence "+std::to_string(seqn);
+        std::vector<std::size_t> stepBytes;
+        for (const int seqn : seqnums1) {
+            stepBytes.push_back(dataBytes(rst1->listOfRstArrays(seqn)));
+        }
 
-            rst1->loadReportStepNumber(seqn);
-            rst2->loadReportStepNumber(seqn);
+        // Report steps are streamed in batches of bounded size.  All arrays
+        // of a batch are screened concurrently, and only the arrays which do
+        // not pass are compared element by element, in file order.
+        for (const auto& [stepBegin, stepEnd] : makeBatches(stepBytes, streamBatchSize)) {
+            std::vector<ScreeningResults> screened(stepEnd - stepBegin);
+            std::vector<std::pair<std::size_t, std::string>> screenedKeywords;
+            std::vector<std::function<Screening()>> jobs;
 
-            auto arrays1 = rst1->listOfRstArrays(seqn);
-            auto arrays2 = rst2->listOfRstArrays(seqn);
+            for (size_t step = stepBegin; step < stepEnd; step++) {
+                const int seqn = seqnums1[step];
 
-            std::vector<std::string> keywords1;
-            std::vector<eclArrType> arrayType1;
-            for (const auto& array : arrays1) {
-                keywords1.push_back(std::get<0>(array));
-                arrayType1.push_back(std::get<1>(array));
-            }
+                rst1->loadReportStepNumber(seqn);
+                rst2->loadReportStepNumber(seqn);
 
-            std::vector<std::string> keywords2;
-            std::vector<eclArrType> arrayType2;
+                const auto arrays2 = rst2->listOfRstArrays(seqn);
+                std::unordered_set<std::string> added;
 
-            for (const auto& array : arrays2) {
-                keywords2.push_back(std::get<0>(array));
-                arrayType2.push_back(std::get<1>(array));
-            }
+                for (const auto& [name, type, size] : rst1->listOfRstArrays(seqn)) {
+                    if ((integrationTest && (name != "PRESSURE") && (name != "SWAT") && (name != "SGAS")) ||
+                        (!specificKeyword.empty() && (name != specificKeyword)) ||
+                        (std::ranges::find(keywordsBlackList, name) != keywordsBlackList.end()) ||
+                        (name == "DOUBHEAD") || !added.insert(name).second)
+                    {
+                        continue;
+                    }
 
-            if (integrationTest) {
-                std::vector<std::string> keywords;
+                    const auto it2 = std::ranges::find_if(arrays2, [&name = name](const auto& array)
+                                                          { return std::get<0>(array) == name; });
+                    if ((it2 == arrays2.end()) || (std::get<1>(*it2) != type)) {
+                        continue;
+                    }
 
-                for (size_t i = 0; i < keywords1.size(); i++) {
-                    if (keywords1[i] == "PRESSURE" ||
-                        keywords1[i] == "SWAT" ||
-                        keywords1[i] =="SGAS")
+                    screenedKeywords.emplace_back(step - stepBegin, name);
+                    jobs.emplace_back([this, rst1, rst2, seqn, kw = name, type = type]()
                     {
-                        const auto search2 = std::ranges::find(keywords2, keywords1[i]);
-                        if (search2 != keywords2.end()) {
-                            keywords.push_back(keywords1[i]);
-                        }
-                        else if (acceptExtraKeywordsBoth) {
-                            continue;
-                        }
-                    }
+                        return screenArrays(type, kw,
+                                            [&rst1, &kw, seqn](auto tag) -> decltype(auto)
+                                            { return rst1->getRestartData<decltype(tag)>(kw, seqn, 0); },
+                                            [&rst2, &kw, seqn](auto tag) -> decltype(auto)
+                                            { return rst2->getRestartData<decltype(tag)>(kw, seqn, 0); });
+                    });
                 }
+            }
 
-                keywords1 = keywords2 = keywords;
-
-                int nKeys = keywords.size();
-                arrayType1.assign(nKeys, REAL);
-                arrayType2.assign(nKeys, REAL);
+            const auto results = runScreening(jobs);
+            for (size_t job = 0; job < jobs.size(); job++) {
+                screened[screenedKeywords[job].first].emplace(screenedKeywords[job].second, results[job]);
             }
 
-            if (printKeywordOnly) {
-                printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
-            } else {
-                if (specificKeyword.empty()) {
-                    compareKeywords(keywords1, keywords2, reference);
-                } else {
-                    checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
+            for (size_t step = stepBegin; step < stepEnd; step++) {
+                const int seqn = seqnums1[step];
+
+                std::cout << "\nUnified restart files, sequence  " << std::to_string(seqn) << "\n" << std::endl;
+
+                std::string reference = "Restart, sequence "+std::to_string(seqn);
+
+                auto arrays1 = rst1->listOfRstArrays(seqn);
+                auto arrays2 = rst2->listOfRstArrays(seqn);
+
+                std::vector<std::string> keywords1;
+                std::vector<eclArrType> arrayType1;
+                for (const auto& array : arrays1) {
+                    keywords1.push_back(std::get<0>(array));
+                    arrayType1.push_back(std::get<1>(array));
                 }
 
-                for (size_t i = 0; i < keywords1.size(); i++) {
-                    //if (keywords.count(keywords1[i]) == 0)
-                    //    continue;
+                std::vector<std::string> keywords2;
+                std::vector<eclArrType> arrayType2;
 
-                    const auto it1 = std::ranges::find(keywords2, keywords1[i]);
-                    if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
-                        continue;
-                    }
-                    int ind2 = std::distance(keywords2.begin(), it1);
+                for (const auto& array : arrays2) {
+                    keywords2.push_back(std::get<0>(array));
+                    arrayType2.push_back(std::get<1>(array));
+                }
 
-                    if (arrayType1[i] != arrayType2[ind2]) {
-                        printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
-                        OPM_THROW(std::runtime_error,
-                                  fmt::format("\nArray with same name '{}', "
-                                              "but of different type. "
-                                              "Restart file sequence {}",
-                                              keywords1[i], seqn));
+                if (integrationTest) {
+                    std::vector<std::string> keywords;
+
+                    for (size_t i = 0; i < keywords1.size(); i++) {
+                        if (keywords1[i] == "PRESSURE" ||
+                            keywords1[i] == "SWAT" ||
+                            keywords1[i] =="SGAS")
+                        {
+                            const auto search2 = std::ranges::find(keywords2, keywords1[i]);
+                            if (search2 != keywords2.end()) {
+                                keywords.push_back(keywords1[i]);
+                            }
+                            else if (acceptExtraKeywordsBoth) {
+                                continue;
+                            }
+                        }
                     }
 
-                    const auto it = std::ranges::find(keywordsBlackList, keywords1[i]);
+                    keywords1 = keywords2 = keywords;
 
-                    if (it != keywordsBlackList.end()){
-                        std::cout << "Skipping  " << keywords1[i] << std::endl;
+                    int nKeys = keywords.size();
+                    arrayType1.assign(nKeys, REAL);
+                    arrayType2.assign(nKeys, REAL);
+                }
+
+                if (printKeywordOnly) {
+                    printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
+                } else {
+                    if (specificKeyword.empty()) {
+                        compareKeywords(keywords1, keywords2, reference);
                     } else {
+                        checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
+                    }
 
-                        std::cout << "Comparing " << keywords1[i] << " ... ";
+                    for (size_t i = 0; i < keywords1.size(); i++) {
+                        //if (keywords.count(keywords1[i]) == 0)
+                        //    continue;
 
-                        if (arrayType1[i] == INTE) {
-                            auto vect1 = rst1->getRestartData<int>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<int>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == REAL) {
-                            auto vect1 = rst1->getRestartData<float>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<float>(keywords2[ind2], seqn, 0);
-                            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == DOUB) {
-                            auto vect1 = rst1->getRestartData<double>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<double>(keywords2[ind2], seqn, 0);
+                        const auto it1 = std::ranges::find(keywords2, keywords1[i]);
+                        if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
+                            continue;
+                        }
+                        int ind2 = std::distance(keywords2.begin(), it1);
+
+                        if (arrayType1[i] != arrayType2[ind2]) {
+                            printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
+                            OPM_THROW(std::runtime_error,
+                                      fmt::format("\nArray with same name '{}', "
+                                                  "but of different type. "
+                                                  "Restart file sequence {}",
+                                                  keywords1[i], seqn));
+                        }
 
-                            // hack in order to not test doubhead[1], dependent on simulation results
-                            // All ohter items in DOUBHEAD are tested with strict tolerances
-                            if (keywords1[i]=="DOUBHEAD"){
-                                vect2[1] = vect1[1];
-                            }
-                            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == LOGI) {
-                            auto vect1 = rst1->getRestartData<bool>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<bool>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == CHAR) {
-                            auto vect1 = rst1->getRestartData<std::string>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<std::string>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == MESS) {
-                            // shold not be any associated data
+                        const auto it = std::ranges::find(keywordsBlackList, keywords1[i]);
+
+                        if (it != keywordsBlackList.end()){
+                            std::cout << "Skipping  " << keywords1[i] << std::endl;
                         } else {
-                            std::cout << "unknown array type " << std::endl;
-                            exit(1);
-                        }
 
-                        std::cout << " done." << std::endl;
+                            std::cout << "Comparing " << keywords1[i] << " ... ";
+
+                            if (passedScreening(screened[step - stepBegin], keywords1[i], reference)) {
+                                // Equal within tolerances
+                            } else if (arrayType1[i] == INTE) {
+                                const auto& vect1 = rst1->getRestartData<int>(keywords1[i], seqn, 0);
+                                const auto& vect2 = rst2->getRestartData<int>(keywords2[ind2], seqn, 0);
+                                compareVectors(vect1, vect2, keywords1[i], reference);
+                            } else if (arrayType1[i] == REAL) {
+                                const auto& vect1 = rst1->getRestartData<float>(keywords1[i], seqn, 0);
+                                const auto& vect2 = rst2->getRestartData<float>(keywords2[ind2], seqn, 0);
+                                compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+                            } else if (arrayType1[i] == DOUB) {
+                                auto vect1 = rst1->getRestartData<double>(keywords1[i], seqn, 0);
+                                auto vect2 = rst2->getRestartData<double>(keywords2[ind2], seqn, 0);
+
+                                // hack in order to not test doubhead[1], dependent on simulation results
+                                // All ohter items in DOUBHEAD are tested with strict tolerances
+                                if (keywords1[i]=="DOUBHEAD"){
+                                    vect2[1] = vect1[1];
+                                }
+                                compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+                            } else if (arrayType1[i] == LOGI) {
+                                const auto& vect1 = rst1->getRestartData<bool>(keywords1[i], seqn, 0);
+                                const auto& vect2 = rst2->getRestartData<bool>(keywords2[ind2], seqn, 0);
+                                compareVectors(vect1, vect2, keywords1[i], reference);
+                            } else if (arrayType1[i] == CHAR) {
+                                const auto& vect1 = rst1->getRestartData<std::string>(keywords1[i], seqn, 0);
+                                const auto& vect2 = rst2->getRestartData<std::string>(keywords2[ind2], seqn, 0);
+                                compareVectors(vect1, vect2, keywords1[i], reference);
+                            } else if (arrayType1[i] == MESS) {
+                                // shold not be any associated data
+                            } else {
+                                std::cout << "unknown array type " << std::endl;
+                                exit(1);
+                            }
+
+                            std::cout << " done." << std::endl;
+                        }
                     }
                 }
+
+                rst1->unloadReportStepNumber(seqn);
+                rst2->unloadReportStepNumber(seqn);
             }
         }
 
@@ -1052,6 +1411,33 @@ void ECLRegressionTest::results_smry()
 
             std::cout << "\nChecking " << keywords1.size() << "  vectors  ... ";
 
+            // Screen all vectors concurrently.  Only vectors which do not
+            // pass are compared element by element, in keyword order.
+            ScreeningResults screened;
+            {
+                std::vector<std::string> screenedKeywords;
+                std::vector<std::function<Screening()>> jobs;
+
+                for (const auto& kw : keywords1) {
+                    if (std::ranges::find(keywords2, kw) == keywords2.end()) {
+                        continue;
+                    }
+
+                    screenedKeywords.push_back(kw);
+                    jobs.emplace_back([this, &smry1, &smry2, &kw]()
+                    {
+                        return reportStepOnly
+                            ? screenVectors(smry1.get_at_rstep(kw), smry2.get_at_rstep(kw), kw)
+                            : screenVectors(smry1.get(kw), smry2.get(kw), kw);
+                    });
+                }
+
+                const auto results = runScreening(jobs);
+                for (size_t job = 0; job < jobs.size(); job++) {
+                    screened.emplace(screenedKeywords[job], results[job]);
+                }
+            }
+
             for (size_t i = 0; i < keywords1.size(); i++) {
                 const auto it1 = std::ranges::find(keywords2, keywords1[i]);
                 if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
@@ -1059,6 +1445,10 @@ void ECLRegressionTest::results_smry()
                     continue;
                 }
 
+                if (passedScreening(screened, keywords1[i], reference)) {
+                    continue;
+                }
+
                 std::vector<float> vect1;
                 std::vector<float> vect2;
 
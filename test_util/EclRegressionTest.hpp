@@ -24,6 +24,12 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
 namespace Opm { namespace EclIO {
     class EGrid;
 }}
@@ -95,6 +101,18 @@ public:
         this->loadBaseRunData = loadArg;
     }
 
+    //! \brief Stop at the first array which deviates, without reporting
+    //!        individual cells.  For when only pass/fail matters.
+    void setEarlyExit(bool earlyExitArg) {
+        this->earlyExit = earlyExitArg;
+    }
+
+    //! \brief Upper bound, in bytes, on the array data loaded from each
+    //!        INIT or UNRST file at any one time.
+    void setStreamBatchSize(std::size_t bytes) {
+        this->streamBatchSize = bytes;
+    }
+
     void loadGrids();
     void printDeviationReport();
 
@@ -107,9 +125,17 @@ public:
     void results_rft();
 
 private:
+    // Outcome of the fast, concurrent pre-screening of an array pair.
+    // Arrays which pass need no element-by-element comparison.
+    enum class Screening : char { Unknown, Pass, Fail };
+
+    using ScreeningResults = std::map<std::string, Screening>;
+
     bool checkFileName(const std::string& rootName, const std::string& extension, std::string& filename);
 
-    // Prints results stored in absDeviation and relDeviation.
+    // Prints the deviations recorded for a keyword.  Arrays in which
+    // countToleranceViolations() finds no elements outside the tolerances
+    // are not checked cell by cell, so they record no deviations.
     void printResultsForKeyword(const std::string& keyword) const;
     void printComparisonForKeywordLists(const std::vector<std::string>& arrayList1,
                                         const std::vector<std::string>& arrayList2) const;
@@ -132,6 +158,27 @@ private:
                               std::vector<EIOD::eclArrType>& arrayType2,
                               const std::string& reference);
 
+    // Runs screening jobs concurrently, in a thread pool.  Remaining jobs
+    // are skipped after the first failure in early exit mode.
+    std::vector<Screening>
+    runScreening(const std::vector<std::function<Screening()>>& jobs) const;
+
+    // Whether or not the element-by-element comparison of an array may be
+    // skipped.  Throws on a failed array in early exit mode.
+    bool passedScreening(const ScreeningResults& screened,
+                         const std::string& keyword,
+                         const std::string& reference) const;
+
+    template <typename T>
+    Screening screenVectors(const std::vector<T>& t1, const std::vector<T>& t2,
+                            const std::string& keyword) const;
+
+    // Screens a pair of arrays of the given type.  The callables return
+    // the array of the element type of their (tag) argument.
+    template <typename Get1, typename Get2>
+    Screening screenArrays(EIOD::eclArrType type, const std::string& keyword,
+                           Get1&& get1, Get2&& get2) const;
+
     template <typename T>
     void compareVectors(const std::vector<T>& t1, const std::vector<T>& t2,
                         const std::string& keyword, const std::string& reference);
@@ -143,7 +190,8 @@ private:
     // deviationsForCell throws an exception if both the absolute deviation AND the relative deviation
     // are larger than absTolerance and relTolerance, respectively. In addition,
     // if allowNegativeValues is passed as false, an exception will be thrown when the absolute value
-    // of a negative value exceeds absTolerance. If no exceptions are thrown, the absolute and relative deviations are added to absDeviation and relDeviation.
+    // of a negative value exceeds absTolerance. In analysis mode, deviations exceeding the tolerances are added to 'deviations' instead of throwing.
+    // Uses the same tolerance criterion as countToleranceViolations(), so arrays in which that finds no violations are not checked cell by cell.
     // void deviationsForCell(double val1, double val2, const std::string& keyword, const std::string reference, size_t kw_size, size_t cell, bool allowNegativeValues = true);
 
     void deviationsForCell(double val1, double val2, const std::string& keyword,
@@ -155,9 +203,6 @@ private:
                                         const std::string& reference,
                                         size_t kw_size, size_t cell);
 
-    // These vectors store absolute and relative deviations, respecively. Note that they are whiped clean for every new keyword comparison.
-    std::vector<double> absDeviation, relDeviation;
-
     // Keywords which should not contain negative values, i.e. uses allowNegativeValues = false in deviationsForCell():
     const std::vector<std::string> keywordDisallowNegatives = {};//{"SGAS", "SWAT", "PRESSURE"};
 
@@ -189,6 +234,12 @@ private:
     // specific restart sequence to be compared
     int specificSequence = -1;
 
+    // Stop at first deviating array
+    bool earlyExit = false;
+
+    // Maximum array data in memory per file when streaming INIT and UNRST
+    std::size_t streamBatchSize = std::size_t{512} << 20;
+
     // Accept extra keywords in the restart file of the 'new' simulation.
     bool acceptExtraKeywords = false;
     bool acceptExtraKeywordsBoth = false;
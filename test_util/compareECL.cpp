@@ -44,6 +44,7 @@ static void printHelp() {
               << "-l Only do comparison for the last Report Step. This option is only valid for restart files.\n"
               << "-n Do not throw on errors.\n"
               << "-p Print keywords in both cases and exit.\n"
+              << "-q Quick pass/fail check. Stop at the first array which deviates, without reporting individual cells.\n"
               << "-r compare a specific report time step number in a restart file.\n"
               << "-t Specify ECLIPSE filetype to compare, (default behaviour is that all files are compared if found). Different possible arguments are:\n"
               << "    -t UNRST \t Compare two unified restart files (.UNRST). This the default value, so it is the same as not passing option -t.\n"
@@ -91,12 +92,13 @@ int main(int argc, char** argv) {
     bool acceptExtraKeywords       = false;
     bool acceptExtraKeywordsBoth   = false;
     bool analysis                  = false;
+    bool earlyExit                 = false;
     char* keyword                  = nullptr;
     int c                          = 0;
     int reportStepNumber           = -1;
     std::string fileTypeString;
 
-    while ((c = getopt(argc, argv, "hik:alnpt:Rr:xdy")) != -1) {
+    while ((c = getopt(argc, argv, "hik:alnpqt:Rr:xdy")) != -1) {
         switch (c) {
         case 'a':
             analysis = true;
@@ -124,6 +126,9 @@ int main(int argc, char** argv) {
         case 'p':
             printKeywords = true;
             break;
+        case 'q':
+            earlyExit = true;
+            break;
         case 'r':
             specificReportStepNumber=true;
             reportStepNumber = atoi(optarg);
@@ -184,6 +189,7 @@ int main(int argc, char** argv) {
 
         comparator.throwOnErrors(throwOnError);
         comparator.doAnalysis(analysis);
+        comparator.setEarlyExit(earlyExit);
         comparator.setAcceptExtraKeywords(acceptExtraKeywords);
         comparator.setAcceptExtraKeywordsBoth(acceptExtraKeywordsBoth);
 
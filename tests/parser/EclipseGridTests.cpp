@@ -384,6 +384,35 @@ BOOST_AUTO_TEST_CASE(CREATE_SIMPLE) {
     BOOST_CHECK_EQUAL( grid.getCartesianSize() , 6000U );
 }
 
+BOOST_AUTO_TEST_CASE(BulkCellGeometry) {
+    const Opm::EclipseGrid grid( createCARTDeck() );
+
+    const auto nCells = grid.getCartesianSize();
+    std::vector<std::array<double,3>> center(nCells);
+    std::vector<double> volume(nCells), depth(nCells), thickness(nCells);
+
+    grid.cellGeometry({ center, volume, depth, thickness });
+
+    for (std::size_t g = 0; g < nCells; ++g) {
+        BOOST_CHECK_EQUAL( volume[g], grid.getCellVolume(g) );
+        BOOST_CHECK_EQUAL( depth[g], grid.getCellDepth(g) );
+        BOOST_CHECK_EQUAL( thickness[g], grid.getCellThickness(g) );
+        BOOST_CHECK( center[g] == grid.getCellCenter(g) );
+    }
+
+    const auto& active = grid.getActiveMap();
+    std::vector<double> activeVolume(active.size());
+    grid.cellGeometry(active, { .volume = activeVolume });
+
+    BOOST_CHECK( activeVolume == grid.activeVolume() );
+
+    std::vector<std::array<double,8>> X(2), Y(2), Z(2);
+    grid.getCellCorners(std::vector<int>{ 0, 999 }, X, Y, Z);
+    BOOST_CHECK( Z[1][7] == grid.getCornerPos(9, 9, 9, 7)[2] );
+
+    BOOST_CHECK_THROW( grid.cellGeometry(std::vector<int>{ 1000 }, { .volume = activeVolume }), std::invalid_argument );
+}
+
 BOOST_AUTO_TEST_CASE(DEPTHZ_EQUAL_TOPS) {
     Opm::Deck deck1 = createCARTDeck();
     Opm::Deck deck2 = createCARTDeckDEPTHZ();
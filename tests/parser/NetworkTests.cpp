@@ -503,6 +503,76 @@ GRUPNET
     BOOST_CHECK(p == network.roots()[0]);
 }
 
+BOOST_AUTO_TEST_CASE(Indexed_Topology)
+{
+    using Opm::Network::Branch;
+
+    auto network = Opm::Network::ExtNetwork{};
+    network.add_branch(Branch { "M5S", "PLAT-A", 3, 0.0 });
+    network.add_branch(Branch { "B1" , "M5S"   , 5, 0.0 });
+    network.add_branch(Branch { "M5N", "PLAT-A", 3, 0.0 });
+    network.add_branch(Branch { "C1" , "M5N"   , 4, 0.0 });
+    network.add_branch(Branch { "G1" , "M5S"   , 6, 0.0 });
+
+    const auto plat = network.node_id("PLAT-A");
+    const auto m5s = network.node_id("M5S");
+    const auto b1 = network.node_id("B1");
+
+    BOOST_CHECK_EQUAL(network.node_names()[m5s], "M5S");
+    BOOST_CHECK_THROW(network.node_id("NO_SUCH_NODE"), std::out_of_range);
+    BOOST_CHECK_THROW(network.downtree_branch_ids(network.node_names().size()), std::out_of_range);
+
+    {
+        const auto down = network.downtree_branch_ids(m5s);
+        BOOST_REQUIRE_EQUAL(down.size(), std::size_t{2});
+        BOOST_CHECK_EQUAL(network.branch(down[0]).downtree_node(), "B1");
+        BOOST_CHECK_EQUAL(network.branch(down[1]).downtree_node(), "G1");
+    }
+
+    BOOST_CHECK_MESSAGE(network.downtree_branch_ids(b1).empty(),
+                        "Leaf node B1 must not have any downtree branches");
+
+    BOOST_CHECK_MESSAGE(! network.uptree_branch_id(plat).has_value(),
+                        "Top node PLAT-A must not have an uptree branch");
+
+    {
+        const auto up = network.uptree_branch_id(b1);
+        BOOST_REQUIRE_MESSAGE(up.has_value(), "Node B1 must have an uptree branch");
+        BOOST_CHECK_EQUAL(network.branch(*up).uptree_node(), "M5S");
+    }
+
+    const auto& order = network.topological_order();
+    BOOST_REQUIRE_EQUAL(order.size(), network.node_names().size());
+    BOOST_CHECK_EQUAL(order.front(), plat);
+
+    auto position = std::vector<std::size_t>(order.size());
+    for (auto i = 0*order.size(); i < order.size(); ++i) {
+        position[order[i]] = i;
+    }
+
+    for (const auto* branch : network.branches()) {
+        BOOST_CHECK_MESSAGE(position[network.node_id(branch->uptree_node())] <
+                            position[network.node_id(branch->downtree_node())],
+                            "Uptree node " << branch->uptree_node()
+                            << " must precede downtree node "
+                            << branch->downtree_node());
+    }
+
+    const auto& reverse = network.reverse_topological_order();
+    BOOST_CHECK_EQUAL_COLLECTIONS(reverse.begin(), reverse.end(),
+                                  order.rbegin(), order.rend());
+
+    // Reconnecting a node updates the index.
+    network.add_or_replace_branch(Branch { "B1", "M5N", 5, 0.0 });
+    BOOST_CHECK_EQUAL(network.downtree_branch_ids(m5s).size(), std::size_t{1});
+    BOOST_CHECK_EQUAL(network.downtree_branch_ids(network.node_id("M5N")).size(), std::size_t{2});
+    BOOST_CHECK_EQUAL(network.branch(*network.uptree_branch_id(b1)).uptree_node(), "M5N");
+
+    network.drop_branch("M5N", "C1");
+    BOOST_CHECK_MESSAGE(! network.uptree_branch_id(network.node_id("C1")).has_value(),
+                        "Dropped node C1 must not have an uptree branch");
+}
+
 BOOST_AUTO_TEST_SUITE_END()     // Basic_Functionality
 
 // ===========================================================================
@@ -324,6 +324,37 @@ BOOST_AUTO_TEST_CASE(WildCardTest) {
 }
 
 
+BOOST_AUTO_TEST_CASE(BuiltinKeywordsOnDemand) {
+    Parser parser;
+
+    const auto size = parser.size();
+    const auto deckNames = parser.getAllDeckNames();
+
+    BOOST_CHECK(parser.hasKeyword("WCONHIST"));
+    BOOST_CHECK(parser.isRecognizedKeyword("WCONHIST"));
+    BOOST_CHECK(parser.isBaseRecognizedKeyword("WCONHIST"));
+    BOOST_CHECK(!parser.isRecognizedKeyword("WCONHISX"));
+
+    const auto& wconhist = parser.getKeyword("WCONHIST");
+    BOOST_CHECK_EQUAL(wconhist.getName(), "WCONHIST");
+    BOOST_CHECK_EQUAL(std::addressof(wconhist),
+                      std::addressof(parser.getParserKeywordFromDeckName("WCONHIST")));
+
+    // Instantiating a keyword does not change the set of known deck names.
+    BOOST_CHECK_EQUAL(parser.size(), size);
+    BOOST_CHECK(parser.getAllDeckNames() == deckNames);
+
+    // Keywords added later replace builtin keywords, whether or not the
+    // builtin keyword has already been used.
+    parser.addParserKeyword(createFixedSized("WCONPROD", 1));
+    BOOST_CHECK_EQUAL(parser.getKeyword("WCONPROD").getFixedSize(), 1U);
+
+    parser.addParserKeyword(createFixedSized("WCONHIST", 2));
+    BOOST_CHECK_EQUAL(parser.getKeyword("WCONHIST").getFixedSize(), 2U);
+
+    BOOST_CHECK_EQUAL(parser.size(), size);
+}
+
 BOOST_AUTO_TEST_CASE( quoted_comments ) {
     BOOST_CHECK_EQUAL( Parser::stripComments( "ABC" ) , "ABC");
     BOOST_CHECK_EQUAL( Parser::stripComments( "--ABC") , "");
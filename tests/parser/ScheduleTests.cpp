@@ -51,6 +51,7 @@
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 #include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
 #include <opm/input/eclipse/Schedule/Group/GTNode.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupHierarchy.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRate.hpp>
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
 #include <opm/input/eclipse/Schedule/Network/Balance.hpp>
@@ -469,6 +470,83 @@ BOOST_AUTO_TEST_CASE(GroupTree2TEST) {
 }
 
 
+BOOST_AUTO_TEST_CASE(GroupHierarchyTEST) {
+    const auto schedule = make_schedule(createDeckWithWellsOrderedGRUPTREE() + R"(
+TSTEP
+  1 /
+TSTEP
+  1 /
+GRUPTREE
+  CG3 PG2 /
+/
+)");
+
+    const auto h0 = schedule[0].group_hierarchy();
+    BOOST_REQUIRE_EQUAL(h0->size(), std::size_t{6});
+    BOOST_CHECK_EQUAL(h0->name(0), "FIELD");
+    BOOST_CHECK_EQUAL(h0->parent(0), GroupHierarchy::npos);
+    BOOST_CHECK_MESSAGE(! h0->groupID("NO_SUCH_GROUP").has_value(),
+                        "Unknown group must not have an ID");
+
+    const auto cg1 = h0->groupID("CG1");
+    BOOST_REQUIRE_MESSAGE(cg1.has_value(), "Group CG1 must be in hierarchy");
+    BOOST_CHECK_EQUAL(h0->level(*cg1), std::size_t{3});
+    BOOST_CHECK_EQUAL(h0->name(h0->parent(*cg1)), "PG1");
+    {
+        const auto wells = h0->wells(*cg1);
+        const auto expect = std::vector<std::string> { "DW_0", "CW_1" };
+        BOOST_CHECK_EQUAL_COLLECTIONS(wells.begin(), wells.end(),
+                                      expect.begin(), expect.end());
+    }
+
+    // Parents precede children in pre-order, and follow them in post-order.
+    {
+        const auto& pre = h0->preOrder();
+        const auto& post = h0->postOrder();
+        BOOST_REQUIRE_EQUAL(pre.size(), h0->size());
+        BOOST_REQUIRE_EQUAL(post.size(), h0->size());
+        BOOST_CHECK_EQUAL(post.back(), std::size_t{0});
+
+        auto pre_pos = std::vector<std::size_t>(h0->size());
+        auto post_pos = std::vector<std::size_t>(h0->size());
+        for (auto i = 0*h0->size(); i < h0->size(); ++i) {
+            pre_pos[pre[i]] = i;
+            post_pos[post[i]] = i;
+        }
+
+        for (auto id = 1 + 0*h0->size(); id < h0->size(); ++id) {
+            BOOST_CHECK_LT(pre_pos[h0->parent(id)], pre_pos[id]);
+            BOOST_CHECK_GT(post_pos[h0->parent(id)], post_pos[id]);
+        }
+    }
+
+    // Unchanged group tree is shared between report steps.
+    BOOST_CHECK(schedule[1].group_hierarchy() == h0);
+
+    const auto h2 = schedule[2].group_hierarchy();
+    BOOST_CHECK(h2 != h0);
+    BOOST_CHECK_EQUAL(h2->size(), std::size_t{7});
+    {
+        const auto pg2 = h2->groupID("PG2");
+        BOOST_REQUIRE_MESSAGE(pg2.has_value(), "Group PG2 must be in hierarchy");
+
+        const auto children = h2->children(*pg2);
+        BOOST_REQUIRE_EQUAL(children.size(), std::size_t{2});
+        BOOST_CHECK_EQUAL(h2->name(children[0]), "CG2");
+        BOOST_CHECK_EQUAL(h2->name(children[1]), "CG3");
+    }
+
+    // GTNode built from the hierarchy.
+    const auto gt = schedule.groupTree("PG2", 2);
+    BOOST_CHECK_EQUAL(gt.level(), std::size_t{0});
+    BOOST_CHECK_THROW(gt.parent_name(), std::invalid_argument);
+    BOOST_REQUIRE_EQUAL(gt.groups().size(), std::size_t{2});
+    BOOST_CHECK_EQUAL(gt.groups()[0].level(), std::size_t{1});
+    BOOST_CHECK_EQUAL(gt.groups()[0].parent_name(), "PG2");
+    BOOST_CHECK_EQUAL(gt.groups()[0].wells().size(), std::size_t{2});
+    BOOST_CHECK_EQUAL(gt.all_nodes().size(), std::size_t{3});
+}
+
 BOOST_AUTO_TEST_CASE(CreateScheduleDeckWithStart) {
     const auto& schedule = make_schedule( createDeck() );
     BOOST_CHECK_EQUAL( schedule.getStartTime() , asTimeT(TimeStampUTC(1998, 3  , 8 )));
@@ -2431,6 +2509,84 @@ WCONHIST
     }
 }
 
+BOOST_AUTO_TEST_CASE(WCONHIST_RecordsGroupedByWell) {
+    // Enough wells for the records to be applied concurrently.
+    const auto numWells = std::size_t{150};
+
+    std::string welspecs, compdat, wconhist;
+    for (auto k = 0*numWells; k < numWells; ++k) {
+        const auto i = k % 10 + 1;
+        const auto j = (k / 10) % 10 + 1;
+        const auto l = k / 100 + 1;
+
+        welspecs += fmt::format(" 'P{}' 'OP' {} {} 1* 'OIL' /\n", k + 1, i, j);
+        compdat  += fmt::format(" 'P{}' {} {} {} {} 'OPEN' /\n", k + 1, i, j, l, l);
+        wconhist += fmt::format(" 'P{}' 'OPEN' 'ORAT' {} /\n", k + 1, 10.0 * (k + 1));
+    }
+
+    const auto input = fmt::format(R"(
+START             -- 0
+19 JUN 2007 /
+GRID
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+SCHEDULE
+DATES             -- 1
+ 10  OKT 2008 /
+/
+WELSPECS
+{}/
+COMPDAT
+{}/
+WCONHIST
+{}/
+DATES             -- 2
+ 15  OKT 2008 /
+/
+WCONHIST
+ 'P1*' 'OPEN' 'ORAT' 1.0 /
+ 'P1'  'SHUT' 'ORAT' 2.0 /
+/
+)", welspecs, compdat, wconhist);
+
+    const auto sched = make_schedule(input);
+    const auto st = ::Opm::SummaryState{ TimeService::now(), 0.0 };
+
+    auto oil_rate = [&sched, &st](const std::string& well, const std::size_t step)
+    {
+        return sched.getWell(well, step).getProductionProperties().controls(st, 0).oil_rate;
+    };
+
+    for (auto k = 0*numWells; k < numWells; ++k) {
+        const auto well = fmt::format("P{}", k + 1);
+
+        BOOST_CHECK(sched.getWell(well, 1).getStatus() == Well::Status::OPEN);
+        BOOST_CHECK(!sched.getWell(well, 1).predictionMode());
+        BOOST_CHECK_CLOSE(oil_rate(well, 1), 10.0 * (k + 1) * sm3_per_day(), 1.0e-8);
+        BOOST_CHECK(sched[1].wellgroup_events().hasEvent(well, ScheduleEvents::PRODUCTION_UPDATE));
+    }
+
+    // Later records for the same well are applied on top of earlier ones.
+    BOOST_CHECK(sched.getWell("P1", 2).getStatus() == Well::Status::SHUT);
+    BOOST_CHECK_CLOSE(oil_rate("P1", 2), 2.0 * sm3_per_day(), 1.0e-8);
+    BOOST_CHECK(sched[2].wellgroup_events().hasEvent("P1", ScheduleEvents::WELL_STATUS_CHANGE));
+    BOOST_CHECK(sched[2].wellgroup_events().hasEvent("P1", ScheduleEvents::REQUEST_SHUT_WELL));
+
+    for (const auto* well : { "P10", "P19", "P100", "P149" }) {
+        BOOST_CHECK(sched.getWell(well, 2).getStatus() == Well::Status::OPEN);
+        BOOST_CHECK_CLOSE(oil_rate(well, 2), 1.0 * sm3_per_day(), 1.0e-8);
+    }
+
+    BOOST_CHECK_CLOSE(oil_rate("P2", 2), 20.0 * sm3_per_day(), 1.0e-8);
+    BOOST_CHECK(!sched[2].wellgroup_events().hasEvent("P2", ScheduleEvents::PRODUCTION_UPDATE));
+}
+
 BOOST_AUTO_TEST_CASE(fromWCONHISTtoWCONPROD) {
     std::string input = R"(
 RUNSPEC
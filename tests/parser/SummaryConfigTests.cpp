@@ -827,6 +827,40 @@ BOOST_AUTO_TEST_CASE( REMOVE_DUPLICATED_ENTRIES ) {
             uniq_keys.begin(), uniq_keys.end() );
 }
 
+BOOST_AUTO_TEST_CASE( OVERLAPPING_WELL_PATTERNS ) {
+    const auto input = std::string { R"(WOPR
+'W_*' 'W_1' 'W*' 'PROD*' /
+WGPR
+'W_3' 'W_3' /
+COPR
+'W_*' /
+'W_1' /
+/
+WOPR
+'WX2' /
+)" };
+
+    const auto summary = createSummary( input );
+
+    // Expansion order is immaterial.  Configured vectors are sorted and
+    // each vector is configured exactly once.
+    BOOST_CHECK_MESSAGE( std::ranges::is_sorted(summary.begin(), summary.end()),
+                         "Summary vectors must be sorted" );
+
+    BOOST_CHECK_MESSAGE( std::adjacent_find(summary.begin(), summary.end()) == summary.end(),
+                         "Summary vectors must be unique" );
+
+    const auto expect = std::vector<std::string> {
+        "COPR:W_1:112", "COPR:W_1:12", "COPR:W_1:163",
+        "WGPR:W_3",
+        "WOPR:PRODUCER", "WOPR:WX2", "WOPR:W_1", "WOPR:W_3",
+    };
+
+    const auto keys = sorted_key_names( summary );
+    BOOST_CHECK_EQUAL_COLLECTIONS( keys.begin(), keys.end(),
+                                   expect.begin(), expect.end() );
+}
+
 BOOST_AUTO_TEST_CASE( ANALYTICAL_AQUIFERS ) {
     {
         const auto faulty_input = std::string {R"(
@@ -20,6 +20,9 @@
 
 
 #include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
 
 #define BOOST_TEST_MODULE ThresholdPressureTests
 
@@ -377,6 +380,37 @@ BOOST_AUTO_TEST_CASE(HasPair) {
     BOOST_CHECK_EQUAL(1200000.0, s.threshPres.getThresholdPressure(1, 2));
 }
 
+BOOST_AUTO_TEST_CASE(BatchLookup) {
+    Setup s(inputStrWithEqlNum);
+    const auto& thp = s.threshPres;
+
+    const auto region1 = std::vector<int> { 1, 2, 3, 3, 1, 7, 0 };
+    const auto region2 = std::vector<int> { 2, 1, 2, 1, 1, 1, 2 };
+    auto thpres = std::vector<double>(region1.size(), -1.0);
+
+    thp.getThresholdPressures(region1, region2, thpres);
+
+    for (auto i = 0*region1.size(); i < region1.size(); ++i) {
+        BOOST_CHECK_EQUAL(thpres[i], thp.getThresholdPressure(region1[i], region2[i]));
+    }
+
+    BOOST_CHECK_THROW(thp.getThresholdPressures(region1, region2,
+                                                std::span<double>{thpres}.first(2)),
+                      std::invalid_argument);
+
+    ParseContext pc;
+    pc.update(ParseContext::UNSUPPORTED_INITIAL_THPRES, InputErrorAction::IGNORE);
+    Setup s2(inputStrMissingPressure, pc);
+
+    const auto r1 = std::vector<int> { 1, 3 };
+    const auto r2 = std::vector<int> { 2, 2 };
+    auto p = std::vector<double>(r1.size());
+
+    s2.threshPres.getThresholdPressures(r1, r2, p);
+    BOOST_CHECK_EQUAL(p[0], 1200000.0);
+    BOOST_CHECK_MESSAGE(std::isnan(p[1]), "Defaulted threshold pressure must be NaN");
+}
+
 BOOST_AUTO_TEST_CASE(Irreversible) {
     Setup s(inputStrIrrevers2);
     const auto& thp = s.threshPres;
@@ -73,6 +73,30 @@ BOOST_AUTO_TEST_CASE(UnitSystemGetNewOK) {
     BOOST_CHECK_EQUAL(1 , comp.getSIScaling());
 }
 
+BOOST_AUTO_TEST_CASE(UnitSystemDimensionID) {
+    UnitSystem system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    system.addDimension("Length" , 10 );
+    system.addDimension("Time" , 100);
+
+    // Not yet resolved, so parsed from the expression.
+    BOOST_CHECK_EQUAL(1.0, system.parse(3, "Length*Length/Time").getSIScaling());
+
+    const auto use_count = system.use_count();
+    BOOST_CHECK_EQUAL(1.0, system.getNewDimension(3, "Length*Length/Time").getSIScaling());
+    BOOST_CHECK( system.hasDimension("Length*Length/Time"));
+
+    // Resolved expressions are looked up by ID alone.
+    BOOST_CHECK_EQUAL(1.0, system.getNewDimension(3, "Ignored").getSIScaling());
+    BOOST_CHECK_EQUAL(1.0, system.parse(3, "Ignored").getSIScaling());
+    BOOST_CHECK( system.use_count() > use_count );
+
+    BOOST_CHECK_EQUAL(10.0, system.getNewDimension(UnitSystem::noDimensionID, "Length").getSIScaling());
+
+    // Redefining an atomic dimension invalidates all resolved expressions.
+    system.addDimension("Time" , 10);
+    BOOST_CHECK_THROW( system.parse(3, "Ignored"), std::out_of_range );
+}
+
 
 BOOST_AUTO_TEST_CASE(UnitSystemAddDimensions) {
     UnitSystem system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
@@ -706,6 +730,40 @@ BOOST_AUTO_TEST_CASE(TemperatureConversions)
     BOOST_CHECK_CLOSE(field.from_si(Meas::temperature , (459.67 + 1.0)*5.0/9.0), 1.0, 1.0e-10);
 }
 
+BOOST_AUTO_TEST_CASE(BulkConversions)
+{
+    using Meas = UnitSystem::measure;
+
+    const auto field = UnitSystem::newFIELD();
+
+    auto si = std::vector<double>(1000);
+    for (auto i = 0*si.size(); i < si.size(); ++i) {
+        si[i] = 250.0 + 0.125*i;
+    }
+
+    // Scale only and scale with offset.
+    for (const auto m : { Meas::pressure, Meas::temperature }) {
+        auto values = si;
+        field.from_si(m, values);
+
+        const auto single = field.from_si_float(m, si);
+        BOOST_REQUIRE_EQUAL(single.size(), si.size());
+
+        for (auto i = 0*si.size(); i < si.size(); ++i) {
+            BOOST_CHECK_EQUAL(values[i], field.from_si(m, si[i]));
+            BOOST_CHECK_EQUAL(single[i], static_cast<float>(field.from_si(m, si[i])));
+        }
+
+        field.to_si(m, values);
+        for (auto i = 0*si.size(); i < si.size(); ++i) {
+            BOOST_CHECK_CLOSE(values[i], si[i], 1.0e-10);
+        }
+    }
+
+    auto out = std::vector<float>(si.size() - 1);
+    BOOST_CHECK_THROW(field.from_si(Meas::pressure, si, out), std::invalid_argument);
+}
+
 
 
 BOOST_AUTO_TEST_CASE(EclipseID) {
@@ -23,8 +23,13 @@
 
 #include <opm/common/utility/CSRGraphFromCoordinates.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <random>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(No_Self_Connections)
 
@@ -3004,3 +3009,146 @@ BOOST_AUTO_TEST_CASE(Linear_4x1x1_Symmetric_Multiple_Repeated_Add_3x1x1_Expand_N
 BOOST_AUTO_TEST_SUITE_END()     // Tracked
 
 BOOST_AUTO_TEST_SUITE_END()     // Permit_Self_Connections
+
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(Large_Graph)
+
+namespace {
+    using Edges = std::vector<std::pair<int, int>>;
+
+    // Connections between nearby vertices, with many repeated pairs and
+    // some self connections.  Large enough to use the multithreaded
+    // assembly if OpenMP is enabled.
+    Edges randomEdges(const int numVertices,
+                      const std::size_t numEdges,
+                      const unsigned int seed)
+    {
+        auto gen = std::mt19937 { seed };
+
+        auto edges = Edges{};
+        edges.reserve(numEdges);
+
+        for (auto e = 0*numEdges; e < numEdges; ++e) {
+            const auto v1 = static_cast<int>(gen() % numVertices);
+            const auto v2 = std::min(numVertices - 1,
+                                     v1 + static_cast<int>(gen() % 5));
+
+            edges.emplace_back(v1, v2);
+        }
+
+        return edges;
+    }
+
+    // Sorted unique vertex pairs, excluding self connections.
+    Edges uniqueEdges(const std::vector<const Edges*>& edgeSets)
+    {
+        auto unique = Edges{};
+
+        for (const auto* edges : edgeSets) {
+            std::copy_if(edges->begin(), edges->end(), std::back_inserter(unique),
+                         [](const auto& e) { return e.first != e.second; });
+        }
+
+        std::sort(unique.begin(), unique.end());
+        unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+
+        return unique;
+    }
+
+    template <class Graph>
+    void checkStructure(const Graph& graph, const Edges& expect, const int numVertices)
+    {
+        const auto& ia = graph.startPointers();
+        const auto& ja = graph.columnIndices();
+
+        BOOST_REQUIRE_EQUAL(graph.numVertices(), static_cast<std::size_t>(numVertices));
+        BOOST_REQUIRE_EQUAL(graph.numEdges(), expect.size());
+
+        auto edges = Edges{};
+        for (auto row = 0; row < numVertices; ++row) {
+            for (auto k = ia[row]; k < ia[row + 1]; ++k) {
+                edges.emplace_back(row, ja[k]);
+            }
+        }
+
+        BOOST_CHECK_MESSAGE(edges == expect, "Compressed graph must match reference graph");
+    }
+
+    std::vector<std::size_t>
+    expectedIndexMap(const std::vector<const Edges*>& edgeSets, const Edges& unique)
+    {
+        auto map = std::vector<std::size_t>{};
+
+        for (const auto* edges : edgeSets) {
+            for (const auto& e : *edges) {
+                if (e.first != e.second) {
+                    map.push_back(std::distance(unique.begin(),
+                                                std::lower_bound(unique.begin(), unique.end(), e)));
+                }
+            }
+        }
+
+        return map;
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Untracked)
+{
+    const auto numVertices = 50'000;
+    const auto edges = randomEdges(numVertices, 400'000, 1234);
+
+    auto graph = Opm::utility::CSRGraphFromCoordinates<>{};
+    for (const auto& [v1, v2] : edges) {
+        graph.addConnection(v1, v2);
+    }
+
+    graph.compress(numVertices);
+
+    checkStructure(graph, uniqueEdges({ &edges }), numVertices);
+}
+
+BOOST_AUTO_TEST_CASE(Tracked_Add_Expand)
+{
+    const auto numVertices = 50'000;
+    const auto edges1 = randomEdges(numVertices - 1'000, 300'000, 4321);
+    const auto edges2 = randomEdges(numVertices, 300'000, 5678);
+
+    auto graph = Opm::utility::CSRGraphFromCoordinates<int, true>{};
+
+    for (const auto& [v1, v2] : edges1) {
+        graph.addConnection(v1, v2);
+    }
+
+    graph.compress(numVertices - 1'000);
+
+    {
+        const auto unique = uniqueEdges({ &edges1 });
+        checkStructure(graph, unique, numVertices - 1'000);
+
+        const auto& nzMap = graph.compressedIndexMap();
+        const auto expect = expectedIndexMap({ &edges1 }, unique);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(nzMap .begin(), nzMap .end(),
+                                      expect.begin(), expect.end());
+    }
+
+    for (const auto& [v1, v2] : edges2) {
+        graph.addConnection(v1, v2);
+    }
+
+    graph.compress(numVertices, true);
+
+    {
+        const auto unique = uniqueEdges({ &edges1, &edges2 });
+        checkStructure(graph, unique, numVertices);
+
+        const auto& nzMap = graph.compressedIndexMap();
+        const auto expect = expectedIndexMap({ &edges1, &edges2 }, unique);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(nzMap .begin(), nzMap .end(),
+                                      expect.begin(), expect.end());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()     // Large_Graph
@@ -0,0 +1,157 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE CopyOnWriteVectorTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/utility/CopyOnWriteVector.hpp>
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+    using Vector = Opm::Utility::CopyOnWriteVector<int, 4>;
+
+    Vector makeVector(const int n)
+    {
+        auto v = Vector{};
+        for (auto i = 0; i < n; ++i) {
+            v.push_back(i);
+        }
+
+        return v;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+    const auto v = Vector{};
+
+    BOOST_CHECK_MESSAGE(v.empty(), "Default constructed vector must be empty");
+    BOOST_CHECK_EQUAL(v.size(), std::size_t{0});
+    BOOST_CHECK(v.begin() == v.end());
+    BOOST_CHECK_EQUAL(v.sharedChunks(), std::size_t{0});
+}
+
+BOOST_AUTO_TEST_CASE(Push_Back_And_Access)
+{
+    const auto v = makeVector(10);
+
+    BOOST_CHECK_EQUAL(v.size(), std::size_t{10});
+    BOOST_CHECK_EQUAL(v.front(), 0);
+    BOOST_CHECK_EQUAL(v.back(), 9);
+
+    for (auto i = 0*v.size(); i < v.size(); ++i) {
+        BOOST_CHECK_EQUAL(v[i], static_cast<int>(i));
+    }
+
+    BOOST_CHECK_EQUAL(std::accumulate(v.begin(), v.end(), 0), 45);
+    BOOST_CHECK_THROW(v.at(10), std::out_of_range);
+
+    const auto expect = std::vector<int> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(v.begin(), v.end(),
+                                  expect.begin(), expect.end());
+}
+
+BOOST_AUTO_TEST_CASE(Copy_Shares_Chunks)
+{
+    const auto v1 = makeVector(10);
+    auto v2 = v1;
+
+    // Three chunks of at most four elements each.
+    BOOST_CHECK_EQUAL(v1.sharedChunks(), std::size_t{3});
+    BOOST_CHECK_EQUAL(v2.sharedChunks(), std::size_t{3});
+    BOOST_CHECK_MESSAGE(v1 == v2, "Copy must compare equal to original");
+
+    // Reading through a const view does not unshare.
+    BOOST_CHECK_EQUAL(std::as_const(v2)[5], 5);
+    BOOST_CHECK_EQUAL(v2.sharedChunks(), std::size_t{3});
+
+    v2[5] = 42;
+
+    BOOST_CHECK_EQUAL(v2.sharedChunks(), std::size_t{2});
+    BOOST_CHECK_EQUAL(v1[5], 5);
+    BOOST_CHECK_EQUAL(v2[5], 42);
+    BOOST_CHECK_EQUAL(v2[4], 4);
+    BOOST_CHECK_EQUAL(v2[6], 6);
+    BOOST_CHECK_MESSAGE(v1 != v2, "Modified copy must not compare equal to original");
+
+    v2[5] = 5;
+    BOOST_CHECK_MESSAGE(v1 == v2, "Restored copy must compare equal to original");
+}
+
+BOOST_AUTO_TEST_CASE(Push_Back_Into_Shared_Chunk)
+{
+    const auto v1 = makeVector(6);
+    auto v2 = v1;
+
+    v2.push_back(6);
+
+    BOOST_CHECK_EQUAL(v1.size(), std::size_t{6});
+    BOOST_CHECK_EQUAL(v2.size(), std::size_t{7});
+    BOOST_CHECK_EQUAL(v2.back(), 6);
+
+    // First chunk still shared, second chunk copied before appending.
+    BOOST_CHECK_EQUAL(v2.sharedChunks(), std::size_t{1});
+}
+
+BOOST_AUTO_TEST_CASE(Mutable_Iterators)
+{
+    const auto v1 = makeVector(9);
+    auto v2 = v1;
+
+    std::ranges::reverse(v2);
+
+    BOOST_CHECK_EQUAL(v2.front(), 8);
+    BOOST_CHECK_EQUAL(v2.back(), 0);
+    BOOST_CHECK_EQUAL(v1.front(), 0);
+    BOOST_CHECK_EQUAL(v1.back(), 8);
+
+    std::sort(v2.begin(), v2.end());
+    BOOST_CHECK_MESSAGE(v1 == v2, "Sorted copy must compare equal to original");
+
+    auto pos = std::find(std::as_const(v2).begin(), std::as_const(v2).end(), 7);
+    BOOST_CHECK_EQUAL(pos - v2.cbegin(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(Pack_Keeps_Chunks_Shared)
+{
+    const auto v1 = makeVector(10);
+    auto v2 = v1;
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+    ser.pack(v2);
+
+    // Packing only reads the elements.
+    BOOST_CHECK_EQUAL(v1.sharedChunks(), std::size_t{3});
+    BOOST_CHECK_EQUAL(v2.sharedChunks(), std::size_t{3});
+
+    auto v3 = Vector{};
+    ser.unpack(v3);
+    BOOST_CHECK_MESSAGE(v3 == v1, "Unpacked vector must compare equal to original");
+}
@@ -34,8 +34,10 @@
 #include <initializer_list>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
 #include <math.h>
 #include <tuple>
+#include <vector>
 
 #include <stdio.h>
 
@@ -165,6 +167,49 @@ BOOST_AUTO_TEST_CASE(getCellCorners)
     BOOST_CHECK_EQUAL(Z == ref_Z, true);
 }
 
+BOOST_AUTO_TEST_CASE(bulkCellGeometry)
+{
+    EGrid grid1("SPE1CASE1.EGRID");
+
+    const auto nCells = static_cast<std::size_t>(grid1.totalNumberOfCells());
+
+    std::vector<std::array<double,3>> center(nCells);
+    std::vector<double> volume(nCells), depth(nCells), thickness(nCells);
+
+    grid1.cellGeometry({ center, volume, depth, thickness });
+
+    std::vector<int> subset { 7, 0, 299, 123 };
+    std::vector<double> subsetVolume(subset.size());
+    std::vector<std::array<double,8>> sX(subset.size()), sY(subset.size()), sZ(subset.size());
+
+    grid1.cellGeometry(subset, { .volume = subsetVolume });
+    grid1.getCellCorners(subset, sX, sY, sZ);
+
+    std::array<double,8> X, Y, Z;
+
+    for (std::size_t globInd = 0; globInd < nCells; ++globInd) {
+        grid1.getCellCorners(static_cast<int>(globInd), X, Y, Z);
+
+        BOOST_CHECK_EQUAL(volume[globInd], calculateCellVol(X, Y, Z));
+        BOOST_CHECK_EQUAL(center[globInd][2], std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0);
+        BOOST_CHECK_EQUAL(thickness[globInd], (Z[4]+Z[5]+Z[6]+Z[7])/4.0 - (Z[0]+Z[1]+Z[2]+Z[3])/4.0);
+        BOOST_CHECK_CLOSE(depth[globInd], center[globInd][2], 1.0e-10);
+    }
+
+    for (std::size_t n = 0; n < subset.size(); ++n) {
+        grid1.getCellCorners(subset[n], X, Y, Z);
+
+        BOOST_CHECK_EQUAL(subsetVolume[n], volume[subset[n]]);
+        BOOST_CHECK(sX[n] == X);
+        BOOST_CHECK(sY[n] == Y);
+        BOOST_CHECK(sZ[n] == Z);
+    }
+
+    std::vector<int> invalid { 0, 300 };
+    BOOST_CHECK_THROW(grid1.cellGeometry(invalid, { .volume = subsetVolume }), std::invalid_argument);
+    BOOST_CHECK_THROW(grid1.cellGeometry({ .volume = subsetVolume }), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(lgr_1)
 {
     std::string testEgridFile = "LGR_TESTMOD.EGRID";
@@ -176,6 +176,35 @@ BOOST_AUTO_TEST_CASE(TestERft_1) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestERft_WellSeries)
+{
+    using Date = std::tuple<int, int, int>;
+
+    ERft rft1("SPE1CASE1.RFT");
+
+    const auto& prodReports = rft1.wellReportIndices("PROD");
+    BOOST_CHECK_EQUAL(prodReports.size(), 2U);
+    BOOST_CHECK_EQUAL(prodReports[0], 0);
+    BOOST_CHECK_EQUAL(prodReports[1], 4);
+
+    BOOST_CHECK_EQUAL(rft1.wellReportIndices("B-2H").size(), 1U);
+    BOOST_CHECK_THROW(rft1.wellReportIndices("XXXX"), std::invalid_argument);
+
+    const auto time = rft1.getRftSeries<float>("TIME", "PROD");
+    BOOST_REQUIRE_EQUAL(time.size(), 2U);
+    BOOST_CHECK_EQUAL(time[0].get()[0], 0.0f);
+    BOOST_CHECK_CLOSE(time[1].get()[0], 942.0f, 1.0e-5);
+
+    const auto welletc = rft1.getRftSeries<std::string>("WELLETC", "PROD");
+    BOOST_REQUIRE_EQUAL(welletc.size(), 2U);
+    BOOST_CHECK_MESSAGE(welletc[1].get() == rft1.getRft<std::string>("WELLETC", "PROD", Date{2017,7,31}),
+                        "Last PROD WELLETC series entry must match last report");
+
+    BOOST_CHECK_THROW(rft1.getRftSeries<float>("XXXXXXX", "PROD"), std::invalid_argument);
+    BOOST_CHECK_THROW(rft1.getRftSeries<int>("TIME", "PROD"), std::runtime_error);
+}
+
+
 BOOST_AUTO_TEST_CASE(TestERft_2)
 {
     {
@@ -25,6 +25,7 @@
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
+#include <opm/io/eclipse/RestartFileView.hpp>
 
 #include <opm/common/utility/FileSystem.hpp>
 
@@ -35,6 +36,7 @@
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <numeric>
 #include <random>
 #include <tuple>
@@ -192,6 +194,57 @@ BOOST_AUTO_TEST_CASE(TestERst_1) {
 
 }
 
+BOOST_AUTO_TEST_CASE(TestERst_Selective) {
+
+    std::string testFile="SPE1_TESTCASE.UNRST";
+
+    ERst rst1(testFile);
+    ERst rst2(testFile);
+
+    rst1.loadReportStepNumbers({10, 25}, {"PRESSURE", "ICON", "NOSUCHKW"});
+
+    BOOST_CHECK_THROW(rst1.loadReportStepNumbers({10, 4}, {"PRESSURE"}), std::invalid_argument);
+
+    for (const int seqn : {10, 25}) {
+        rst2.loadReportStepNumber(seqn);
+
+        BOOST_CHECK_MESSAGE(rst1.getRestartData<float>("PRESSURE", seqn) ==
+                            rst2.getRestartData<float>("PRESSURE", seqn),
+                            "Selectively loaded PRESSURE must match full load");
+
+        BOOST_CHECK_MESSAGE(rst1.getRestartData<int>("ICON", seqn) ==
+                            rst2.getRestartData<int>("ICON", seqn),
+                            "Selectively loaded ICON must match full load");
+
+        // Not part of selected subset.  Loaded on demand.
+        BOOST_CHECK_MESSAGE(rst1.getRestartData<double>("XGRP", seqn) ==
+                            rst2.getRestartData<double>("XGRP", seqn),
+                            "On-demand XGRP must match full load");
+    }
+
+    // Released data is reloaded on demand.
+    rst1.unloadReportStepNumber(25);
+    BOOST_CHECK_EQUAL(rst1.getRestartData<float>("PRESSURE", 25).size(), std::size_t{300});
+    BOOST_CHECK_THROW(rst1.unloadReportStepNumber(4), std::invalid_argument);
+
+    {
+        auto rst_file = std::make_shared<ERst>(testFile);
+        {
+            const auto view = RestartFileView { rst_file, 10, {"INTEHEAD", "PRESSURE"} };
+
+            BOOST_CHECK_MESSAGE(view.getKeyword<float>("PRESSURE") ==
+                                rst2.getRestartData<float>("PRESSURE", 10),
+                                "Selective view must provide same PRESSURE as full load");
+
+            BOOST_CHECK_MESSAGE(view.intehead() == rst2.getRestartData<int>("INTEHEAD", 10),
+                                "Selective view must provide same INTEHEAD as full load");
+        }
+
+        // View dropped.  Arrays must still be available on demand.
+        BOOST_CHECK_EQUAL(rst_file->getRestartData<float>("PRESSURE", 10).size(), std::size_t{300});
+    }
+}
+
 namespace {
 
 void readAndWrite(EclOutput& eclTest, ERst& rst1,
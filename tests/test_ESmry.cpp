@@ -34,6 +34,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <tuple>
 
 #include <math.h>
@@ -200,6 +201,13 @@ BOOST_AUTO_TEST_CASE(TestESmry_1) {
     auto fgor4b = smry4.get("FGOR");
 
     BOOST_CHECK_EQUAL(fgor4a.size(), fgor4b.size());
+
+    // Repeated keys are loaded once.
+    ESmry smry5("SPE1CASE1.SMSPEC");
+    smry5.loadData({"FGOR", "FOPR", "FGOR"});
+
+    BOOST_CHECK_EQUAL(smry5.get("FGOR").size(), fgor4a.size());
+    BOOST_CHECK_EQUAL(smry5.get("FOPR").size(), fgor4a.size());
 }
 
 BOOST_AUTO_TEST_CASE(TestESmry_2) {
@@ -406,6 +414,24 @@ BOOST_AUTO_TEST_CASE(TestCreateRSM) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestCreateRSM_Chunked) {
+    ESmry smry1("SPE1CASE1.SMSPEC");
+    ESmry smry2("SPE1CASE1.SMSPEC");
+
+    std::ostringstream full;
+    smry1.write_rsm(full);
+
+    // Two RSM blocks per chunk.  Vectors are loaded and released per chunk.
+    std::ostringstream chunked;
+    smry2.write_rsm(chunked, 10);
+
+    BOOST_CHECK_MESSAGE(full.str() == chunked.str(),
+                        "Chunked RSM output must match single-pass output");
+
+    // Released vectors are reloaded on demand.
+    BOOST_CHECK_EQUAL(smry2.get("FOPR").size(), smry1.get("FOPR").size());
+}
+
 BOOST_AUTO_TEST_CASE(TestUnits) {
     ESmry smry("SPE1CASE1.SMSPEC");
     smry.loadData();
@@ -67,3 +67,31 @@ BOOST_AUTO_TEST_CASE(average) {
 
     BOOST_CHECK_CLOSE(avg, 13.0/4, tol);
 }
+
+
+
+BOOST_AUTO_TEST_CASE(toleranceViolations) {
+    const std::vector<float> v1 = {0.0f, 0.0f, 1.0f, 100.0f, -5.0f,  2.0f,   1.0e-4f};
+    const std::vector<float> v2 = {0.0f, 1.0f, 1.0f, 100.5f,  5.0f,  2.001f, 0.0f};
+    const double absTol = 1.0e-3;
+    const double relTol = 1.0e-3;
+
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < v1.size(); i++) {
+        const Deviation dev = ECLFilesComparator::calculateDeviations(v1[i], v2[i]);
+        if (dev.abs > absTol && (dev.rel > relTol || dev.rel == -1)) {
+            expected++;
+        }
+    }
+
+    // (0,1), (100,100.5) and (-5,5)
+    BOOST_CHECK_EQUAL(expected, 3U);
+    BOOST_CHECK_EQUAL(countToleranceViolations(v1.data(), v2.data(), v1.size(), absTol, relTol), expected);
+    BOOST_CHECK_EQUAL(countToleranceViolations(v1.data(), v1.data(), v1.size(), absTol, relTol), 0U);
+
+    const std::vector<Deviation> deviations = {{1.0, -1.0}, {3.0, 0.5}, {2.0, 0.75}};
+    const Deviation maxDev = maxDeviation(deviations);
+
+    BOOST_CHECK_EQUAL(maxDev.abs, 3.0);
+    BOOST_CHECK_EQUAL(maxDev.rel, 0.75);
+}
@@ -624,6 +624,53 @@ BOOST_AUTO_TEST_CASE(results_init_2)
     BOOST_CHECK_THROW(test3.results_init(),std::runtime_error);
 }
 
+BOOST_AUTO_TEST_CASE(results_init_streaming)
+{
+    WorkArea work;
+
+    std::vector<std::string> floatKeys;
+    std::vector<std::vector<float>> floatData1;
+    std::vector<std::vector<float>> floatData2;
+
+    for (int n = 0; n < 20; n++) {
+        floatKeys.push_back("FLT" + std::to_string(n));
+        floatData1.emplace_back(1000, 1.0f + n);
+        floatData2.emplace_back(1000, 1.0f + n);
+    }
+
+    std::vector<std::string> intKeys = {"FIPNUM"};
+    std::vector<std::vector<int>> intData = {std::vector<int>(1000, 1)};
+
+    makeInitFile("TMP1.INIT", floatKeys, floatData1, intKeys, intData);
+    makeInitFile("TMP2.INIT", floatKeys, floatData2, intKeys, intData);
+
+    // Batches of a few arrays each, all equal
+    ECLRegressionTest test1("TMP1", "TMP2", 1e-3, 1e-3);
+    test1.setStreamBatchSize(10000);
+    test1.results_init();
+
+    // Deviation in an array of a later batch
+    floatData2[17][123] = 2.0f;
+    makeInitFile("TMP2.INIT", floatKeys, floatData2, intKeys, intData);
+
+    ECLRegressionTest test2("TMP1", "TMP2", 1e-3, 1e-3);
+    test2.setStreamBatchSize(10000);
+    BOOST_CHECK_THROW(test2.results_init(), std::runtime_error);
+
+    // Without exceptions, a single deviating cell is counted
+    ECLRegressionTest test3("TMP1", "TMP2", 1e-3, 1e-3);
+    test3.setStreamBatchSize(10000);
+    test3.throwOnErrors(false);
+    test3.results_init();
+    BOOST_CHECK_EQUAL(test3.getNoErrors(), 1U);
+
+    // Early exit throws even when not throwing on errors otherwise
+    ECLRegressionTest test4("TMP1", "TMP2", 1e-3, 1e-3);
+    test4.throwOnErrors(false);
+    test4.setEarlyExit(true);
+    BOOST_CHECK_THROW(test4.results_init(), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(results_unrst_1)
 {
     WorkArea work;
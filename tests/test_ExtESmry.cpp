@@ -27,6 +27,8 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ExtSmryOutput.hpp>
 
 #include <algorithm>
 #include <chrono>
@@ -34,9 +36,12 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <math.h>
 #include <stdio.h>
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include "tests/WorkArea.hpp"
 
@@ -384,3 +389,89 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
     for (std::size_t n = 63; n < fopt.size(); n++)
         BOOST_REQUIRE_CLOSE(fopt[n], fopt_rst_ref[n-63], 0.01);
 }
+
+BOOST_AUTO_TEST_CASE(TestDeltaShuffle_Roundtrip)
+{
+    std::vector<float> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back((i < 300) ? 0.0f : 1.0e3f + 0.25f*i);
+    }
+
+    values.push_back(-1.0e20f);
+    values.push_back(std::numeric_limits<float>::max());
+
+    const auto encoded = Opm::EclIO::encodeDeltaShuffle(values);
+    BOOST_CHECK_LT(encoded.size(), values.size());
+
+    const auto decoded = Opm::EclIO::decodeDeltaShuffle(encoded, values.size());
+    BOOST_CHECK_EQUAL_COLLECTIONS(decoded.begin(), decoded.end(),
+                                  values.begin(), values.end());
+
+    BOOST_CHECK_THROW(Opm::EclIO::decodeDeltaShuffle(encoded, values.size() + 10),
+                      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_Chunked)
+{
+    const auto keys  = std::vector<std::string> { "TIME", "FOPR", "WBHP:PROD" };
+    const auto units = std::vector<std::string> { "DAYS", "SM3/DAY", "BARSA" };
+
+    std::vector<std::vector<float>> ref(keys.size());
+    std::vector<int> rstep_ref;
+
+    for (const auto compress : { false, true }) {
+        WorkArea work;
+
+        auto options = Opm::EclIO::ExtSmryOutput::Options{};
+        options.chunked = true;
+        options.compress = compress;
+        options.min_write_interval = -1;   // flush on every call
+
+        {
+            Opm::EclIO::ExtSmryOutput output("CHUNKED.ESMRY", keys, units, 0, options);
+
+            for (auto& r : ref) { r.clear(); }
+            rstep_ref.clear();
+
+            const int numSteps = 25;
+            for (int step = 0; step < numSteps; ++step) {
+                // Two time steps per report step
+                const int report_step = step / 2 + 1;
+
+                const auto ts_data = std::vector<float> {
+                    static_cast<float>(step + 1), 100.0f*step, 250.0f - 0.5f*step
+                };
+
+                output.write(ts_data, report_step, step == numSteps - 1);
+
+                for (std::size_t k = 0; k < keys.size(); ++k) {
+                    ref[k].push_back(ts_data[k]);
+                }
+
+                if (!rstep_ref.empty() && (rstep_ref.back() == report_step))
+                    rstep_ref.back() = 0;
+
+                rstep_ref.push_back(report_step);
+            }
+        }
+
+        ExtESmry esmry("CHUNKED.ESMRY");
+
+        BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), ref[0].size());
+        BOOST_CHECK_EQUAL(esmry.numberOfVectors(), keys.size());
+
+        esmry.loadData();
+
+        for (std::size_t k = 0; k < keys.size(); ++k) {
+            const auto& vect = esmry.get(keys[k]);
+            BOOST_CHECK_EQUAL_COLLECTIONS(vect.begin(), vect.end(),
+                                          ref[k].begin(), ref[k].end());
+        }
+
+        BOOST_CHECK_EQUAL(esmry.get_unit("FOPR"), "SM3/DAY");
+
+        const auto num_rstep = std::ranges::count_if(rstep_ref, [](const int r) { return r > 0; });
+
+        BOOST_CHECK_EQUAL(esmry.get_at_rstep("TIME").size(), static_cast<std::size_t>(num_rstep));
+    }
+}
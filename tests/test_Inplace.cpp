@@ -21,8 +21,10 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/output/eclipse/Inplace.hpp>
+#include <opm/output/eclipse/RegionReduction.hpp>
 
 #include <exception>
+#include <stdexcept>
 #include <vector>
 
 using namespace Opm;
@@ -66,6 +68,66 @@ BOOST_AUTO_TEST_CASE(TESTInplace)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Region_Reduction)
+{
+    auto reduction = out::RegionReduction { 6 };
+    reduction.addRegionSet("FIPNUM", { 1, 1, 2, 2, 3, 3 });
+    reduction.addRegionSet("FIPABC", { 2, 2, 2, 1, 1, 0 });
+
+    const auto oil = std::vector<double> { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+    const auto gas = std::vector<double> { 10.0, 20.0, 30.0, 40.0, 50.0, 60.0 };
+
+    const auto result = reduction.reduce({ oil, gas });
+
+    Inplace oip;
+    BOOST_CHECK_THROW(oip.add(result, { Inplace::Phase::OIL }), std::invalid_argument);
+
+    oip.add(result, { Inplace::Phase::OIL, Inplace::Phase::GAS });
+
+    BOOST_CHECK_EQUAL(oip.get("FIPNUM", Inplace::Phase::OIL, 1), 3.0);
+    BOOST_CHECK_EQUAL(oip.get("FIPNUM", Inplace::Phase::OIL, 3), 11.0);
+    BOOST_CHECK_EQUAL(oip.get("FIPABC", Inplace::Phase::GAS, 1), 90.0);
+    BOOST_CHECK_EQUAL(oip.get("FIPABC", Inplace::Phase::GAS, 2), 60.0);
+
+    BOOST_CHECK_EQUAL(oip.get(Inplace::Phase::OIL), 21.0);
+    BOOST_CHECK_EQUAL(oip.get(Inplace::Phase::GAS), 210.0);
+
+    BOOST_CHECK_EQUAL(oip.max_region("FIPNUM"), 3);
+    BOOST_CHECK_EQUAL(oip.max_region("FIPABC"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Bulk_Assign)
+{
+    Inplace oip;
+
+    oip.add("FIPNUM", Inplace::Phase::WATER, std::vector { 1.0, 2.0, 3.0, 4.0 });
+    oip.add("FIPNUM", Inplace::Phase::OIL, 2, 17.29);
+
+    BOOST_CHECK_EQUAL(oip.max_region("FIPNUM"), 4);
+    BOOST_CHECK_EQUAL(oip.get("FIPNUM", Inplace::Phase::WATER, 1), 1.0);
+    BOOST_CHECK_EQUAL(oip.get("FIPNUM", Inplace::Phase::WATER, 4), 4.0);
+    BOOST_CHECK_MESSAGE(! oip.has("FIPNUM", Inplace::Phase::WATER, 0),
+                        "Bulk assignment must not define field-level value");
+    BOOST_CHECK_MESSAGE(! oip.has("FIPNUM", Inplace::Phase::WATER, 5),
+                        "Bulk assignment must not define regions beyond input");
+    BOOST_CHECK_MESSAGE(! oip.has("FIPNUM", Inplace::Phase::OIL, 1),
+                        "Unassigned region must not exist");
+
+    {
+        const auto v = oip.get_vector("FIPNUM", Inplace::Phase::WATER);
+        const auto e = std::vector { 1.0, 2.0, 3.0, 4.0 };
+        BOOST_CHECK_MESSAGE(v == e, "Bulk in-place water content must match input");
+    }
+
+    {
+        const auto v = oip.get_vector("FIPNUM", Inplace::Phase::OIL);
+        const auto e = std::vector { 0.0, 17.29, 0.0, 0.0 };
+        BOOST_CHECK_MESSAGE(v == e, "In-place oil content must be padded to region count");
+    }
+
+    BOOST_CHECK_THROW(oip.get_vector("FIPNUM", Inplace::Phase::GAS), std::exception);
+}
+
 BOOST_AUTO_TEST_CASE(InPlace_Phases)
 {
     const auto& phases = Inplace::phases();
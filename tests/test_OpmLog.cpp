@@ -36,6 +36,9 @@
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace Opm;
 
@@ -425,3 +428,95 @@ BOOST_AUTO_TEST_CASE(TestFormat)
     BOOST_CHECK_EQUAL(log_stream2.str(), expected2);
     BOOST_CHECK_EQUAL(log_stream3.str(), expected3);
 }
+
+BOOST_AUTO_TEST_CASE(TestFilterFirst)
+{
+    OpmLog::removeAllBackends();
+
+    std::ostringstream log_stream;
+    {
+        auto streamLog = std::make_shared<StreamLog>(log_stream, Log::MessageType::Warning);
+        streamLog->setMessageLimiter(std::make_shared<MessageLimiter>(1));
+        OpmLog::addBackend("STREAM", streamLog);
+    }
+
+    const std::string tag = "WellControl";
+
+    BOOST_CHECK( OpmLog::isMessageIncluded(Log::MessageType::Warning, tag));
+    BOOST_CHECK(!OpmLog::isMessageIncluded(Log::MessageType::Info, tag));
+
+    OpmLog::log(Log::MessageType::Warning, tag, "Well {} switched to {}", "P1", "BHP");
+    OpmLog::log(Log::MessageType::Info, tag, "Not {}", "shown");
+
+    // Second message reports the tag limit, all subsequent messages with
+    // this tag are suppressed before formatting.
+    OpmLog::log(Log::MessageType::Warning, tag, "Well {} switched to {}", "P2", "THP");
+    BOOST_CHECK(!OpmLog::isMessageIncluded(Log::MessageType::Warning, tag));
+    BOOST_CHECK( OpmLog::isMessageIncluded(Log::MessageType::Warning, "OtherTag"));
+
+    OpmLog::log(Log::MessageType::Warning, tag, "Well {} switched to {}", "P3", "ORAT");
+
+    BOOST_CHECK_EQUAL(log_stream.str(),
+                      "Well P1 switched to BHP\n"
+                      "Message limit reached for message tag: " + tag + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(TestAsynchronousLogging)
+{
+    OpmLog::removeAllBackends();
+
+    std::ostringstream log_stream;
+    auto counter = std::make_shared<CounterLog>();
+
+    OpmLog::addBackend("COUNTER", counter);
+    OpmLog::addBackend("STREAM", std::make_shared<StreamLog>(log_stream, Log::MessageType::Note));
+
+    OpmLog::setAsynchronous(true);
+
+    const int numThreads = 4;
+    const int numMessages = 1000;
+
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([t]() {
+                for (int i = 0; i < numMessages; ++i) {
+                    OpmLog::warning("Warning");
+                    OpmLog::log(Log::MessageType::Note, "", "{} {}", t, i);
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    OpmLog::flush();
+
+    BOOST_CHECK_EQUAL(counter->numMessages(Log::MessageType::Warning),
+                      static_cast<std::size_t>(numThreads * numMessages));
+
+    // Messages from each thread arrive in the order in which they were
+    // issued.
+    {
+        std::vector<int> next(numThreads, 0);
+        std::istringstream lines(log_stream.str());
+        int t = 0, i = 0, count = 0;
+        while (lines >> t >> i) {
+            BOOST_CHECK_EQUAL(i, next[t]);
+            next[t] = i + 1;
+            ++count;
+        }
+
+        BOOST_CHECK_EQUAL(count, numThreads * numMessages);
+    }
+
+    OpmLog::setAsynchronous(false);
+
+    OpmLog::warning("Warning");
+    BOOST_CHECK_EQUAL(counter->numMessages(Log::MessageType::Warning),
+                      static_cast<std::size_t>(numThreads * numMessages + 1));
+
+    OpmLog::removeAllBackends();
+}
@@ -22,6 +22,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/input/eclipse/Schedule/Well/PAvgCalculator.hpp>
+#include <opm/input/eclipse/Schedule/Well/PAvgCalculatorCollection.hpp>
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
@@ -35,6 +36,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -2025,3 +2027,105 @@ BOOST_AUTO_TEST_CASE(BottomOfFormation)
 }
 
 BOOST_AUTO_TEST_SUITE_END() // DepthCorrection_Horizontal_Well
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Collection)
+
+namespace {
+    void assignSources(const std::vector<std::size_t>& cells,
+                       Opm::PAvgDynamicSourceData<double>& blockSource)
+    {
+        using Span = std::remove_cv_t<
+            std::remove_reference_t<decltype(blockSource[0])>>;
+        using Item = typename Span::Item;
+
+        for (const auto& cell : cells) {
+            blockSource[cell]
+                .set(Item::Pressure, 1234.0 + 0.5*cell)
+                .set(Item::PoreVol, 1.0 + 0.1*(cell % 7))
+                .set(Item::MixtureDensity, 0.1 + 0.01*(cell % 5))
+                .set(Item::Depth, 2000.0 + 0.5 + cell / 25)
+                ;
+        }
+    }
+
+    void assignSources(const std::size_t numConns,
+                       Opm::PAvgDynamicSourceData<double>& connSource)
+    {
+        using Span = std::remove_cv_t<
+            std::remove_reference_t<decltype(connSource[0])>>;
+        using Item = typename Span::Item;
+
+        for (auto conn = 0*numConns; conn < numConns; ++conn) {
+            connSource[conn]
+                .set(Item::Pressure, 1222.0)
+                .set(Item::PoreVol, 1.25)
+                .set(Item::MixtureDensity, 0.1 + 0.02*conn)
+                .set(Item::Depth, 0.0) // Unused
+                ;
+        }
+    }
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Batch_Equals_Individual)
+{
+    const auto grid = shoeBox({5, 5, 10});
+
+    const auto wells = std::vector {
+        centreProducer(10, 2, 6),
+        qfsProducer({5, 5, 10}),
+        centreProducer(10, 0, 4),
+    };
+
+    auto collection = Opm::PAvgCalculatorCollection<double>{};
+    auto individual = std::vector<std::unique_ptr<Opm::PAvgCalculator<double>>>{};
+
+    for (auto w = 0*wells.size(); w < wells.size(); ++w) {
+        collection.setCalculator(w, std::make_unique<Opm::PAvgCalculator<double>>(grid, wells[w]));
+        individual.push_back(std::make_unique<Opm::PAvgCalculator<double>>(grid, wells[w]));
+    }
+
+    const auto wbpCells = collection.allWBPCells();
+    auto blockSource = Opm::PAvgDynamicSourceData<double> { wbpCells };
+    assignSources(wbpCells, blockSource);
+
+    auto connSource = std::vector<Opm::PAvgDynamicSourceData<double>>{};
+    auto sources = std::vector<Opm::PAvgCalculator<double>::Sources>(wells.size());
+    connSource.reserve(wells.size());
+    for (auto w = 0*wells.size(); w < wells.size(); ++w) {
+        connSource.emplace_back(individual[w]->allWellConnections());
+        assignSources(wells[w].size(), connSource.back());
+    }
+
+    for (auto w = 0*wells.size(); w < wells.size(); ++w) {
+        sources[w].wellBlocks(blockSource).wellConns(connSource[w]);
+    }
+
+    const auto controls = std::vector {
+        Opm::PAvg { 0.875, 0.123, Opm::PAvg::DepthCorrection::RES, false },
+        AveragingControls::defaults(),
+        Opm::PAvg { -1.0, 0.5, Opm::PAvg::DepthCorrection::WELL, true },
+    };
+
+    const auto refDepth = std::vector { 2001.0, 2000.0, 2003.5 };
+    const auto gravity  = standardGravity();
+
+    collection.inferBlockAveragePressures(sources, controls, gravity, refDepth);
+
+    using WBPMode = Opm::PAvgCalculatorResult<double>::WBPMode;
+
+    for (auto w = 0*wells.size(); w < wells.size(); ++w) {
+        individual[w]->inferBlockAveragePressures(sources[w], controls[w],
+                                                  gravity, refDepth[w]);
+
+        const auto& expect = individual[w]->averagePressures();
+        const auto& batch  = collection[w].averagePressures();
+
+        for (const auto mode : { WBPMode::WBP, WBPMode::WBP4, WBPMode::WBP5, WBPMode::WBP9 }) {
+            BOOST_CHECK_CLOSE(batch.value(mode), expect.value(mode), 1.0e-12);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Collection
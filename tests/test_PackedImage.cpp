@@ -0,0 +1,373 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE Packed_Image
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/PackedImage.hpp>
+#include <opm/common/utility/StreamPacker.hpp>
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+#include <opm/common/utility/TimeService.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Snapshot
+    {
+        std::string name{};
+        std::vector<double> values{};
+        std::map<std::string, std::vector<int>> regions{};
+        std::optional<std::string> title{};
+        std::shared_ptr<std::vector<int>> shared1{};
+        std::shared_ptr<std::vector<int>> shared2{};
+        Opm::time_point start{};
+        std::bitset<10> flags{};
+        std::vector<bool> active{};
+
+        bool operator==(const Snapshot& that) const
+        {
+            return (this->name == that.name)
+                && (this->values == that.values)
+                && (this->regions == that.regions)
+                && (this->title == that.title)
+                && (*this->shared1 == *that.shared1)
+                && (*this->shared2 == *that.shared2)
+                && (this->start == that.start)
+                && (this->flags == that.flags)
+                && (this->active == that.active);
+        }
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(name);
+            serializer(values);
+            serializer(regions);
+            serializer(title);
+            serializer(shared1);
+            serializer(shared2);
+            serializer(start);
+            serializer(flags);
+            serializer(active);
+        }
+    };
+
+    Snapshot makeSnapshot()
+    {
+        auto s = Snapshot{};
+
+        s.name = "NORNE_ATW2013";
+        s.values.resize(100'000);
+        std::iota(s.values.begin(), s.values.end(), 0.5);
+        s.regions["FIPNUM"] = std::vector<int>(5'000, 3);
+        s.regions["FIPABC"] = { 1, 2, 3 };
+        s.title = "Packed image";
+        s.shared1 = std::make_shared<std::vector<int>>(std::vector<int>{ 4, 5, 6 });
+        s.shared2 = s.shared1;
+        s.start = Opm::TimeService::from_time_t(1'000'000'000);
+        s.flags = std::bitset<10>{ 0x2A5 };
+        s.active = { true, false, true, true };
+
+        return s;
+    }
+
+    std::vector<char> randomBytes(const std::size_t n)
+    {
+        auto gen = std::mt19937 { 42 };
+
+        auto bytes = std::vector<char>(n);
+        for (auto& b : bytes) {
+            b = static_cast<char>(gen() & 0xFF);
+        }
+
+        return bytes;
+    }
+
+    std::vector<char> contents(const Opm::Serialization::PackedImage& image)
+    {
+        auto bytes = std::vector<char>(image.size());
+        image.read(0, bytes.data(), bytes.size());
+
+        return bytes;
+    }
+
+    // Exposes the buffer of a serializer using MemPacker.
+    class MemSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+    {
+    public:
+        explicit MemSerializer(const Opm::Serialization::MemPacker& packer)
+            : Opm::Serializer<Opm::Serialization::MemPacker>(packer)
+        {}
+
+        const std::vector<char>& buffer() const { return this->m_buffer; }
+    };
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Append_And_Read_Across_Chunks)
+{
+    auto image = Opm::Serialization::PackedImage { 7 };
+
+    const auto bytes = randomBytes(100);
+    image.append(bytes.data(), 3);
+    image.append(bytes.data() + 3, 50);
+    image.append(bytes.data() + 53, 47);
+
+    BOOST_CHECK_EQUAL(image.size(), std::size_t{100});
+    BOOST_CHECK_EQUAL(image.numChunks(), std::size_t{15});
+    BOOST_CHECK_EQUAL(image.chunk(14).size(), std::size_t{2});
+
+    const auto all = contents(image);
+    BOOST_CHECK_EQUAL_COLLECTIONS(all.begin(), all.end(), bytes.begin(), bytes.end());
+
+    auto part = std::vector<char>(20);
+    image.read(5, part.data(), part.size());
+    BOOST_CHECK_EQUAL_COLLECTIONS(part.begin(), part.end(),
+                                  bytes.begin() + 5, bytes.begin() + 25);
+
+    BOOST_CHECK_THROW(image.read(90, part.data(), part.size()), std::out_of_range);
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage { 0 }, std::invalid_argument);
+
+    image.clear();
+    BOOST_CHECK_EQUAL(image.size(), std::size_t{0});
+    BOOST_CHECK_EQUAL(image.numChunks(), std::size_t{0});
+}
+
+BOOST_AUTO_TEST_CASE(Encode_Decode)
+{
+    using Compression = Opm::Serialization::PackedImage::Compression;
+
+    // Compressible chunks followed by incompressible chunks.
+    auto image = Opm::Serialization::PackedImage { 1 << 12 };
+    {
+        auto repeated = std::vector<char>(20'000);
+        for (auto i = 0*repeated.size(); i < repeated.size(); ++i) {
+            repeated[i] = static_cast<char>('A' + (i % 13));
+        }
+
+        const auto random = randomBytes(10'000);
+
+        image.append(repeated.data(), repeated.size());
+        image.append(random.data(), random.size());
+    }
+
+    const auto expect = contents(image);
+
+    for (const auto compression : { Compression::None, Compression::Fast }) {
+        const auto encoded = image.encode(compression);
+        const auto decoded = Opm::Serialization::PackedImage::decode(encoded);
+
+        BOOST_CHECK_EQUAL(decoded.size(), image.size());
+        BOOST_CHECK_EQUAL(decoded.chunkSize(), image.chunkSize());
+
+        const auto actual = contents(decoded);
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(),
+                                      expect.begin(), expect.end());
+    }
+
+    BOOST_CHECK_MESSAGE(image.encode(Compression::Fast).size() < 15'000,
+                        "Repeated data must be compressed");
+
+    // Empty image
+    {
+        const auto empty = Opm::Serialization::PackedImage{};
+        const auto decoded = Opm::Serialization::PackedImage::decode(empty.encode(Compression::Fast));
+        BOOST_CHECK_EQUAL(decoded.size(), std::size_t{0});
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Decode_Invalid)
+{
+    using Compression = Opm::Serialization::PackedImage::Compression;
+
+    auto image = Opm::Serialization::PackedImage { 1 << 10 };
+    {
+        const auto bytes = std::vector<char>(5'000, 'x');
+        image.append(bytes.data(), bytes.size());
+    }
+
+    auto encoded = image.encode(Compression::Fast);
+
+    auto truncated = encoded;
+    truncated.pop_back();
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage::decode(truncated), std::runtime_error);
+
+    auto badMagic = encoded;
+    badMagic[0] = 'X';
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage::decode(badMagic), std::runtime_error);
+
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage::decode(std::vector<char>(4, 'O')),
+                      std::runtime_error);
+
+    // Header fields which would otherwise trigger huge allocations.  The
+    // chunk size, image size and number of chunks are 64 bit values at
+    // offsets 16, 24, and 32.
+    auto withHeader = [&encoded](const std::uint64_t chunkSize,
+                                 const std::uint64_t size,
+                                 const std::uint64_t numChunks)
+    {
+        auto buffer = std::vector<char>(encoded.begin(), encoded.begin() + 40);
+        std::memcpy(buffer.data() + 16, &chunkSize, sizeof chunkSize);
+        std::memcpy(buffer.data() + 24, &size, sizeof size);
+        std::memcpy(buffer.data() + 32, &numChunks, sizeof numChunks);
+
+        return buffer;
+    };
+
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage::decode
+                      (withHeader(1, std::uint64_t{1} << 61, std::uint64_t{1} << 61)),
+                      std::runtime_error);
+
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage::decode
+                      (withHeader(std::uint64_t{1} << 60, 100, 1)),
+                      std::runtime_error);
+
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage::decode
+                      (withHeader(std::uint64_t{1} << 60, std::uint64_t{1} << 61, 2)),
+                      std::runtime_error);
+
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage::decode
+                      (withHeader(std::uint64_t{1} << 63, std::numeric_limits<std::uint64_t>::max(), 2)),
+                      std::runtime_error);
+
+    // Compressed chunk claiming far more bytes than it can expand to.
+    {
+        auto bigChunk = withHeader(1 << 20, 1 << 20, 1);
+        const auto stored = std::uint64_t{1};
+        bigChunk.resize(bigChunk.size() + sizeof stored);
+        std::memcpy(bigChunk.data() + 40, &stored, sizeof stored);
+        bigChunk.push_back('\0');
+
+        BOOST_CHECK_THROW(Opm::Serialization::PackedImage::decode(bigChunk),
+                          std::runtime_error);
+    }
+
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage
+                      { Opm::Serialization::PackedImage::maxChunkSize + 1 },
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Single_Pass_Matches_MemPacker)
+{
+    const auto snapshot = makeSnapshot();
+
+    Opm::Serialization::MemPacker memPacker;
+    MemSerializer memSer(memPacker);
+    memSer.pack(snapshot);
+
+    auto image = Opm::Serialization::PackedImage { 1 << 12 };
+    Opm::Serialization::StreamPacker packer(image);
+    Opm::Serializer ser(packer);
+    ser.pack(snapshot);
+
+    BOOST_CHECK_EQUAL(ser.position(), memSer.position());
+    BOOST_CHECK_EQUAL(image.size(), memSer.buffer().size());
+
+    const auto bytes = contents(image);
+    BOOST_CHECK_MESSAGE(bytes == memSer.buffer(),
+                        "Packed image must match MemPacker buffer");
+
+    auto unpacked = Snapshot{};
+    ser.unpack(unpacked);
+
+    BOOST_CHECK_EQUAL(ser.position(), image.size());
+    BOOST_CHECK_MESSAGE(unpacked == snapshot, "Unpacked snapshot must match original");
+    BOOST_CHECK_MESSAGE(unpacked.shared1 == unpacked.shared2,
+                        "Shared pointers must remain shared");
+}
+
+BOOST_AUTO_TEST_CASE(Repeated_Packing)
+{
+    const auto snapshot = makeSnapshot();
+
+    auto other = makeSnapshot();
+    other.name = "OTHER";
+    other.values.resize(10);
+
+    auto image = Opm::Serialization::PackedImage { 1 << 12 };
+    Opm::Serialization::StreamPacker packer(image);
+    Opm::Serializer ser(packer);
+
+    ser.pack(other);
+    ser.pack(snapshot);
+
+    // Each pack() starts a new image.
+    BOOST_CHECK_EQUAL(ser.position(), image.size());
+
+    auto unpacked = Snapshot{};
+    ser.unpack(unpacked);
+    BOOST_CHECK_MESSAGE(unpacked == snapshot, "Unpacked snapshot must match last packed");
+
+    ser.pack(other, snapshot);
+    auto first = Snapshot{};
+    auto second = Snapshot{};
+    ser.unpack(first, second);
+    BOOST_CHECK_MESSAGE(first == other, "First unpacked snapshot must match first packed");
+    BOOST_CHECK_MESSAGE(second == snapshot, "Second unpacked snapshot must match second packed");
+    BOOST_CHECK_EQUAL(ser.position(), image.size());
+}
+
+BOOST_AUTO_TEST_CASE(File_Round_Trip)
+{
+    using Compression = Opm::Serialization::PackedImage::Compression;
+
+    const auto snapshot = makeSnapshot();
+    const auto file = std::filesystem::temp_directory_path() / "test_PackedImage.opmpack";
+
+    for (const auto compression : { Compression::None, Compression::Fast }) {
+        {
+            auto image = Opm::Serialization::PackedImage{};
+            Opm::Serialization::StreamPacker packer(image);
+            Opm::Serializer ser(packer);
+            ser.pack(snapshot);
+
+            image.writeFile(file, compression);
+        }
+
+        auto image = Opm::Serialization::PackedImage::readFile(file);
+        Opm::Serialization::StreamPacker packer(image);
+        Opm::Serializer ser(packer);
+
+        auto unpacked = Snapshot{};
+        ser.unpack(unpacked);
+
+        BOOST_CHECK_MESSAGE(unpacked == snapshot, "Snapshot read from file must match original");
+    }
+
+    std::filesystem::remove(file);
+
+    BOOST_CHECK_THROW(Opm::Serialization::PackedImage::readFile(file), std::runtime_error);
+}
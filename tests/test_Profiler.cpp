@@ -0,0 +1,221 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE Profiler
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/Profiler.hpp>
+#include <opm/common/TimingMacros.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void inner()
+{
+    Opm::Profiler::Scope scope { "inner", Opm::Subsystem::AnySystem };
+}
+
+void outer()
+{
+    Opm::Profiler::Scope scope { "outer", Opm::Subsystem::AnySystem };
+    inner();
+    inner();
+}
+
+std::size_t countOccurrences(const std::string& s, const std::string& what)
+{
+    auto n = std::size_t{0};
+    for (auto pos = s.find(what); pos != std::string::npos; pos = s.find(what, pos + 1)) {
+        ++n;
+    }
+
+    return n;
+}
+
+std::string chromeTrace()
+{
+    const auto fname = std::filesystem::temp_directory_path() / "test_Profiler_trace.json";
+    Opm::Profiler::writeChromeTrace(fname);
+
+    auto trace = std::string{};
+    {
+        std::ifstream is { fname };
+        trace.assign(std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{});
+    }
+    std::filesystem::remove(fname);
+
+    return trace;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+    Opm::Profiler::disable();
+    Opm::Profiler::reset();
+
+    BOOST_CHECK_MESSAGE(! Opm::Profiler::isEnabled(Opm::Subsystem::AnySystem),
+                        "Profiler must be disabled by default");
+
+    outer();
+
+    const auto summary = Opm::Profiler::summary();
+    BOOST_CHECK_MESSAGE(summary.find("outer") == std::string::npos,
+                        "Disabled profiler must not record scopes");
+}
+
+BOOST_AUTO_TEST_CASE(NestedScopes)
+{
+    Opm::Profiler::reset();
+    Opm::Profiler::enable();
+
+    outer();
+    outer();
+
+    Opm::Profiler::disable();
+
+    const auto summary = Opm::Profiler::summary();
+
+    const auto outerPos = summary.find("\nouter ");
+    const auto innerPos = summary.find("\n  inner ");
+    BOOST_REQUIRE_MESSAGE(outerPos != std::string::npos, "Summary must include 'outer'");
+    BOOST_REQUIRE_MESSAGE(innerPos != std::string::npos, "Summary must include nested 'inner'");
+    BOOST_CHECK_MESSAGE(outerPos < innerPos, "Nested scope must follow its parent");
+
+    // Two calls to outer(), four to inner().
+    const auto outerLine = summary.substr(outerPos + 1, summary.find('\n', outerPos + 1) - outerPos - 1);
+    const auto innerLine = summary.substr(innerPos + 1, summary.find('\n', innerPos + 1) - innerPos - 1);
+    BOOST_CHECK_MESSAGE(outerLine.find(" 2 ") != std::string::npos, "Outer line: " << outerLine);
+    BOOST_CHECK_MESSAGE(innerLine.find(" 4 ") != std::string::npos, "Inner line: " << innerLine);
+}
+
+BOOST_AUTO_TEST_CASE(Subsystems)
+{
+    Opm::Profiler::reset();
+    Opm::Profiler::enable(Opm::Subsystem::Output);
+
+    {
+        Opm::Profiler::Scope out { "outputScope", Opm::Subsystem::Output };
+        Opm::Profiler::Scope wells { "wellsScope", Opm::Subsystem::Wells };
+    }
+
+    Opm::Profiler::disable();
+
+    const auto summary = Opm::Profiler::summary();
+    BOOST_CHECK_MESSAGE(summary.find("outputScope") != std::string::npos,
+                        "Active subsystem must be recorded");
+    BOOST_CHECK_MESSAGE(summary.find("wellsScope") == std::string::npos,
+                        "Inactive subsystem must not be recorded");
+}
+
+BOOST_AUTO_TEST_CASE(MultipleThreads)
+{
+    Opm::Profiler::reset();
+    Opm::Profiler::enable();
+
+    {
+        auto threads = std::vector<std::thread>{};
+        for (auto t = 0; t < 4; ++t) {
+            threads.emplace_back([]() { for (auto i = 0; i < 10; ++i) { outer(); } });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    Opm::Profiler::disable();
+
+    // Scopes are merged across threads.
+    const auto summary = Opm::Profiler::summary();
+    BOOST_CHECK_EQUAL(countOccurrences(summary, "outer"), std::size_t{1});
+
+    const auto innerPos = summary.find("\n  inner ");
+    BOOST_REQUIRE(innerPos != std::string::npos);
+
+    const auto innerLine = summary.substr(innerPos + 1, summary.find('\n', innerPos + 1) - innerPos - 1);
+    BOOST_CHECK_MESSAGE(innerLine.find(" 80 ") != std::string::npos, "Inner line: " << innerLine);
+}
+
+BOOST_AUTO_TEST_CASE(ChromeTrace)
+{
+    Opm::Profiler::reset();
+    Opm::Profiler::enable(Opm::Subsystem::AnySystem, 4);
+
+    for (auto i = 0; i < 3; ++i) {
+        outer();
+    }
+
+    Opm::Profiler::disable();
+
+    const auto trace = chromeTrace();
+
+    BOOST_CHECK_EQUAL(trace.rfind("{\"traceEvents\":[", 0), std::size_t{0});
+    BOOST_CHECK(trace.find("\"displayTimeUnit\":\"ms\"") != std::string::npos);
+
+    // Ring buffer retains the four most recent of nine completed scopes.
+    BOOST_CHECK_EQUAL(countOccurrences(trace, "\"ph\":\"X\""), std::size_t{4});
+
+    // Aggregate report is not limited by ring capacity.
+    const auto summary = Opm::Profiler::summary();
+    const auto innerPos = summary.find("\n  inner ");
+    BOOST_REQUIRE(innerPos != std::string::npos);
+
+    const auto innerLine = summary.substr(innerPos + 1, summary.find('\n', innerPos + 1) - innerPos - 1);
+    BOOST_CHECK_MESSAGE(innerLine.find(" 6 ") != std::string::npos, "Inner line: " << innerLine);
+}
+
+BOOST_AUTO_TEST_CASE(ChangeRingCapacity)
+{
+    Opm::Profiler::reset();
+    Opm::Profiler::enable(Opm::Subsystem::AnySystem, 4);
+
+    for (auto i = 0; i < 3; ++i) {
+        outer();
+    }
+
+    // Shrinking keeps the most recent scopes, i.e., the last 'outer'.
+    Opm::Profiler::enable(Opm::Subsystem::AnySystem, 1);
+    {
+        const auto trace = chromeTrace();
+        BOOST_CHECK_EQUAL(countOccurrences(trace, "\"ph\":\"X\""), std::size_t{1});
+        BOOST_CHECK_EQUAL(countOccurrences(trace, "\"name\":\"outer\""), std::size_t{1});
+    }
+
+    // Growing keeps the retained scopes and makes room for more.
+    Opm::Profiler::enable(Opm::Subsystem::AnySystem, 8);
+    outer();
+    outer();
+
+    Opm::Profiler::disable();
+
+    const auto trace = chromeTrace();
+    BOOST_CHECK_EQUAL(countOccurrences(trace, "\"ph\":\"X\""), std::size_t{7});
+    BOOST_CHECK_EQUAL(countOccurrences(trace, "\"name\":\"outer\""), std::size_t{3});
+}
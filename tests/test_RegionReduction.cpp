@@ -0,0 +1,212 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE Region_Reduction
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/output/eclipse/RegionReduction.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    // Ten cells.  FIPNUM has two regions, FIPABC has three regions of
+    // which region 2 is empty, and cell 9 is not part of any FIPABC
+    // region.
+    Opm::out::RegionReduction smallModel()
+    {
+        auto reduction = Opm::out::RegionReduction { 10 };
+
+        reduction.addRegionSet("FIPNUM", { 1, 1, 1, 1, 1, 2, 2, 2, 2, 2 });
+        reduction.addRegionSet("FIPABC", { 3, 3, 1, 1, 1, 1, 3, 3, 3, 0 });
+
+        return reduction;
+    }
+
+    const auto pressure = std::vector<double> {
+        100.0, 110.0, 120.0, 130.0, 140.0, 150.0, 160.0, 170.0, 180.0, 190.0,
+    };
+
+    const auto oil = std::vector<double> {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0,
+    };
+
+    const auto pv = std::vector<double> {
+        1.0, 1.0, 1.0, 1.0, 1.0, 3.0, 3.0, 3.0, 3.0, 3.0,
+    };
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Region_Sets)
+{
+    const auto reduction = smallModel();
+
+    BOOST_CHECK_EQUAL(reduction.numRegionSets(), std::size_t{2});
+    BOOST_CHECK_EQUAL(reduction.maxRegionID(0), 2);
+    BOOST_CHECK_EQUAL(reduction.maxRegionID(1), 3);
+
+    BOOST_CHECK_EQUAL(reduction.regionSetIndex("FIPABC").value(), std::size_t{1});
+    BOOST_CHECK_MESSAGE(! reduction.regionSetIndex("FIPXYZ").has_value(),
+                        "Region set FIPXYZ must not exist");
+}
+
+BOOST_AUTO_TEST_CASE(Invalid_Input)
+{
+    auto reduction = smallModel();
+
+    BOOST_CHECK_THROW(reduction.addRegionSet("FIPNUM", std::vector<int>(10, 1)),
+                      std::invalid_argument);
+
+    BOOST_CHECK_THROW(reduction.addRegionSet("FIPXYZ", std::vector<int>(9, 1)),
+                      std::invalid_argument);
+
+    const auto shortArray = std::vector<double>(9, 1.0);
+    BOOST_CHECK_THROW(reduction.reduce({ pressure, shortArray }), std::invalid_argument);
+    BOOST_CHECK_THROW(reduction.reduce({ pressure }, shortArray), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Single_Sweep)
+{
+    const auto result = smallModel().reduce({ pressure, oil }, pv);
+
+    BOOST_CHECK_EQUAL(result.numQuantities(), std::size_t{2});
+    BOOST_CHECK_EQUAL(result.numRegionSets(), std::size_t{2});
+    BOOST_CHECK_EQUAL(result.regionSetName(1), "FIPABC");
+
+    BOOST_CHECK_CLOSE(result.total(0), 1450.0, 1.0e-10);
+    BOOST_CHECK_CLOSE(result.total(1), 55.0, 1.0e-10);
+
+    // FIPNUM
+    {
+        const auto sum = result.sum(0, 1);
+        BOOST_REQUIRE_EQUAL(sum.size(), std::size_t{2});
+        BOOST_CHECK_CLOSE(sum[0], 15.0, 1.0e-10);
+        BOOST_CHECK_CLOSE(sum[1], 40.0, 1.0e-10);
+
+        const auto min = result.min(0, 0);
+        const auto max = result.max(0, 0);
+        BOOST_CHECK_CLOSE(min[0], 100.0, 1.0e-10);
+        BOOST_CHECK_CLOSE(max[0], 140.0, 1.0e-10);
+        BOOST_CHECK_CLOSE(min[1], 150.0, 1.0e-10);
+        BOOST_CHECK_CLOSE(max[1], 190.0, 1.0e-10);
+
+        const auto avg = result.average(0, 0);
+        BOOST_CHECK_CLOSE(avg[0], 120.0, 1.0e-10);
+        BOOST_CHECK_CLOSE(avg[1], 170.0, 1.0e-10);
+
+        const auto regPV = result.poreVolume(0);
+        BOOST_CHECK_CLOSE(regPV[0], 5.0, 1.0e-10);
+        BOOST_CHECK_CLOSE(regPV[1], 15.0, 1.0e-10);
+    }
+
+    // FIPABC
+    {
+        const auto count = result.numCells(1);
+        const auto expect = std::vector<std::size_t> { 4, 0, 5 };
+        BOOST_CHECK_EQUAL_COLLECTIONS(count.begin(), count.end(),
+                                      expect.begin(), expect.end());
+
+        const auto sum = result.sum(1, 1);
+        BOOST_REQUIRE_EQUAL(sum.size(), std::size_t{3});
+        BOOST_CHECK_CLOSE(sum[0], 18.0, 1.0e-10);
+        BOOST_CHECK_EQUAL(sum[1], 0.0);
+        BOOST_CHECK_CLOSE(sum[2], 27.0, 1.0e-10);
+
+        // Empty region
+        BOOST_CHECK_EQUAL(result.min(1, 0)[1], 0.0);
+        BOOST_CHECK_EQUAL(result.max(1, 0)[1], 0.0);
+        BOOST_CHECK_EQUAL(result.average(1, 0)[1], 0.0);
+
+        // Region 1: cells 2..5 with pore volumes 1, 1, 1, 3.
+        const auto avg = result.average(1, 0);
+        BOOST_CHECK_CLOSE(avg[0], (120.0 + 130.0 + 140.0 + 3*150.0) / 6.0, 1.0e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Arithmetic_Average)
+{
+    const auto result = smallModel().reduce({ pressure });
+
+    const auto avg = result.average(1, 0);
+    BOOST_CHECK_CLOSE(avg[0], 135.0, 1.0e-10);
+    BOOST_CHECK_CLOSE(avg[2], 144.0, 1.0e-10);
+
+    const auto regPV = result.poreVolume(1);
+    BOOST_CHECK_CLOSE(regPV[2], 5.0, 1.0e-10);
+}
+
+BOOST_AUTO_TEST_CASE(Large_Model)
+{
+    // Large enough to run the sweep in parallel when OpenMP is enabled.
+    const auto numCells = std::size_t{250'000};
+
+    auto fipnum = std::vector<int>(numCells);
+    auto fipabc = std::vector<int>(numCells);
+    auto value = std::vector<double>(numCells);
+    auto porv = std::vector<double>(numCells);
+
+    for (auto cell = 0*numCells; cell < numCells; ++cell) {
+        fipnum[cell] = 1 + static_cast<int>(cell % 7);
+        fipabc[cell] = static_cast<int>((cell / 1000) % 5);
+        value[cell] = static_cast<double>(cell % 113);
+        porv[cell] = 1.0 + static_cast<double>(cell % 3);
+    }
+
+    auto reduction = Opm::out::RegionReduction { numCells };
+    reduction.addRegionSet("FIPNUM", fipnum);
+    reduction.addRegionSet("FIPABC", fipabc);
+
+    const auto result = reduction.reduce({ value }, porv);
+
+    for (const auto& [regSet, regionID] : { std::pair { 0, &fipnum }, std::pair { 1, &fipabc } }) {
+        const auto maxID = reduction.maxRegionID(regSet);
+
+        auto sum = std::vector<double>(maxID, 0.0);
+        auto wsum = std::vector<double>(maxID, 0.0);
+        auto pvsum = std::vector<double>(maxID, 0.0);
+        auto min = std::vector<double>(maxID, std::numeric_limits<double>::max());
+        auto max = std::vector<double>(maxID, std::numeric_limits<double>::lowest());
+
+        for (auto cell = 0*numCells; cell < numCells; ++cell) {
+            const auto r = (*regionID)[cell] - 1;
+            if (r < 0) { continue; }
+
+            sum[r] += value[cell];
+            wsum[r] += porv[cell] * value[cell];
+            pvsum[r] += porv[cell];
+            min[r] = std::min(min[r], value[cell]);
+            max[r] = std::max(max[r], value[cell]);
+        }
+
+        for (auto r = 0; r < maxID; ++r) {
+            BOOST_CHECK_CLOSE(result.sum(regSet, 0)[r], sum[r], 1.0e-10);
+            BOOST_CHECK_CLOSE(result.average(regSet, 0)[r], wsum[r] / pvsum[r], 1.0e-10);
+            BOOST_CHECK_CLOSE(result.poreVolume(regSet)[r], pvsum[r], 1.0e-10);
+            BOOST_CHECK_EQUAL(result.min(regSet, 0)[r], min[r]);
+            BOOST_CHECK_EQUAL(result.max(regSet, 0)[r], max[r]);
+        }
+    }
+}
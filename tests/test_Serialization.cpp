@@ -163,8 +163,11 @@
 
 #include <opm/common/utility/Serializer.hpp>
 #include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/PackedImage.hpp>
+#include <opm/common/utility/StreamPacker.hpp>
 
 #include <cstddef>
+#include <filesystem>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -384,6 +387,43 @@ TEST_FOR_TYPE(WriteRestartFileEvents)
 TEST_FOR_TYPE(WCYCLE)
 TEST_FOR_TYPE(EzrokhiTable)
 
+BOOST_AUTO_TEST_CASE(Schedule_PackedImage)
+{
+    const auto sched = Opm::Schedule::serializationTestObject();
+    const auto file = std::filesystem::temp_directory_path() / "Schedule_PackedImage.opmpack";
+
+    std::size_t memSize = 0;
+    {
+        Opm::Serialization::MemPacker packer;
+        Opm::Serializer ser(packer);
+        ser.pack(sched);
+        memSize = ser.position();
+    }
+
+    {
+        Opm::Serialization::PackedImage image;
+        Opm::Serialization::StreamPacker packer(image);
+        Opm::Serializer ser(packer);
+        ser.pack(sched);
+
+        BOOST_CHECK_EQUAL(image.size(), memSize);
+
+        image.writeFile(file, Opm::Serialization::PackedImage::Compression::Fast);
+    }
+
+    auto image = Opm::Serialization::PackedImage::readFile(file);
+    std::filesystem::remove(file);
+
+    Opm::Serialization::StreamPacker packer(image);
+    Opm::Serializer ser(packer);
+
+    Opm::Schedule restored;
+    ser.unpack(restored);
+
+    BOOST_CHECK_EQUAL(ser.position(), memSize);
+    BOOST_CHECK_MESSAGE(restored == sched, "Schedule restored from packed image differs");
+}
+
 namespace {
 
 bool init_unit_test_func()